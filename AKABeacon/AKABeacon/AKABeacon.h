@@ -86,6 +86,7 @@ FOUNDATION_EXPORT const unsigned char AKABeaconVersionString[];
 #import <AKABeacon/NSIndexPath+AKARowAndSectionAsInteger.h>
 #import <AKABeacon/NSMutableString+AKATools.h>
 #import <AKABeacon/NSObject+AKAAssociatedValues.h>
+#import <AKABeacon/AKAAssociatedStorage.h>
 #import <AKABeacon/NSObject+AKAConcurrencyTools.h>
 #import <AKABeacon/NSObject+AKASelectorTools.h>
 #import <AKABeacon/NSString+AKAKeyPathUtilities.h>
@@ -193,6 +194,7 @@ FOUNDATION_EXPORT const unsigned char AKABeaconVersionString[];
 #import <AKABeacon/AKAViewBinding.h>
 
 #import <AKABeacon/AKAFontPropertyBinding.h>
+#import <AKABeacon/AKAFontCache.h>
 
 // Bindings/ViewBindings/UIBarButtonItem
 #import <AKABeacon/AKABinding_UIBarButtonBinding_titleBinding.h>
@@ -210,6 +212,7 @@ FOUNDATION_EXPORT const unsigned char AKABeaconVersionString[];
 
 // Bindings/ViewBindings/UIImageView
 #import <AKABeacon/AKABinding_UIImageView_imageBinding.h>
+#import <AKABeacon/AKAImageLoader.h>
 
 // Bindings/ViewBindings/UIProgressView
 #import <AKABeacon/AKABinding_UIProgressView_progressBinding.h>
@@ -303,6 +306,11 @@ FOUNDATION_EXPORT const unsigned char AKABeaconVersionString[];
 #import <AKABeacon/AKATimeZonePropertyBinding.h>
 #import <AKABeacon/AKAAttributedFormatterPropertyBinding.h>
 #import <AKABeacon/AKAAttributedFormatter.h>
+#import <AKABeacon/AKAFormatterPool.h>
+#import <AKABeacon/AKAConversionCache.h>
+#import <AKABeacon/AKABindingInstrumentation.h>
+#import <AKABeacon/AKAMainThreadWatchdog.h>
+#import <AKABeacon/AKAStringPatternMatcher.h>
 
 // Bindings/PropertyBindings/GestureRecognizers
 #import <AKABeacon/AKATapGestureRecognizerBinding.h>
@@ -394,6 +402,7 @@ FOUNDATION_EXPORT const unsigned char AKABeaconVersionString[];
 #import <AKABeacon/AKAViewCustomization.h>
 #import <AKABeacon/AKAThemeLayout.h>
 #import <AKABeacon/AKALayoutConstraintSpecification.h>
+#import <AKABeacon/AKALayoutConstraintDiff.h>
 #import <AKABeacon/AKAThemableContainerView.h>
 #import <AKABeacon/AKAThemableContainerView_Protected.h>
 #import <AKABeacon/AKASubviewsSpecification.h>
@@ -0,0 +1,73 @@
+//
+//  AKAAssociatedStorage.h
+//  AKABeacon
+//
+//  Created by Michael Utech on 19.10.16.
+//  Copyright © 2016 Michael Utech & AKA Sarl. All rights reserved.
+//
+
+@import Foundation;
+
+#import "AKANullability.h"
+
+@class AKAAssociatedStorage;
+#define req_AKAAssociatedStorage AKAAssociatedStorage*_Nonnull
+#define opt_AKAAssociatedStorage AKAAssociatedStorage*_Nullable
+
+
+/**
+ Compact storage for values associated with an object, keyed by pointers (selectors or the addresses of static variables).
+
+ Up to eight values are stored inline and looked up by a linear scan, larger storages are promoted to a hash table. Keys are compared by identity, values are retained.
+
+ Storages are attached to their owner as associated objects (see objc_setAssociatedObject), an object can own multiple storages using different association keys. Storages are not created by read-only accesses, querying an object without storage does not allocate anything.
+
+ @note Storages are not thread safe. Callers are responsible to synchronize accesses, typically by restricting them to the main thread.
+ */
+@interface AKAAssociatedStorage: NSObject
+
+#pragma mark - Accessing Storages
+
+/**
+ Returns the storage associated with the specified object using the specified association key.
+
+ @param object the owner of the storage.
+ @param associationKey the key used to associate the storage with its owner.
+ @param createIfMissing whether to create and attach a new storage if the object does not own one.
+
+ @return the storage or nil, if the object does not own a storage and createIfMissing is NO.
+ */
++ (opt_AKAAssociatedStorage)storageForObject:(req_id)object
+                              associationKey:(const void*_Nonnull)associationKey
+                             createIfMissing:(BOOL)createIfMissing;
+
+/**
+ Detaches the storage associated with the specified object using the specified association key.
+ */
++ (void)                 removeStorageForObject:(req_id)object
+                                 associationKey:(const void*_Nonnull)associationKey;
+
+#pragma mark - Values
+
+@property(nonatomic, readonly) NSUInteger count;
+
+- (opt_id)                   valueForStorageKey:(const void*_Nonnull)key;
+
+/**
+ Associates the value with the specified key. A nil value removes the key.
+ */
+- (void)                               setValue:(opt_id)value
+                                  forStorageKey:(const void*_Nonnull)key;
+
+- (void)               removeValueForStorageKey:(const void*_Nonnull)key;
+
+- (void)                        removeAllValues;
+
+/**
+ Enumerates keys and values. Inline storages are enumerated in insertion order, the order is undefined for storages promoted to hash tables. The storage must not be modified during the enumeration.
+ */
+- (void)              enumerateValuesUsingBlock:(void(^_Nonnull)(const void*_Nonnull key,
+                                                                 req_id value,
+                                                                 outreq_BOOL stop))block;
+
+@end
@@ -0,0 +1,233 @@
+//
+//  AKAAssociatedStorage.m
+//  AKABeacon
+//
+//  Created by Michael Utech on 19.10.16.
+//  Copyright © 2016 Michael Utech & AKA Sarl. All rights reserved.
+//
+
+#import <objc/runtime.h>
+
+#import "AKAAssociatedStorage.h"
+
+
+#define AKAAssociatedStorageInlineCapacity 8
+
+typedef struct
+{
+    const void* key;
+    CFTypeRef   value;
+} AKAAssociatedStorageEntry;
+
+
+#pragma mark - AKAAssociatedStorage - Private Interface
+#pragma mark -
+
+@interface AKAAssociatedStorage()
+{
+    AKAAssociatedStorageEntry   _entries[AKAAssociatedStorageInlineCapacity];
+    NSUInteger                  _inlineCount;
+
+    // Replaces inline entries once the storage exceeds the inline capacity. Keys are not retained
+    // and compared by identity, values are retained.
+    CFMutableDictionaryRef      _table;
+}
+
+@end
+
+
+#pragma mark - AKAAssociatedStorage - Implementation
+#pragma mark -
+
+@implementation AKAAssociatedStorage
+
+#pragma mark - Accessing Storages
+
++ (opt_AKAAssociatedStorage)storageForObject:(req_id)object
+                              associationKey:(const void*)associationKey
+                             createIfMissing:(BOOL)createIfMissing
+{
+    AKAAssociatedStorage* result = objc_getAssociatedObject(object, associationKey);
+
+    if (result == nil && createIfMissing)
+    {
+        result = [AKAAssociatedStorage new];
+        objc_setAssociatedObject(object, associationKey, result, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+    }
+    NSAssert(result == nil || [result isKindOfClass:[AKAAssociatedStorage class]],
+             @"Invalid type %@ for value %@ associated with key %p", [result class], result, associationKey);
+
+    return result;
+}
+
++ (void)                 removeStorageForObject:(req_id)object
+                                 associationKey:(const void*)associationKey
+{
+    objc_setAssociatedObject(object, associationKey, nil, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+}
+
+#pragma mark - Initialization
+
+- (void)dealloc
+{
+    [self removeAllValues];
+}
+
+#pragma mark - Values
+
+- (NSUInteger)count
+{
+    return _table ? (NSUInteger)CFDictionaryGetCount(_table) : _inlineCount;
+}
+
+- (NSUInteger)inlineIndexForKey:(const void*)key
+{
+    NSUInteger result = NSNotFound;
+
+    for (NSUInteger i = 0; i < _inlineCount; ++i)
+    {
+        if (_entries[i].key == key)
+        {
+            result = i;
+            break;
+        }
+    }
+
+    return result;
+}
+
+- (opt_id)                   valueForStorageKey:(const void*)key
+{
+    CFTypeRef result = NULL;
+
+    if (_table)
+    {
+        result = CFDictionaryGetValue(_table, key);
+    }
+    else
+    {
+        NSUInteger index = [self inlineIndexForKey:key];
+        if (index != NSNotFound)
+        {
+            result = _entries[index].value;
+        }
+    }
+
+    return (__bridge id)result;
+}
+
+- (void)                               setValue:(opt_id)value
+                                  forStorageKey:(const void*)key
+{
+    if (value == nil)
+    {
+        [self removeValueForStorageKey:key];
+    }
+    else if (_table)
+    {
+        CFDictionarySetValue(_table, key, (__bridge CFTypeRef)value);
+    }
+    else
+    {
+        NSUInteger index = [self inlineIndexForKey:key];
+        if (index != NSNotFound)
+        {
+            CFTypeRef oldValue = _entries[index].value;
+            _entries[index].value = CFBridgingRetain(value);
+            CFRelease(oldValue);
+        }
+        else if (_inlineCount < AKAAssociatedStorageInlineCapacity)
+        {
+            _entries[_inlineCount].key = key;
+            _entries[_inlineCount].value = CFBridgingRetain(value);
+            ++_inlineCount;
+        }
+        else
+        {
+            [self promoteToTable];
+            CFDictionarySetValue(_table, key, (__bridge CFTypeRef)value);
+        }
+    }
+}
+
+- (void)               removeValueForStorageKey:(const void*)key
+{
+    if (_table)
+    {
+        CFDictionaryRemoveValue(_table, key);
+    }
+    else
+    {
+        NSUInteger index = [self inlineIndexForKey:key];
+        if (index != NSNotFound)
+        {
+            CFRelease(_entries[index].value);
+            // Preserve insertion order
+            memmove(&_entries[index], &_entries[index + 1],
+                    (_inlineCount - index - 1) * sizeof(AKAAssociatedStorageEntry));
+            --_inlineCount;
+        }
+    }
+}
+
+- (void)                        removeAllValues
+{
+    if (_table)
+    {
+        CFRelease(_table);
+        _table = NULL;
+    }
+    for (NSUInteger i = 0; i < _inlineCount; ++i)
+    {
+        CFRelease(_entries[i].value);
+    }
+    _inlineCount = 0;
+}
+
+- (void)              enumerateValuesUsingBlock:(void(^)(const void* key,
+                                                         req_id value,
+                                                         outreq_BOOL stop))block
+{
+    BOOL stop = NO;
+
+    if (_table)
+    {
+        CFIndex count = CFDictionaryGetCount(_table);
+        const void** keys = malloc((size_t)count * sizeof(void*));
+        const void** values = malloc((size_t)count * sizeof(void*));
+        CFDictionaryGetKeysAndValues(_table, keys, values);
+        for (CFIndex i = 0; i < count && !stop; ++i)
+        {
+            block(keys[i], (__bridge id)values[i], &stop);
+        }
+        free(keys);
+        free(values);
+    }
+    else
+    {
+        for (NSUInteger i = 0; i < _inlineCount && !stop; ++i)
+        {
+            block(_entries[i].key, (__bridge id)_entries[i].value, &stop);
+        }
+    }
+}
+
+#pragma mark - Implementation
+
+- (void)promoteToTable
+{
+    NSAssert(_table == NULL, @"Storage has already been promoted");
+
+    _table = CFDictionaryCreateMutable(kCFAllocatorDefault,
+                                       0,
+                                       NULL,
+                                       &kCFTypeDictionaryValueCallBacks);
+    for (NSUInteger i = 0; i < _inlineCount; ++i)
+    {
+        CFDictionarySetValue(_table, _entries[i].key, _entries[i].value);
+        CFRelease(_entries[i].value);
+    }
+    _inlineCount = 0;
+}
+
+@end
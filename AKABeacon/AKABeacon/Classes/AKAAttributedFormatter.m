@@ -9,6 +9,19 @@
 #import "AKANullability.h"
 
 #import "AKAAttributedFormatter.h"
+#import "AKAStringPatternMatcher.h"
+
+
+@interface AKAAttributedFormatter()
+
+/**
+ Matcher compiled for the current pattern and pattern options, created on demand and
+ reset whenever the pattern or options change.
+ */
+@property(nonatomic) AKAStringPatternMatcher* patternMatcher;
+
+@end
+
 
 @implementation AKAAttributedFormatter
 
@@ -33,6 +46,38 @@
     return result;
 }
 
+#pragma mark - Properties
+
+- (void)setPattern:(NSString *)pattern
+{
+    if (pattern != _pattern && ![pattern isEqualToString:_pattern])
+    {
+        _pattern = pattern;
+        self.patternMatcher = nil;
+    }
+}
+
+- (void)setPatternOptions:(NSStringCompareOptions)patternOptions
+{
+    if (patternOptions != _patternOptions)
+    {
+        _patternOptions = patternOptions;
+        self.patternMatcher = nil;
+    }
+}
+
+- (AKAStringPatternMatcher *)patternMatcher
+{
+    if (_patternMatcher == nil && self.pattern.length > 0)
+    {
+        _patternMatcher = [[AKAStringPatternMatcher alloc] initWithPattern:self.pattern
+                                                                   options:self.patternOptions];
+    }
+    return _patternMatcher;
+}
+
+#pragma mark - Formatting
+
 - (NSString *)stringForObjectValue:(id)obj
 {
     NSString* result;
@@ -54,15 +99,19 @@
     NSString* text = [self stringForObjectValue:obj];
     NSMutableAttributedString* result = [[NSMutableAttributedString alloc] initWithString:text
                                                                                attributes:defaultAttributes];
-    if (self.pattern.length > 0)
+    NSDictionary<NSString*, id>* attributes = self.attributes;
+    if (self.pattern.length > 0 && attributes.count > 0)
     {
+        // Batch attribute changes for all matches into one edit
+        [result beginEditing];
         [self enumateRangesForMatchesOfPattern:self.pattern
                                       inString:text
                                          block:
          ^(NSRange range, BOOL * _Nonnull stop) {
              (void)stop;
-             [result addAttributes:self.attributes range:range];
+             [result addAttributes:attributes range:range];
          }];
+        [result endEditing];
     }
 
     return result;
@@ -74,21 +123,15 @@
 {
     NSUInteger result = 0;
 
-    if (text.length > 0)
+    if (text.length > 0 && pattern.length > 0)
     {
-        NSRange scope = NSMakeRange(0, text.length);
-        __block BOOL stop = scope.length <= 0;
-        while (!stop)
+        AKAStringPatternMatcher* matcher = self.patternMatcher;
+        if (matcher == nil || ![pattern isEqualToString:matcher.pattern])
         {
-            NSRange range = [text rangeOfString:pattern options:self.patternOptions range:scope];
-            stop = range.location == NSNotFound || range.length <= 0;
-            if (!stop)
-            {
-                scope = NSMakeRange(scope.location + range.length, scope.length - range.length);
-                ++result;
-                block(range, &stop);
-            }
+            matcher = [[AKAStringPatternMatcher alloc] initWithPattern:pattern
+                                                               options:self.patternOptions];
         }
+        result = [matcher enumerateRangesOfMatchesInString:text usingBlock:block];
     }
 
     return result;
@@ -49,7 +49,7 @@
             NSString* message = [NSString stringWithFormat:@"Attempt to set invalid binding expression for property %@ in view %@", NSStringFromSelector(selector), view];
 
 #if TARGET_INTEFACE_BUILDER
-            AKALogError(@"%@: %@", message, error.localizedDescription);
+            AKALogErrorC(Binding, @"%@: %@", message, error.localizedDescription);
 #else
             @throw([NSException exceptionWithName:message reason:error.localizedDescription userInfo:nil]);
 #endif
@@ -15,6 +15,8 @@
 #import "AKALog.h"
 #import "AKABindingErrors.h"
 #import "AKABindingExpressionEvaluator.h"
+#import "AKABindingAttributeTable.h"
+#import "AKABindingInitializationPlan.h"
 
 @implementation AKABinding (SubclassInitialization)
 
@@ -335,109 +337,119 @@
 - (BOOL)                    initializeAttributesWithExpression:(req_AKABindingExpression)bindingExpression
                                                          error:(out_NSError)error
 {
-    __block BOOL result = YES;
+    BOOL result = YES;
+    NSError* localError = nil;
 
-    (void)error;
+    AKABindingInitializationPlan* plan = [AKABindingInitializationPlan planForExpression:bindingExpression
+                                                                            bindingType:self.class];
+    AKABindingAttributeTable* attributeTable = plan.attributeTable;
+
+    for (AKABindingInitializationStep* step in plan.steps)
+    {
+        NSString* attributeName = step.attributeName;
+        req_AKABindingExpression attribute = step.attributeExpression;
+        AKABindingAttributeTableEntry* attributeEntry = step.entry;
+
+        switch (step.kind)
+        {
+            case AKABindingInitializationStepKindAssignValue:
+            {
+                [attributeTable assignValue:step.value
+                          toBindingProperty:attributeEntry.bindingPropertyName
+                                  ofBinding:self];
+                break;
+            }
+
+            case AKABindingInitializationStepKindUnspecifiedAttribute:
+            {
+                result = [self initializeUnspecifiedAttribute:attributeName
+                                          attributeExpression:attribute
+                                                        error:&localError];
+                break;
+            }
+
+            case AKABindingInitializationStepKindAttribute:
+            {
+                AKABindingAttributeSpecification* attributeSpec = attributeEntry.specification;
+                NSString* bindingPropertyName = attributeEntry.bindingPropertyName;
+
+                switch (attributeEntry.attributeUse)
+                {
+                    case AKABindingAttributeUseManually:
+                    {
+                        result = [self initializeManualAttributeWithName:attributeName
+                                                           specification:attributeSpec
+                                                     attributeExpression:attribute
+                                                                   error:&localError];
+                        break;
+                    }
+
+                    case AKABindingAttributeUseAssignValueToBindingProperty:
+                    {
+                        result = [self initializeBindingPropertyValueAssignmentAttribute:bindingPropertyName
+                                                                       withSpecification:attributeSpec
+                                                                     attributeExpression:attribute
+                                                                                   error:&localError];
+                        break;
+                    }
+
+                    case AKABindingAttributeUseAssignExpressionToBindingProperty:
+                    {
+                        result = [self initializeBindingPropertyExpressionAssignmentAttribute:bindingPropertyName
+                                                                            withSpecification:attributeSpec
+                                                                          attributeExpression:attribute
+                                                                                        error:&localError];
+                        break;
+                    }
+
+                    case AKABindingAttributeUseAssignEvaluatorToBindingProperty:
+                    {
+                        result = [self initializeBindingPropertyEvaluatorAssignmentAttribute:bindingPropertyName
+                                                                           withSpecification:attributeSpec
+                                                                         attributeExpression:attribute
+                                                                                       error:&localError];
+                        break;
+                    }
+
+                    case AKABindingAttributeUseAssignValueToTargetProperty:
+                    {
+                        result = [self initializeTargetPropertyValueAssignmentAttribute:bindingPropertyName
+                                                                      withSpecification:attributeSpec
+                                                                    attributeExpression:attribute
+                                                                                  error:&localError];
+                        break;
+                    }
+
+                    case AKABindingAttributeUseBindToBindingProperty:
+                    {
+                        result = [self initializeBindingPropertyBindingAttribute:bindingPropertyName
+                                                               withSpecification:attributeSpec
+                                                             attributeExpression:attribute
+                                                                           error:&localError];
+                        break;
+                    }
 
-    __block NSError* localError = nil;
-
-    AKABindingSpecification* specification = [self.class specification];
-
-    [((opt_AKABindingExpressionAttributes)(bindingExpression.attributes)) enumerateKeysAndObjectsUsingBlock:
-     ^(req_NSString attributeName,
-       req_AKABindingExpression attribute,
-       outreq_BOOL stop)
-     {
-         (void)stop;
-
-         AKABindingAttributeSpecification* attributeSpec =
-         specification.bindingSourceSpecification.attributes[attributeName];
-
-         if (attributeSpec)
-         {
-             NSString* bindingPropertyName = attributeSpec.bindingPropertyName;
-
-             if (bindingPropertyName == nil)
-             {
-                 bindingPropertyName = attributeName;
-             }
-
-             switch (attributeSpec.attributeUse)
-             {
-                 case AKABindingAttributeUseManually:
-                 {
-                     result = [self initializeManualAttributeWithName:attributeName
-                                                        specification:attributeSpec
-                                                  attributeExpression:attribute
-                                                                error:&localError];
-                     break;
-                 }
-
-                 case AKABindingAttributeUseAssignValueToBindingProperty:
-                 {
-                     result = [self initializeBindingPropertyValueAssignmentAttribute:bindingPropertyName withSpecification:attributeSpec attributeExpression:attribute error:&localError];
-                     break;
-                 }
-
-                 case AKABindingAttributeUseAssignExpressionToBindingProperty:
-                 {
-                     result = [self initializeBindingPropertyExpressionAssignmentAttribute:bindingPropertyName
-                                                                         withSpecification:attributeSpec
-                                                                       attributeExpression:attribute
-                                                                                     error:&localError];
-                     break;
-                 }
-
-
-                 case AKABindingAttributeUseAssignEvaluatorToBindingProperty:
-                 {
-                     result = [self initializeBindingPropertyEvaluatorAssignmentAttribute:bindingPropertyName
-                                                                        withSpecification:attributeSpec
-                                                                      attributeExpression:attribute
-                                                                                    error:&localError];
-                     break;
-                 }
-
-                 case AKABindingAttributeUseAssignValueToTargetProperty:
-                 {
-                     result = [self initializeTargetPropertyValueAssignmentAttribute:bindingPropertyName
-                                                                   withSpecification:attributeSpec
-                                                                 attributeExpression:attribute
-                                                                               error:&localError];
-                     break;
-                 }
-
-                 case AKABindingAttributeUseBindToBindingProperty:
-                 {
-                     result = [self initializeBindingPropertyBindingAttribute:bindingPropertyName
-                                                            withSpecification:attributeSpec
-                                                          attributeExpression:attribute
-                                                                        error:&localError];
-
-                     break;
-                 }
-
-                 case AKABindingAttributeUseBindToTargetProperty:
-                 {
-                     result = [self initializeTargetPropertyBindingAttribute:bindingPropertyName
-                                                           withSpecification:attributeSpec
-                                                         attributeExpression:attribute
-                                                                       error:&localError];
-                     break;
-                 }
-
-                 default:
-                     break;
-             }
-         }
-         else
-         {
-             result = [self initializeUnspecifiedAttribute:attributeName
-                                       attributeExpression:attribute
-                                                     error:&localError];
-         }
-         *stop = !result;
-     }];
+                    case AKABindingAttributeUseBindToTargetProperty:
+                    {
+                        result = [self initializeTargetPropertyBindingAttribute:bindingPropertyName
+                                                              withSpecification:attributeSpec
+                                                            attributeExpression:attribute
+                                                                          error:&localError];
+                        break;
+                    }
+
+                    default:
+                        break;
+                }
+                break;
+            }
+        }
+
+        if (!result)
+        {
+            break;
+        }
+    }
 
     if (!result && error)
     {
@@ -461,7 +473,9 @@
                                                          error:(out_NSError __unused)error
 {
     id value = [attributeExpression bindingSourceValueInContext:self.bindingContext];
-    [self setValue:value forKey:bindingProperty];
+    [[AKABindingAttributeTable tableForBindingType:self.class] assignValue:value
+                                                        toBindingProperty:bindingProperty
+                                                                ofBinding:self];
     return YES;
 }
 
@@ -470,7 +484,9 @@
                                            attributeExpression:(req_AKABindingExpression)attributeExpression
                                                          error:(out_NSError __unused)error
 {
-    [self setValue:attributeExpression forKey:bindingProperty];
+    [[AKABindingAttributeTable tableForBindingType:self.class] assignValue:attributeExpression
+                                                        toBindingProperty:bindingProperty
+                                                                ofBinding:self];
     return YES;
 }
 
@@ -496,7 +512,9 @@
 
     if (result)
     {
-        [self setValue:evaluator forKeyPath:bindingProperty];
+        [[AKABindingAttributeTable tableForBindingType:self.class] assignValue:evaluator
+                                                            toBindingProperty:bindingProperty
+                                                                    ofBinding:self];
     }
     else
     {
@@ -517,7 +535,7 @@
     if (target == nil)
     {
         // If the target does not yet have a defined value, a binding will be created to ensure that the value is not lost.
-        AKALogWarn(@"Cannot assign binding %@ attribute value %@ to target property %@ because the target is undefined. To support defered target assignment, a property binding will be created instead", self, attributeExpression, bindingProperty);
+        AKALogWarnC(Binding, @"Cannot assign binding %@ attribute value %@ to target property %@ because the target is undefined. To support defered target assignment, a property binding will be created instead", self, attributeExpression, bindingProperty);
 
         result = [self initializeTargetPropertyBindingAttribute:bindingProperty withSpecification:specification attributeExpression:attributeExpression error:error];
     }
@@ -77,6 +77,11 @@
  */
 @property(nonatomic, readonly, weak, nullable) id<AKABindingContextProtocol>  bindingContext;
 
+/**
+ The binding expression from which this binding has been created.
+ */
+@property(nonatomic, readonly, nullable) AKABindingExpression*                bindingExpression;
+
 /**
  Property wrapping the source value of the binding. Bindings which do not support a binding source have to provide a property that refers to an undefined (nil) value, changing this value will typically have no effect.
  */
@@ -21,17 +21,23 @@
 // Well Known Binding Types
 #import "AKAConditionalBinding.h"
 #import "AKAPropertyBinding.h"
+#import "AKABindingAttributeTable.h"
 
 #import "AKABindingErrors.h"
 #import "AKABindingExpressionEvaluator.h"
 #import "NSObject+AKAConcurrencyTools.h"
 #import "AKALog.h"
+#import "AKABindingInstrumentation_Internal.h"
+#import "AKAMainThreadWatchdog.h"
 
 #pragma mark - AKABinding Private Interface
 #pragma mark -
 
 @interface AKABinding () {
     id                              _syntheticTargetValue;
+#if AKA_BINDING_INSTRUMENTATION
+    AKABindingStatistics*           _statistics;
+#endif
 }
 
 @end
@@ -167,10 +173,17 @@
 
         _bindingContext = bindingContext;
 
+        _bindingExpression = bindingExpression;
+
         _owner = owner;
 
         _delegate = delegate;
 
+#if AKA_BINDING_INSTRUMENTATION
+        _statistics = [AKABindingInstrumentation statisticsForBindingType:self.class
+                                                           expressionText:bindingExpression.text];
+#endif
+
         __weak AKABinding *weakSelf = self;
         req_AKAPropertyChangeObserver changeObserver = ^(opt_id oldValue, opt_id newValue) {
             [weakSelf processSourceValueChangeFromOldValue:oldValue
@@ -322,14 +335,21 @@
 {
     [self aka_performBlockInMainThreadOrQueue:
      ^{
+         uint64_t watchdogStart = AKAMainThreadWatchdogBeginSpan();
+         AKA_BINDING_INSTRUMENT_START(updateStart);
+
          id targetValue = nil;
          NSError* error;
 
          id oldTargetValue = self.targetValueProperty.value;
-         
-         if ([self convertSourceValue:self.sourceValueProperty.value //newSourceValue (if change is triggered in another thread and source value changed meanwhile)
-                        toTargetValue:&targetValue
-                                error:&error])
+
+         AKA_BINDING_INSTRUMENT_START(conversionStart);
+         BOOL converted = [self convertSourceValue:self.sourceValueProperty.value //newSourceValue (if change is triggered in another thread and source value changed meanwhile)
+                                     toTargetValue:&targetValue
+                                             error:&error];
+         AKA_BINDING_INSTRUMENT_TIME(self, AKABindingInstrumentationEventConversion, conversionStart);
+
+         if (converted)
          {
              if ([self validateTargetValue:&targetValue
                                      error:&error])
@@ -366,6 +386,7 @@
              }
              else
              {
+                 AKA_BINDING_INSTRUMENT_COUNT(self, AKABindingInstrumentationEventValidationFailure);
                  [self targetUpdateFailedToValidateTargetValue:targetValue
                                       convertedFromSourceValue:newSourceValue
                                                      withError:error];
@@ -376,6 +397,9 @@
              [self targetUpdateFailedToConvertSourceValue:newSourceValue
                                    toTargetValueWithError:error];
          }
+
+         AKA_BINDING_INSTRUMENT_TIME(self, AKABindingInstrumentationEventTargetUpdate, updateStart);
+         AKAMainThreadWatchdogEndSpan(watchdogStart, __PRETTY_FUNCTION__, self);
      }
                             waitForCompletion:NO];
 }
@@ -508,6 +532,8 @@
     NSError* error;
     id sourceValue = newSourceValue;
 
+    AKA_BINDING_INSTRUMENT_COUNT(self, AKABindingInstrumentationEventSourceChange);
+
     if ([self validateSourceValue:&sourceValue error:&error])
     {
         [self sourceValueDidChangeFromOldValue:oldSourceValue to:newSourceValue];
@@ -522,6 +548,7 @@
     }
     else
     {
+        AKA_BINDING_INSTRUMENT_COUNT(self, AKABindingInstrumentationEventValidationFailure);
         [self sourceValueDidChangeFromOldValue:oldSourceValue
                                 toInvalidValue:newSourceValue
                                      withError:error];
@@ -588,10 +615,21 @@
 
 + (opt_AKABindingAttributeSpecification)specificationForAttributeNamed:(NSString*)attributeName
 {
-    AKABindingSpecification* specification = [self specification];
+    return [[AKABindingAttributeTable tableForBindingType:self] entryForAttributeNamed:attributeName].specification;
+}
+
+@end
+
 
-    return specification.bindingSourceSpecification.attributes[attributeName];
+#if AKA_BINDING_INSTRUMENTATION
+
+@implementation AKABinding (Instrumentation)
+
+- (opt_AKABindingStatistics)statistics
+{
+    return _statistics;
 }
 
 @end
 
+#endif
@@ -0,0 +1,80 @@
+//
+//  AKABindingAttributeTable.h
+//  AKABeacon
+//
+//  Created by Michael Utech on 19.10.16.
+//  Copyright © 2016 Michael Utech & AKA Sarl. All rights reserved.
+//
+
+@import Foundation;
+
+#import "AKANullability.h"
+#import "AKABindingSpecification.h"
+
+@class AKABinding;
+
+@class AKABindingAttributeTable;
+#define req_AKABindingAttributeTable AKABindingAttributeTable*_Nonnull
+
+@class AKABindingAttributeTableEntry;
+#define opt_AKABindingAttributeTableEntry AKABindingAttributeTableEntry*_Nullable
+
+
+#pragma mark - AKABindingAttributeTableEntry - Interface
+#pragma mark -
+
+/**
+ Resolved specification of a binding attribute.
+ */
+@interface AKABindingAttributeTableEntry: NSObject
+
+@property(nonatomic, readonly, nonnull) NSString*                               attributeName;
+
+@property(nonatomic, readonly, nonnull) AKABindingAttributeSpecification*       specification;
+
+@property(nonatomic, readonly) AKABindingAttributeUse                           attributeUse;
+
+/**
+ The binding property name specified for the attribute or the attribute name if none is specified.
+ */
+@property(nonatomic, readonly, nonnull) NSString*                               bindingPropertyName;
+
+/**
+ The binding type specified for the attribute or, for attributes which are bound to a binding or target property, AKAPropertyBinding if none is specified.
+ */
+@property(nonatomic, readonly, nullable) Class                                  bindingType;
+
+@end
+
+
+#pragma mark - AKABindingAttributeTable - Interface
+#pragma mark -
+
+/**
+ Flattened view of the attribute specifications of a binding type, built once per binding type from its specification and used to initialize binding attributes without walking the specification for each binding.
+
+ In addition to the attribute specifications, the table resolves the setters of binding properties (for object typed, writable properties declared by the binding type), which are then used instead of key value coding to assign attribute values to binding properties.
+ */
+@interface AKABindingAttributeTable: NSObject
+
+/**
+ Returns the attribute table of the specified binding type, creating it if needed. This is thread safe.
+ */
++ (req_AKABindingAttributeTable)                   tableForBindingType:(req_Class)bindingType;
+
+@property(nonatomic, readonly, nonnull) Class                                   bindingType;
+
+- (opt_AKABindingAttributeTableEntry)           entryForAttributeNamed:(req_NSString)attributeName;
+
+/**
+ Assigns the value to the specified property of the binding, using the resolved setter if available and key value coding otherwise.
+
+ @param value the value
+ @param bindingProperty the name (or key path) of the binding property
+ @param binding an instance of the table's binding type
+ */
+- (void)                                                   assignValue:(opt_id)value
+                                                     toBindingProperty:(req_NSString)bindingProperty
+                                                             ofBinding:(AKABinding*_Nonnull)binding;
+
+@end
@@ -0,0 +1,219 @@
+//
+//  AKABindingAttributeTable.m
+//  AKABeacon
+//
+//  Created by Michael Utech on 19.10.16.
+//  Copyright © 2016 Michael Utech & AKA Sarl. All rights reserved.
+//
+
+#include <objc/runtime.h>
+#include <objc/message.h>
+
+#import "AKABindingAttributeTable.h"
+#import "AKABinding.h"
+#import "AKAPropertyBinding.h"
+
+
+#pragma mark - Static Helpers
+#pragma mark -
+
+/**
+ Returns the setter of the object typed, writable property with the specified name or NULL if the binding type does not declare such a property.
+ */
+static SEL akaBindingPropertySetter(Class bindingType, NSString* propertyName)
+{
+    SEL result = NULL;
+    objc_property_t property = class_getProperty(bindingType, propertyName.UTF8String);
+
+    if (property != NULL)
+    {
+        char* typeEncoding = property_copyAttributeValue(property, "T");
+        char* readonly = property_copyAttributeValue(property, "R");
+        char* customSetter = property_copyAttributeValue(property, "S");
+
+        if (typeEncoding != NULL && typeEncoding[0] == '@' && readonly == NULL)
+        {
+            if (customSetter != NULL)
+            {
+                result = sel_registerName(customSetter);
+            }
+            else
+            {
+                NSString* setterName = [NSString stringWithFormat:@"set%@%@:",
+                                        [propertyName substringToIndex:1].uppercaseString,
+                                        [propertyName substringFromIndex:1]];
+                result = NSSelectorFromString(setterName);
+            }
+
+            if (![bindingType instancesRespondToSelector:result])
+            {
+                result = NULL;
+            }
+        }
+
+        free(typeEncoding);
+        free(readonly);
+        free(customSetter);
+    }
+
+    return result;
+}
+
+
+#pragma mark - AKABindingAttributeTableEntry - Implementation
+#pragma mark -
+
+@implementation AKABindingAttributeTableEntry
+
+- (instancetype)initWithAttributeName:(NSString*)attributeName
+                        specification:(AKABindingAttributeSpecification*)specification
+{
+    if (self = [super init])
+    {
+        _attributeName = [attributeName copy];
+        _specification = specification;
+        _attributeUse = specification.attributeUse;
+        _bindingPropertyName = specification.bindingPropertyName ?: _attributeName;
+        _bindingType = specification.bindingType;
+
+        if (_bindingType == nil &&
+            (_attributeUse == AKABindingAttributeUseBindToBindingProperty ||
+             _attributeUse == AKABindingAttributeUseBindToTargetProperty))
+        {
+            _bindingType = [AKAPropertyBinding class];
+        }
+    }
+    return self;
+}
+
+@end
+
+
+#pragma mark - AKABindingAttributeTable - Private Interface
+#pragma mark -
+
+@interface AKABindingAttributeTable()
+
+@property(nonatomic, readonly) NSDictionary<NSString*, AKABindingAttributeTableEntry*>* entriesByAttributeName;
+
+/**
+ Setters (NSValue wrapping SEL) by binding property name. NSNull marks binding properties which have to be assigned using key value coding.
+ */
+@property(nonatomic, readonly) NSDictionary<NSString*, id>*                             settersByBindingProperty;
+
+@end
+
+
+#pragma mark - AKABindingAttributeTable - Implementation
+#pragma mark -
+
+@implementation AKABindingAttributeTable
+
+#pragma mark - Initialization
+
++ (req_AKABindingAttributeTable)tableForBindingType:(req_Class)bindingType
+{
+    static NSLock* lock;
+    static NSMapTable<Class, AKABindingAttributeTable*>* tables;
+    static dispatch_once_t onceToken;
+
+    dispatch_once(&onceToken, ^{
+        lock = [NSLock new];
+        tables = [[NSMapTable alloc] initWithKeyOptions:(NSPointerFunctionsOpaqueMemory |
+                                                         NSPointerFunctionsOpaquePersonality)
+                                           valueOptions:NSPointerFunctionsStrongMemory
+                                               capacity:64];
+    });
+
+    [lock lock];
+    AKABindingAttributeTable* result = [tables objectForKey:bindingType];
+    [lock unlock];
+
+    if (result == nil)
+    {
+        // Built outside of the lock, because building the table may trigger the creation of
+        // specifications (and tables) of other binding types.
+        result = [[AKABindingAttributeTable alloc] initWithBindingType:bindingType];
+
+        [lock lock];
+        AKABindingAttributeTable* existing = [tables objectForKey:bindingType];
+        if (existing != nil)
+        {
+            result = existing;
+        }
+        else
+        {
+            [tables setObject:result forKey:bindingType];
+        }
+        [lock unlock];
+    }
+
+    return result;
+}
+
+- (instancetype)initWithBindingType:(Class)bindingType
+{
+    if (self = [super init])
+    {
+        _bindingType = bindingType;
+
+        NSMutableDictionary<NSString*, AKABindingAttributeTableEntry*>* entries = [NSMutableDictionary new];
+        NSMutableDictionary<NSString*, id>* setters = [NSMutableDictionary new];
+
+        AKABindingSpecification* specification = [bindingType specification];
+        [specification.bindingSourceSpecification.attributes enumerateKeysAndObjectsUsingBlock:
+         ^(req_NSString attributeName, req_AKABindingAttributeSpecification attributeSpecification, outreq_BOOL stop)
+         {
+             (void)stop;
+
+             AKABindingAttributeTableEntry* entry =
+                [[AKABindingAttributeTableEntry alloc] initWithAttributeName:attributeName
+                                                               specification:attributeSpecification];
+             entries[attributeName] = entry;
+
+             NSString* bindingProperty = entry.bindingPropertyName;
+             if (setters[bindingProperty] == nil)
+             {
+                 SEL setter = akaBindingPropertySetter(bindingType, bindingProperty);
+                 setters[bindingProperty] = (setter != NULL
+                                             ? [NSValue valueWithPointer:setter]
+                                             : [NSNull null]);
+             }
+         }];
+
+        _entriesByAttributeName = [entries copy];
+        _settersByBindingProperty = [setters copy];
+    }
+    return self;
+}
+
+#pragma mark - Attributes
+
+- (opt_AKABindingAttributeTableEntry)entryForAttributeNamed:(req_NSString)attributeName
+{
+    return self.entriesByAttributeName[attributeName];
+}
+
+#pragma mark - Binding Properties
+
+- (void)                assignValue:(opt_id)value
+                  toBindingProperty:(req_NSString)bindingProperty
+                          ofBinding:(AKABinding*)binding
+{
+    NSParameterAssert([binding isKindOfClass:self.bindingType]);
+
+    id setter = self.settersByBindingProperty[bindingProperty];
+
+    if ([setter isKindOfClass:[NSValue class]])
+    {
+        // Messaging (instead of calling a cached IMP) preserves KVO notifications of observed bindings
+        SEL selector = [setter pointerValue];
+        ((void (*)(id, SEL, id))objc_msgSend)(binding, selector, value);
+    }
+    else
+    {
+        [binding setValue:value forKeyPath:bindingProperty];
+    }
+}
+
+@end
@@ -11,6 +11,7 @@
 #import "AKABindingBehavior.h"
 #import "AKADelegateDispatcher.h"
 #import "AKAContentSizeCategoryChangeListener.h"
+#import "AKAFontCache.h"
 #import "AKAViewSizeTransitionListener.h"
 
 #pragma mark - AKABindingBehaviourDelegateDispatcher
@@ -384,8 +385,11 @@ viewSizeTransitionListeners;
 
 #pragma mark - Content Size Category Notifications
 
-- (void)                      contentSizeCategoryDidChange:(NSNotification*__unused)notification
+- (void)                      contentSizeCategoryDidChange:(NSNotification*)notification
 {
+    // Make sure fonts are resolved for the new content size category when listeners update their fonts:
+    [[AKAFontCache sharedCache] updateForContentSizeCategory:notification.userInfo[UIContentSizeCategoryNewValueKey]];
+
     for (id<AKAContentSizeCategoryChangeListener> listener in self.contentSizeCategoryChangeListeners)
     {
         [listener contentSizeCategoryChanged];
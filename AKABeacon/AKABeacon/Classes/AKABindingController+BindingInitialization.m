@@ -17,6 +17,7 @@
 
 #import "AKABindingTargetContainerProtocol.h"
 #import "AKABindingExpression+Accessors.h"
+#import "AKABindingPlan.h"
 
 #import "AKABeaconErrors.h"
 #import "UIView+AKAHierarchyVisitor.m"
@@ -33,9 +34,37 @@
 {
     [self willUpdateBindings];
 
-    BOOL result = [self _addBindingsForTargetObjectHierarchy:rootTarget
-                                        excludeTargetObjects:excludedTargets
-                                                       error:error];
+    BOOL result = YES;
+
+    // Binding plans record the locations of bound targets in hierarchies instantiated from the same
+    // prototype (f.e. table view cells) and resolve them without traversing the hierarchy. Plans yield
+    // no targets for hierarchies which do not match their structural fingerprint, these are then
+    // scanned. Plans do not know about excluded targets, these hierarchies are always scanned.
+    NSArray* plannedTargets = nil;
+    if (excludedTargets.count == 0)
+    {
+        plannedTargets = [[AKABindingPlan planForTargetObjectHierarchy:rootTarget]
+                          bindingTargetsInTargetObjectHierarchy:rootTarget];
+    }
+
+    if (plannedTargets)
+    {
+        for (id target in plannedTargets)
+        {
+            result = [self addBindingsForTarget:target error:error];
+            if (!result)
+            {
+                break;
+            }
+        }
+    }
+    else
+    {
+        result = [self _addBindingsForTargetObjectHierarchy:rootTarget
+                                       excludeTargetObjects:excludedTargets
+                                                      error:error];
+    }
+
     [self didUpdateBindings];
 
     return result;
@@ -239,9 +268,7 @@
 {
     if ([binding conformsToProtocol:@protocol(AKAKeyboardActivationSequenceItemProtocol)])
     {
-       NSString* kasID = ((id<AKAKeyboardActivationSequenceItemProtocol>)binding).keyboardActivationSequenceID;
-       [self setKeyboardActivationSequenceWithIdentifierNeedsUpdate:kasID];
-//        [self.keyboardActivationSequence setNeedsUpdate];
+       [self addItemToKeyboardActivationSequence:(id<AKAKeyboardActivationSequenceItemProtocol>)binding];
     }
 
     id<AKABindingControllerDelegate> delegate = self.delegate;
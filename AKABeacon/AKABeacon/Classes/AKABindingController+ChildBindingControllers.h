@@ -43,7 +43,7 @@ In such cases, the binding controller will record pairs of removal and creation
 
  The primary use case for child binding contexts with key path data context references is to change the data context for bindings or to group bindings and child binding controllers to be able to manage them as unit.
 
- @note Key path data context binding controllers do not currently support reuse (they will for the time being always create a new binding controller discarding recycled controllers.
+ @note Recycled key path data context binding controllers are only reused for the same key path, otherwise they are discarded and a new binding controller is created.
 
  @note Assumption: Changing the data context of a child binding controller (and thus the binding context of all related bindings) is sufficient to update the target object hierarchy correctly. If client code has to perform other manual initialization, it has to ensure that this is done indepently.
 
@@ -92,12 +92,27 @@ In such cases, the binding controller will record pairs of removal and creation
                                                             withDataContext:(opt_id)dataContext
                                                                       error:(out_NSError)error;
 
+/**
+ Returns the active child binding controller managing the specified targetObjectHierarchy if it uses the specified data context.
+
+ @param targetObjectHierarchy  the root view (or target object) of the view hierarchy
+ @param dataContext            the data context for bindings in the object hierarchy
+ @param createOrReuseIfMissing if YES and there is no matching active child controller, createOrReuseBindingControllerForTargetObjectHierarchy:withDataContext:error: is used to provide one.
+ @param error                  error details
+
+ @return a matching binding controller or nil if there is none (and none could be created) or if an error occurred.
+ */
+- (__kindof opt_AKABindingController)     bindingControllerForTargetObjectHierarchy:(req_id)targetObjectHierarchy
+                                                            withDataContext:(opt_id)dataContext
+                                                     createOrReuseIfMissing:(BOOL)createOrReuseIfMissing
+                                                                      error:(out_NSError)error;
+
 /**
  Removes (or recycles) a child binding controller with matching targetObjectHierarchy and dataContext.
 
  All bindings managed by the removed child binding controller will stop observing changes.
 
- If enqueForReuse is YES, the binding controller will attempt to preserve the removed child controller and its bindings to be able to reuse it for the same targetObjectHierarchy later on (this is only useful if targetObjectHierarchies are reused (such as UITableViewCell instances might be, if they have a defined reuse identifier and the table view data source supporting reuse).
+ If enqueForReuse is YES, the binding controller will attempt to preserve the removed child controller and its bindings to be able to reuse it for the same targetObjectHierarchy later on (this is only useful if targetObjectHierarchies are reused (such as UITableViewCell instances might be, if they have a defined reuse identifier and the table view data source supporting reuse). Reused controllers keep their bindings, only their data context is replaced and target values are updated when they start observing changes again.
 
  @note Even though the targetObjectHierarchy is a unique key for child controllers, a matching child controller is not removed if the data context does not also match. This is because the order in which delegate methods such as tableview:willDisplayCellForRowAtIndexPath: and tableview:didEndDisplayCellForRowAtIndexPath: is not always as expected (willDisplay for a new data context might preceed didEndDisplay for an old data context for one given cell).
 
@@ -74,111 +74,120 @@ static const char kTargetObjectHierarchyBindingControllerToken = 0;
                                                    withDataContextAtKeyPath:(opt_NSString)keyPath
                                                                       error:(out_NSError)error
 {
-    if (![self discardRecycledBindingControllerForTargetObjectHierarchy:targetObjectHierarchy])
+    AKABindingController* result = [self reuseBindingControllerForTargetObjectHierarchy:targetObjectHierarchy];
+
+    // Dependent controllers cannot change their data context property, recycled controllers can only
+    // be reused for the same key path.
+    if (result)
     {
-        // TODO: error handling: throw but create exception in AKABeaconErrors
-        @throw [NSException exceptionWithName:NSInternalInconsistencyException
-                                       reason:@"Attempt to manage a binding target object which is used by a different binding controller."
-                                     userInfo:nil];
+        NSString* recycledKeyPath = nil;
+        BOOL reusable = [result isKindOfClass:[AKADependentBindingController class]];
+        if (reusable)
+        {
+            recycledKeyPath = ((AKADependentBindingController*)result).dataContextKeyPath;
+            reusable = recycledKeyPath == keyPath || [recycledKeyPath isEqualToString:(req_NSString)keyPath];
+        }
+
+        if (!reusable)
+        {
+            [self discardReusedBindingController:result
+                        forTargetObjectHierarchy:targetObjectHierarchy];
+            result = nil;
+        }
+    }
+
+    BOOL isNew = result == nil;
+    if (isNew)
+    {
+        result = [[AKADependentBindingController alloc] initWithParent:self
+                                                 targetObjectHierarchy:targetObjectHierarchy
+                                                  dataContextAtKeyPath:keyPath
+                                                              delegate:nil
+                                                                 error:error];
     }
-    AKADependentBindingController* result =
-        [[AKADependentBindingController alloc] initWithParent:self
-                                        targetObjectHierarchy:targetObjectHierarchy
-                                         dataContextAtKeyPath:keyPath
-                                                     delegate:nil
-                                                        error:error];
 
     if (result != nil)
     {
-        objc_setAssociatedObject(targetObjectHierarchy,
-                                 &kTargetObjectHierarchyBindingControllerToken,
-                                 result,
-                                 OBJC_ASSOCIATION_RETAIN);
+        [self registerChildBindingController:result
+                    forTargetObjectHierarchy:targetObjectHierarchy
+                                       isNew:isNew];
     }
 
     if (self.isObservingChanges && !result.isObservingChanges)
     {
+        // Starting to observe changes updates target values of reused bindings
         [result startObservingChanges];
     }
     
     return result;
-
 }
 
-- (instancetype)bindingControllerForTargetObjectHierarchy:(id)targetObjectHierarchy
-                                          withDataContext:(id)dataContext
-                                   createOrReuseIfMissing:(BOOL)createOrReuseIfMissing
-                                                    error:(out_NSError)error
+- (opt_AKABindingController)bindingControllerForTargetObjectHierarchy:(req_id)targetObjectHierarchy
+                                                      withDataContext:(opt_id)dataContext
+                                               createOrReuseIfMissing:(BOOL)createOrReuseIfMissing
+                                                                error:(out_NSError)error
 {
-    // TODO: implement
-    return nil;
+    AKABindingController* result = objc_getAssociatedObject(targetObjectHierarchy,
+                                                            &kTargetObjectHierarchyBindingControllerToken);
+
+    // Only active child controllers of this controller for the specified data context qualify
+    if (result != nil &&
+        (result.parent != self ||
+         ![self.childBindingControllers containsObject:result] ||
+         result.dataContext != dataContext))
+    {
+        result = nil;
+    }
+
+    if (result == nil && createOrReuseIfMissing)
+    {
+        result = [self createOrReuseBindingControllerForTargetObjectHierarchy:targetObjectHierarchy
+                                                              withDataContext:dataContext
+                                                                        error:error];
+    }
+
+    return result;
 }
 
 - (AKABindingController*)createOrReuseBindingControllerForTargetObjectHierarchy:(id)targetObjectHierarchy
                                                                 withDataContext:(id)dataContext
                                                                           error:(out_NSError)error
 {
-    NSHashTable<AKABindingController*>* children = [self childBindingControllersCreateIfNeeded:YES];
-
     AKABindingController* result = [self reuseBindingControllerForTargetObjectHierarchy:targetObjectHierarchy];
 
     // A dependent binding controller does not support updating the data context and thus
-    // cannot be reused here. We will attempt to discard it:
+    // cannot be reused here.
     if (result && ![result isKindOfClass:[AKAIndependentBindingController class]])
     {
-        if ([self discardRecycledBindingController:result
-                          forTargetObjectHierarchy:targetObjectHierarchy])
-        {
-            // Done, we'll create a new dependent controller
-            result = nil;
-        }
-        else
-        {
-            // TODO: error handling: throw but create exception in AKABeaconErrors
-            @throw [NSException exceptionWithName:NSInternalInconsistencyException
-                                           reason:@"Attempt to manage a binding target object which is used by a different binding controller."
-                                         userInfo:nil];
-        }
+        [self discardReusedBindingController:result
+                    forTargetObjectHierarchy:targetObjectHierarchy];
+        result = nil;
     }
 
-    BOOL active = result != nil && [children containsObject:result];
-    id previousDataContext = result.dataContext;
-    BOOL unchanged = result != nil && previousDataContext == dataContext;
-    BOOL isNew = NO;
-
-    if (result == nil)
+    BOOL isNew = result == nil;
+    if (isNew)
     {
         result = [[AKAIndependentBindingController alloc] initWithParent:self
                                                    targetObjectHierarchy:targetObjectHierarchy
                                                              dataContext:dataContext
                                                                 delegate:nil
                                                                    error:error];
-        if (result != nil)
-        {
-            isNew = YES;
-            objc_setAssociatedObject(targetObjectHierarchy,
-                                     &kTargetObjectHierarchyBindingControllerToken,
-                                     result,
-                                     OBJC_ASSOCIATION_RETAIN);
-            unchanged = YES;
-        }
-    }
-
-    if (!active)
-    {
-        [children addObject:result];
     }
 
-
-    if (!isNew)
+    if (result != nil)
     {
-        [self.updatedChildBindingControllers addObject:result];
-    }
+        [self registerChildBindingController:result
+                    forTargetObjectHierarchy:targetObjectHierarchy
+                                       isNew:isNew];
 
-    if (!unchanged)
-    {
-        NSAssert([result isKindOfClass:[AKAIndependentBindingController class]], @"Expected an independent binding controller here");
-        ((AKAIndependentBindingController*)result).dataContext = dataContext;
+        if (!isNew && result.dataContext != dataContext)
+        {
+            // Bindings are preserved, they only see a new data context. If the controller is not
+            // observing changes (recycled controllers are stopped), target values are updated
+            // when it starts observing changes below.
+            NSAssert([result isKindOfClass:[AKAIndependentBindingController class]], @"Expected an independent binding controller here");
+            ((AKAIndependentBindingController*)result).dataContext = dataContext;
+        }
     }
 
     if (self.isObservingChanges && !result.isObservingChanges)
@@ -276,6 +285,54 @@ static const char kTargetObjectHierarchyBindingControllerToken = 0;
 
 #pragma mark - Implementation
 
+/**
+ Associates a new or reused child controller with its target object hierarchy, adds it to the active child controllers (if needed) and updates statistics.
+ */
+- (void)        registerChildBindingController:(req_AKABindingController)controller
+                      forTargetObjectHierarchy:(req_id)targetObjectHierarchy
+                                         isNew:(BOOL)isNew
+{
+    NSHashTable<AKABindingController*>* children = [self childBindingControllersCreateIfNeeded:YES];
+
+    if (isNew)
+    {
+        objc_setAssociatedObject(targetObjectHierarchy,
+                                 &kTargetObjectHierarchyBindingControllerToken,
+                                 controller,
+                                 OBJC_ASSOCIATION_RETAIN);
+        [children addObject:controller];
+        ++self.childBindingControllerCreationCount;
+    }
+    else
+    {
+        if (![children containsObject:controller])
+        {
+            [children addObject:controller];
+            ++self.childBindingControllerReuseCount;
+        }
+        [self.updatedChildBindingControllers addObject:controller];
+    }
+}
+
+- (void)        discardReusedBindingController:(req_AKABindingController)controller
+                      forTargetObjectHierarchy:(req_id)targetObjectHierarchy
+{
+    if ([self.childBindingControllers containsObject:controller])
+    {
+        [controller stopObservingChanges];
+        [self.childBindingControllers removeObject:controller];
+    }
+
+    if (![self discardRecycledBindingController:controller
+                       forTargetObjectHierarchy:targetObjectHierarchy])
+    {
+        // TODO: error handling: throw but create exception in AKABeaconErrors
+        @throw [NSException exceptionWithName:NSInternalInconsistencyException
+                                       reason:@"Attempt to manage a binding target object which is used by a different binding controller."
+                                     userInfo:nil];
+    }
+}
+
 - (AKABindingController*)reuseBindingControllerForTargetObjectHierarchy:(id)targetObjectHierarchy
 {
     AKABindingController* result = objc_getAssociatedObject(targetObjectHierarchy,
@@ -20,6 +20,11 @@
 
 - (void)initializeKeyboardActivationSequence;
 - (void) setKeyboardActivationSequenceWithIdentifierNeedsUpdate:(NSString*)identifier;
+
+/**
+ Inserts the specified item into the keyboard activation sequence it belongs to, without rebuilding the sequence.
+ */
+- (void) addItemToKeyboardActivationSequence:(req_AKAKeyboardActivationSequenceItem)item;
 - (void) updateKeyboardActivationSequencesIfNeeded;
 
 @end
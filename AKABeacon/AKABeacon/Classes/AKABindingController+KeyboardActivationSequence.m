@@ -9,6 +9,31 @@
 #import "AKABindingController+KeyboardActivationSequence.h"
 #import "AKABindingController_KeyboardActivationSequenceProperties.h"
 
+#import <objc/runtime.h>
+
+
+#pragma mark - Item Ordinals
+#pragma mark -
+
+/**
+ Returns the ordinal of the specified keyboard activation sequence item, assigning the next ordinal if the item does not yet have one. Ordinals are assigned when bindings are added to binding controllers and break ties between items whose responders cannot be ordered by their positions.
+ */
+static NSUInteger akaKeyboardActivationSequenceItemOrdinal(req_AKAKeyboardActivationSequenceItem item)
+{
+    static char ordinalKey;
+    static NSUInteger nextOrdinal = 0;
+    NSCAssert([NSThread isMainThread], @"Invalid attempt to access keyboard activation sequence items outside of main thread");
+
+    NSNumber* result = objc_getAssociatedObject(item, &ordinalKey);
+    if (result == nil)
+    {
+        result = @(nextOrdinal++);
+        objc_setAssociatedObject(item, &ordinalKey, result, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+    }
+
+    return result.unsignedIntegerValue;
+}
+
 
 #pragma mark - AKABindingController(KeyboardActivationSequence) - Implementation
 #pragma mark -
@@ -71,12 +96,29 @@
 }
  */
 
-- (void)setKeyboardActivationSequenceWithIdentifierNeedsUpdate:(NSString*)identifier {
-   if (self.keyboardActivationSequenceStorage[identifier] == nil) {
-      AKAKeyboardActivationSequence* kas = [[AKAKeyboardActivationSequence alloc] initWithDelegate:self identifier:identifier];
-      self.keyboardActivationSequenceStorage[identifier] = kas;
+- (AKAKeyboardActivationSequence*) keyboardActivationSequenceStorageWithIdentifier:(NSString*)identifier {
+   AKAKeyboardActivationSequence* result = self.keyboardActivationSequenceStorage[identifier];
+   if (result == nil) {
+      result = [[AKAKeyboardActivationSequence alloc] initWithDelegate:self identifier:identifier];
+      self.keyboardActivationSequenceStorage[identifier] = result;
    }
-   [self.keyboardActivationSequenceStorage[identifier] setNeedsUpdate];
+   return result;
+}
+
+- (void)setKeyboardActivationSequenceWithIdentifierNeedsUpdate:(NSString*)identifier {
+   [[self keyboardActivationSequenceStorageWithIdentifier:identifier] setNeedsUpdate];
+}
+
+- (void) addItemToKeyboardActivationSequence:(req_AKAKeyboardActivationSequenceItem)item {
+   // Assign the ordinal first, it defines the position of the item among items which cannot be
+   // ordered by their positions
+   (void)akaKeyboardActivationSequenceItemOrdinal(item);
+
+   // Sequences which have not yet been built or are scheduled to be updated will pick up the item
+   // when they are (re)built, others insert it without rebuilding the sequence. Bindings are added
+   // before their views are laid out, sequences therefore defer ordering the item (which depends on
+   // the frames of responders) until they are accessed.
+   [[self keyboardActivationSequenceStorageWithIdentifier:item.keyboardActivationSequenceID] insertItem:item];
 }
 
 - (void) updateKeyboardActivationSequencesIfNeeded {
@@ -119,51 +161,7 @@
      ^NSComparisonResult(id<AKAKeyboardActivationSequenceItemProtocol> _Nonnull obj1,
                          id<AKAKeyboardActivationSequenceItemProtocol> _Nonnull obj2)
      {
-         NSComparisonResult result = NSOrderedSame;
-
-         UIResponder* ur1 = [obj1 responderForKeyboardActivationSequence];
-         UIResponder* ur2 = [obj2 responderForKeyboardActivationSequence];
-
-         if (![ur1 isKindOfClass:[UIView class]])
-         {
-             result = NSOrderedAscending;
-         }
-         else if (![ur2 isKindOfClass:[UIView class]])
-         {
-             result = NSOrderedDescending;
-         }
-         else
-         {
-             UIView* v1 = (id)ur1;
-             UIView* v2 = (id)ur2;
-
-             UIView* view = self.view;
-             CGRect r1 = [v1 convertRect:v1.frame toView:view];
-             CGRect r2 = [v2 convertRect:v2.frame toView:view];
-
-             if (r1.origin.y < r2.origin.y)
-             {
-                 result = NSOrderedAscending;
-             }
-             else if (r1.origin.y > r2.origin.y)
-             {
-                 result = NSOrderedDescending;
-             }
-
-             if (result == NSOrderedSame)
-             {
-                 if (r1.origin.x < r2.origin.x)
-                 {
-                     result = NSOrderedAscending;
-                 }
-                 else if (r1.origin.x > r2.origin.x)
-                 {
-                     result = NSOrderedDescending;
-                 }
-             }
-         }
-
-         return result;
+         return [self compareKeyboardActivationSequenceItem:obj1 toItem:obj2];
      }];
 
     for (NSUInteger i=0; i < items.count; ++i)
@@ -177,4 +175,74 @@
     }
 }
 
+- (NSComparisonResult)            keyboardActivationSequence:(AKAKeyboardActivationSequence*__unused)keyboardActivationSequence
+                                                   compareItem:(req_AKAKeyboardActivationSequenceItem)item
+                                                        toItem:(req_AKAKeyboardActivationSequenceItem)otherItem
+{
+    return [self compareKeyboardActivationSequenceItem:item toItem:otherItem];
+}
+
+/**
+ Orders items by the position of their responders (top to bottom, left to right), which requires responders to be laid out. Items whose responders are not views precede other items. Items which cannot be ordered by the positions of their responders are ordered by their ordinals (the order in which they have been added), this makes the order total.
+ */
+- (NSComparisonResult)     compareKeyboardActivationSequenceItem:(req_AKAKeyboardActivationSequenceItem)obj1
+                                                        toItem:(req_AKAKeyboardActivationSequenceItem)obj2
+{
+    NSComparisonResult result = NSOrderedSame;
+
+    UIResponder* ur1 = [obj1 responderForKeyboardActivationSequence];
+    UIResponder* ur2 = [obj2 responderForKeyboardActivationSequence];
+
+    BOOL isView1 = [ur1 isKindOfClass:[UIView class]];
+    BOOL isView2 = [ur2 isKindOfClass:[UIView class]];
+
+    if (!isView1 && isView2)
+    {
+        result = NSOrderedAscending;
+    }
+    else if (isView1 && !isView2)
+    {
+        result = NSOrderedDescending;
+    }
+    else if (isView1 && isView2)
+    {
+        UIView* v1 = (id)ur1;
+        UIView* v2 = (id)ur2;
+
+        UIView* view = self.view;
+        CGRect r1 = [v1 convertRect:v1.frame toView:view];
+        CGRect r2 = [v2 convertRect:v2.frame toView:view];
+
+        if (r1.origin.y < r2.origin.y)
+        {
+            result = NSOrderedAscending;
+        }
+        else if (r1.origin.y > r2.origin.y)
+        {
+            result = NSOrderedDescending;
+        }
+
+        if (result == NSOrderedSame)
+        {
+            if (r1.origin.x < r2.origin.x)
+            {
+                result = NSOrderedAscending;
+            }
+            else if (r1.origin.x > r2.origin.x)
+            {
+                result = NSOrderedDescending;
+            }
+        }
+    }
+
+    if (result == NSOrderedSame && obj1 != obj2)
+    {
+        NSUInteger ordinal1 = akaKeyboardActivationSequenceItemOrdinal(obj1);
+        NSUInteger ordinal2 = akaKeyboardActivationSequenceItemOrdinal(obj2);
+        result = ordinal1 < ordinal2 ? NSOrderedAscending : NSOrderedDescending;
+    }
+
+    return result;
+}
+
 @end
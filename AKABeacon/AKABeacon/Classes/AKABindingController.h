@@ -80,6 +80,18 @@
 
 - (void)stopObservingChanges;
 
+#pragma mark - Statistics
+
+/**
+ The number of child binding controllers created by this controller.
+ */
+@property(nonatomic, readonly) NSUInteger                                   childBindingControllerCreationCount;
+
+/**
+ The number of times a recycled child binding controller (and its bindings) has been reused for a target object hierarchy instead of creating a new controller.
+ */
+@property(nonatomic, readonly) NSUInteger                                   childBindingControllerReuseCount;
+
 @end
 
 
@@ -282,6 +282,7 @@
               targetObjectHierarchy:targetObjectHierarchy
                            delegate:delegate])
     {
+        _dataContextKeyPath = [keyPath copy];
         self.dataContextProperty = dataContextProperty;
 
        if (parent == nil)
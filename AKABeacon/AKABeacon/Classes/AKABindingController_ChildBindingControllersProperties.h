@@ -21,6 +21,10 @@
 
 @property(nonatomic) NSHashTable<AKABindingController*>*    recycledChildBindingControllers;
 
+@property(nonatomic) NSUInteger                             childBindingControllerCreationCount;
+
+@property(nonatomic) NSUInteger                             childBindingControllerReuseCount;
+
 
 @end
 
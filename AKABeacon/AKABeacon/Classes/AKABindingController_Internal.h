@@ -87,4 +87,11 @@
                                           delegate:(opt_AKABindingControllerDelegate)delegate
                                              error:(out_NSError)error;
 
+#pragma mark - Properties
+
+/**
+ The key path (relative to the parent's data context) identifying the data context of this controller. Recycled dependent controllers are only reused for the same key path.
+ */
+@property(nonatomic, readonly, nullable) NSString*  dataContextKeyPath;
+
 @end
\ No newline at end of file
@@ -21,5 +21,11 @@
                                              withBlock:(void (^_Nonnull)(SEL _Nonnull property,
                                                                          req_AKABindingExpression ex,
                                                                          outreq_BOOL stop))block;
+
+/**
+ Determines whether the specified target has any binding expressions. This is cheaper than enumerating the target's binding expressions and can be used to skip unbound targets.
+ */
++ (BOOL)                    hasBindingExpressionsForTarget:(id<NSObject>_Nonnull)target;
+
 @end
 
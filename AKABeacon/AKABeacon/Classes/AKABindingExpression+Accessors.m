@@ -6,37 +6,33 @@
 //  Copyright © 2016 Michael Utech & AKA Sarl. All rights reserved.
 //
 
-#import <objc/runtime.h>
-
 #import "AKABindingExpression+Accessors.h"
+#import "AKAAssociatedStorage.h"
 
 @implementation AKABindingExpression(Accessors)
 
 + (opt_AKABindingExpression)bindingExpressionForTarget:(id<NSObject>_Nonnull)target
                                               property:(req_SEL)selector
 {
-
-    NSString* key = NSStringFromSelector(selector);
-    return [self bindingExpressionsBySelectorNameForTarget:target
-                                           createIfMissing:NO][key];
+    return [[self bindingExpressionStorageForTarget:target
+                                    createIfMissing:NO] valueForStorageKey:selector];
 }
 
 + (void)                          setBindingExpression:(opt_AKABindingExpression)bindingExpression
                                              forTarget:(id<NSObject>_Nonnull)target
                                               property:(req_SEL)selector
 {
-    NSString* key = NSStringFromSelector(selector);
     if (bindingExpression == nil || bindingExpression == (id)[NSNull null])
     {
-        [[self bindingExpressionsBySelectorNameForTarget:target
-                                         createIfMissing:NO]removeObjectForKey:key];
+        [[self bindingExpressionStorageForTarget:target
+                                 createIfMissing:NO] removeValueForStorageKey:selector];
     }
     else
     {
-        [self bindingExpressionsBySelectorNameForTarget:target
-                                        createIfMissing:YES][key] = bindingExpression;
+        [[self bindingExpressionStorageForTarget:target
+                                 createIfMissing:YES] setValue:bindingExpression
+                                                 forStorageKey:selector];
     }
-
 }
 
 + (void)          enumerateBindingExpressionsForTarget:(id<NSObject>_Nonnull)target
@@ -44,54 +40,34 @@
                                                                          req_AKABindingExpression ex,
                                                                          outreq_BOOL stop))block
 {
-    [[self bindingExpressionsBySelectorNameForTarget:target
-                                     createIfMissing:NO] enumerateKeysAndObjectsUsingBlock:
-     ^(req_NSString             propertyName,
-       req_AKABindingExpression bindingExpression,
-       BOOL * _Nonnull          stop)
+    [[self bindingExpressionStorageForTarget:target
+                             createIfMissing:NO] enumerateValuesUsingBlock:
+     ^(const void * _Nonnull key, req_AKABindingExpression bindingExpression, outreq_BOOL stop)
      {
-         SEL property = NSSelectorFromString(propertyName);
-         block(property, bindingExpression, stop);
+         block((SEL)key, bindingExpression, stop);
      }];
 }
 
-#pragma mark - Implementation
-
-+ (NSMutableDictionary<NSString*, AKABindingExpression*>*)
-  bindingExpressionsBySelectorNameForTarget:(id<NSObject>)target
-                            createIfMissing:(BOOL)createMissing
++ (BOOL)                    hasBindingExpressionsForTarget:(id<NSObject>_Nonnull)target
 {
-    SEL key = @selector(bindingExpressionsBySelectorNameForTarget:createIfMissing:);
-    NSAssert([NSThread isMainThread], @"Invalid attempt to access associated value bindingExpressionsBySelectorNameForTarget:createIfMissing: outside of main thread");
+    return [self bindingExpressionStorageForTarget:target
+                                   createIfMissing:NO].count > 0;
+}
 
-    NSMutableDictionary* result = nil;
-    id raw = objc_getAssociatedObject(target, key);
+#pragma mark - Implementation
 
-    if ([raw isKindOfClass:[NSMutableDictionary class]])
-    {
-        result = raw;
-    }
-    else if (raw == nil)
-    {
-        if (createMissing)
-        {
-            result = [NSMutableDictionary new];
-            objc_setAssociatedObject(target,
-                                     key,
-                                     result,
-                                     OBJC_ASSOCIATION_RETAIN_NONATOMIC);
-        }
-    }
-    else
-    {
-        NSString* message = [NSString stringWithFormat:@"Invalid type %@ for value %@ associated with %@", [result class], result, NSStringFromSelector(key)];
-        @throw [NSException exceptionWithName:@"InvalidOperation"
-                                       reason:message
-                                     userInfo:nil];
-    }
+/**
+ Binding expressions are stored in an associated storage keyed by the selectors of the binding properties.
+ */
++ (opt_AKAAssociatedStorage)bindingExpressionStorageForTarget:(id<NSObject>)target
+                                              createIfMissing:(BOOL)createMissing
+{
+    static char associationKey;
+    NSAssert([NSThread isMainThread], @"Invalid attempt to access binding expressions associated with %@ outside of main thread", target);
 
-    return result;
+    return [AKAAssociatedStorage storageForObject:target
+                                   associationKey:&associationKey
+                                  createIfMissing:createMissing];
 }
 
 @end
-
@@ -0,0 +1,78 @@
+//
+//  AKABindingInitializationPlan.h
+//  AKABeacon
+//
+//  Created by Michael Utech on 19.10.16.
+//  Copyright © 2016 Michael Utech & AKA Sarl. All rights reserved.
+//
+
+@import Foundation;
+
+#import "AKANullability.h"
+#import "AKABindingAttributeTable.h"
+
+@class AKABindingExpression;
+
+@class AKABindingInitializationPlan;
+#define req_AKABindingInitializationPlan AKABindingInitializationPlan*_Nonnull
+
+typedef NS_ENUM(NSUInteger, AKABindingInitializationStepKind)
+{
+    /// The attribute is initialized by the AKABinding+SubclassInitialization method corresponding to its attribute use.
+    AKABindingInitializationStepKindAttribute,
+
+    /// The (constant) value of the step is assigned to the binding property of the attribute.
+    AKABindingInitializationStepKindAssignValue,
+
+    /// The attribute is not specified and initialized by initializeUnspecifiedAttribute:attributeExpression:error:.
+    AKABindingInitializationStepKindUnspecifiedAttribute
+};
+
+
+#pragma mark - AKABindingInitializationStep - Interface
+#pragma mark -
+
+@interface AKABindingInitializationStep: NSObject
+
+@property(nonatomic, readonly) AKABindingInitializationStepKind                 kind;
+
+@property(nonatomic, readonly, nonnull) NSString*                               attributeName;
+
+@property(nonatomic, readonly, nonnull) AKABindingExpression*                   attributeExpression;
+
+/**
+ The resolved attribute specification, nil for unspecified attributes.
+ */
+@property(nonatomic, readonly, nullable) AKABindingAttributeTableEntry*         entry;
+
+/**
+ The value assigned by AKABindingInitializationStepKindAssignValue steps.
+ */
+@property(nonatomic, readonly, nullable) id                                     value;
+
+@end
+
+
+#pragma mark - AKABindingInitializationPlan - Interface
+#pragma mark -
+
+/**
+ The attribute initialization of a binding expression for a binding type, compiled once and replayed for each binding created for the expression.
+
+ Compiling a plan resolves the attribute specifications and evaluates constant attribute values which are assigned to binding properties. Such assignments are performed directly by the plan unless the binding type overrides the corresponding AKABinding+SubclassInitialization method; all other attributes are still initialized by these methods, which create sub bindings for each binding instance.
+ */
+@interface AKABindingInitializationPlan: NSObject
+
+/**
+ Returns the plan for the specified expression and binding type, compiling it if needed. Plans are cached as long as the expression exists. This is thread safe.
+ */
++ (req_AKABindingInitializationPlan)            planForExpression:(AKABindingExpression*_Nonnull)bindingExpression
+                                                      bindingType:(req_Class)bindingType;
+
+@property(nonatomic, readonly, nonnull) Class                                   bindingType;
+
+@property(nonatomic, readonly, nonnull) AKABindingAttributeTable*               attributeTable;
+
+@property(nonatomic, readonly, nonnull) NSArray<AKABindingInitializationStep*>* steps;
+
+@end
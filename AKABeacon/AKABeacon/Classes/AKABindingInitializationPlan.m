@@ -0,0 +1,150 @@
+//
+//  AKABindingInitializationPlan.m
+//  AKABeacon
+//
+//  Created by Michael Utech on 19.10.16.
+//  Copyright © 2016 Michael Utech & AKA Sarl. All rights reserved.
+//
+
+#import "AKABindingInitializationPlan.h"
+#import "AKABinding+SubclassInitialization.h"
+#import "AKABindingExpression.h"
+
+
+#pragma mark - Static Helpers
+#pragma mark -
+
+static BOOL akaBindingTypeOverridesMethod(Class bindingType, SEL selector)
+{
+    return [bindingType instanceMethodForSelector:selector] != [AKABinding instanceMethodForSelector:selector];
+}
+
+
+#pragma mark - AKABindingInitializationStep - Implementation
+#pragma mark -
+
+@implementation AKABindingInitializationStep
+
+- (instancetype)initWithKind:(AKABindingInitializationStepKind)kind
+               attributeName:(NSString*)attributeName
+         attributeExpression:(AKABindingExpression*)attributeExpression
+                       entry:(AKABindingAttributeTableEntry*)entry
+                       value:(id)value
+{
+    if (self = [super init])
+    {
+        _kind = kind;
+        _attributeName = attributeName;
+        _attributeExpression = attributeExpression;
+        _entry = entry;
+        _value = value;
+    }
+    return self;
+}
+
+@end
+
+
+#pragma mark - AKABindingInitializationPlan - Implementation
+#pragma mark -
+
+@implementation AKABindingInitializationPlan
+
+#pragma mark - Initialization
+
++ (req_AKABindingInitializationPlan)planForExpression:(AKABindingExpression*)bindingExpression
+                                          bindingType:(req_Class)bindingType
+{
+    static NSLock* lock;
+    static NSMapTable<AKABindingExpression*, AKABindingInitializationPlan*>* plans;
+    static dispatch_once_t onceToken;
+
+    dispatch_once(&onceToken, ^{
+        lock = [NSLock new];
+        // Expressions are compared by identity and not retained by the cache.
+        plans = [[NSMapTable alloc] initWithKeyOptions:(NSPointerFunctionsWeakMemory |
+                                                        NSPointerFunctionsObjectPointerPersonality)
+                                          valueOptions:NSPointerFunctionsStrongMemory
+                                              capacity:64];
+    });
+
+    [lock lock];
+    AKABindingInitializationPlan* result = [plans objectForKey:bindingExpression];
+    [lock unlock];
+
+    if (result.bindingType != bindingType)
+    {
+        result = [[AKABindingInitializationPlan alloc] initWithExpression:bindingExpression
+                                                              bindingType:bindingType];
+
+        [lock lock];
+        [plans setObject:result forKey:bindingExpression];
+        [lock unlock];
+    }
+
+    return result;
+}
+
+- (instancetype)initWithExpression:(AKABindingExpression*)bindingExpression
+                       bindingType:(Class)bindingType
+{
+    if (self = [super init])
+    {
+        _bindingType = bindingType;
+        _attributeTable = [AKABindingAttributeTable tableForBindingType:bindingType];
+
+        BOOL assignsValuesDirectly =
+            !akaBindingTypeOverridesMethod(bindingType, @selector(initializeBindingPropertyValueAssignmentAttribute:withSpecification:attributeExpression:error:));
+        BOOL assignsExpressionsDirectly =
+            !akaBindingTypeOverridesMethod(bindingType, @selector(initializeBindingPropertyExpressionAssignmentAttribute:withSpecification:attributeExpression:error:));
+
+        NSMutableArray<AKABindingInitializationStep*>* steps = [NSMutableArray new];
+        AKABindingAttributeTable* attributeTable = _attributeTable;
+
+        [((opt_AKABindingExpressionAttributes)(bindingExpression.attributes)) enumerateKeysAndObjectsUsingBlock:
+         ^(req_NSString attributeName,
+           req_AKABindingExpression attribute,
+           outreq_BOOL stop)
+         {
+             (void)stop;
+
+             AKABindingAttributeTableEntry* entry = [attributeTable entryForAttributeNamed:attributeName];
+             AKABindingInitializationStepKind kind = AKABindingInitializationStepKindAttribute;
+             id value = nil;
+
+             if (entry == nil)
+             {
+                 kind = AKABindingInitializationStepKindUnspecifiedAttribute;
+             }
+             else if (entry.attributeUse == AKABindingAttributeUseAssignExpressionToBindingProperty &&
+                      assignsExpressionsDirectly)
+             {
+                 kind = AKABindingInitializationStepKindAssignValue;
+                 value = attribute;
+             }
+             else if (entry.attributeUse == AKABindingAttributeUseAssignValueToBindingProperty &&
+                      assignsValuesDirectly && attribute.isConstant)
+             {
+                 // The binding context is not used to evaluate constants
+                 value = [attribute bindingSourceValueInContext:(req_AKABindingContext)nil];
+
+                 // Enumeration constants may not yet be resolvable, these are evaluated for each binding
+                 if (value != nil)
+                 {
+                     kind = AKABindingInitializationStepKindAssignValue;
+                 }
+             }
+
+             [steps addObject:[[AKABindingInitializationStep alloc] initWithKind:kind
+                                                                    attributeName:attributeName
+                                                              attributeExpression:attribute
+                                                                            entry:entry
+                                                                            value:value]];
+         }];
+
+        _steps = [steps copy];
+    }
+    return self;
+}
+
+@end
@@ -0,0 +1,152 @@
+//
+//  AKABindingInstrumentation.h
+//  AKABeacon
+//
+//  Created by Michael Utech on 19.10.16.
+//  Copyright © 2016 Michael Utech & AKA Sarl. All rights reserved.
+//
+
+#import "AKABinding.h"
+
+/**
+ Enables the collection of binding statistics. Instrumentation is disabled by default, define AKA_BINDING_INSTRUMENTATION=1 in the build settings of the framework (and of code using the statistics) to enable it. If disabled, the instrumentation hooks in AKABinding compile to nothing and the statistics API is not available.
+ */
+#ifndef AKA_BINDING_INSTRUMENTATION
+#  define AKA_BINDING_INSTRUMENTATION 0
+#endif
+
+#if AKA_BINDING_INSTRUMENTATION
+
+@class AKABindingStatistics;
+#define req_AKABindingStatistics AKABindingStatistics*_Nonnull
+#define opt_AKABindingStatistics AKABindingStatistics*_Nullable
+
+
+#pragma mark - AKABindingStatistics - Interface
+#pragma mark -
+
+/**
+ Counters and timings recorded for a binding or, in aggregated form, for all bindings sharing the same binding type and binding expression text.
+
+ Counters are updated atomically, statistics can be read from any thread.
+ */
+@interface AKABindingStatistics: NSObject
+
+@property(nonatomic, readonly, nonnull) Class       bindingType;
+
+@property(nonatomic, readonly, nonnull) NSString*   expressionText;
+
+/**
+ The number of source value changes processed by the binding.
+ */
+@property(nonatomic, readonly) NSUInteger           sourceChangeCount;
+
+/**
+ The number of target value updates processed by the binding, including updates which failed to convert or validate or which were rejected.
+ */
+@property(nonatomic, readonly) NSUInteger           targetUpdateCount;
+
+/**
+ The number of source to target value conversions performed by the binding.
+ */
+@property(nonatomic, readonly) NSUInteger           conversionCount;
+
+/**
+ The number of source or target values which failed to validate.
+ */
+@property(nonatomic, readonly) NSUInteger           validationFailureCount;
+
+/**
+ The time spent in convertSourceValue:toTargetValue:error:.
+ */
+@property(nonatomic, readonly) NSTimeInterval       conversionTime;
+
+/**
+ The time spent processing target value updates (including conversions and failed updates).
+ */
+@property(nonatomic, readonly) NSTimeInterval       targetUpdateTime;
+
+@end
+
+
+#pragma mark - AKABindingInstrumentation - Interface
+#pragma mark -
+
+@interface AKABindingInstrumentation: NSObject
+
+/**
+ Statistics aggregated per binding type and binding expression text, sorted by descending target update time.
+ */
++ (nonnull NSArray<AKABindingStatistics*>*)aggregatedStatistics;
+
+/**
+ Discards aggregated statistics. Statistics of existing bindings are not affected.
+ */
++ (void)resetAggregatedStatistics;
+
+@end
+
+
+#pragma mark - AKABinding(Instrumentation) - Interface
+#pragma mark -
+
+@interface AKABinding(Instrumentation)
+
+/**
+ The statistics recorded for this binding.
+ */
+@property(nonatomic, readonly, nonnull) AKABindingStatistics* statistics;
+
+@end
+
+
+#pragma mark - AKABindingController(Instrumentation) - Interface
+#pragma mark -
+
+@interface AKABindingController(Instrumentation)
+
+/**
+ Returns the statistics of the most expensive bindings (by target update time) managed by this controller and its child controllers (recursively).
+
+ @param limit the maximum number of statistics to return.
+
+ @return the statistics, most expensive first.
+ */
+- (nonnull NSArray<AKABindingStatistics*>*)mostExpensiveBindingStatisticsWithLimit:(NSUInteger)limit;
+
+@end
+
+
+#pragma mark - Instrumentation Hooks
+#pragma mark -
+
+// Used by AKABinding to record events. These expand to nothing if instrumentation is disabled.
+
+typedef NS_ENUM(NSUInteger, AKABindingInstrumentationEvent)
+{
+    AKABindingInstrumentationEventSourceChange,
+    AKABindingInstrumentationEventTargetUpdate,
+    AKABindingInstrumentationEventConversion,
+    AKABindingInstrumentationEventValidationFailure
+};
+
+FOUNDATION_EXPORT uint64_t AKABindingInstrumentationTimestamp(void);
+
+FOUNDATION_EXPORT void AKABindingInstrumentationRecord(opt_AKABindingStatistics statistics,
+                                                       AKABindingInstrumentationEvent event,
+                                                       uint64_t startTimestamp);
+
+#  define AKA_BINDING_INSTRUMENT_START(name) \
+    uint64_t name = AKABindingInstrumentationTimestamp()
+#  define AKA_BINDING_INSTRUMENT_COUNT(binding, event) \
+    AKABindingInstrumentationRecord((binding).statistics, (event), 0)
+#  define AKA_BINDING_INSTRUMENT_TIME(binding, event, name) \
+    AKABindingInstrumentationRecord((binding).statistics, (event), (name))
+
+#else
+
+#  define AKA_BINDING_INSTRUMENT_START(name)
+#  define AKA_BINDING_INSTRUMENT_COUNT(binding, event)
+#  define AKA_BINDING_INSTRUMENT_TIME(binding, event, name)
+
+#endif
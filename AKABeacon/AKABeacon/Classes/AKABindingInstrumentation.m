@@ -0,0 +1,280 @@
+//
+//  AKABindingInstrumentation.m
+//  AKABeacon
+//
+//  Created by Michael Utech on 19.10.16.
+//  Copyright © 2016 Michael Utech & AKA Sarl. All rights reserved.
+//
+
+#import <stdatomic.h>
+#import <mach/mach_time.h>
+
+#import "AKABindingInstrumentation.h"
+#import "AKABindingInstrumentation_Internal.h"
+#import "AKABindingController.h"
+
+#if AKA_BINDING_INSTRUMENTATION
+
+typedef NS_ENUM(NSUInteger, AKABindingStatisticsCounter)
+{
+    AKABindingStatisticsCounterSourceChanges,
+    AKABindingStatisticsCounterTargetUpdates,
+    AKABindingStatisticsCounterConversions,
+    AKABindingStatisticsCounterValidationFailures,
+    AKABindingStatisticsCounterConversionTime,
+    AKABindingStatisticsCounterTargetUpdateTime,
+
+    AKABindingStatisticsCounterCount
+};
+
+
+#pragma mark - AKABindingStatistics - Implementation
+#pragma mark -
+
+@interface AKABindingStatistics()
+{
+    // Event counters and (for time counters) mach absolute time units.
+    _Atomic(uint_fast64_t) _counters[AKABindingStatisticsCounterCount];
+}
+
+@property(nonatomic, readonly, nullable) AKABindingStatistics* aggregate;
+
+@end
+
+
+@implementation AKABindingStatistics
+
+- (instancetype)initWithBindingType:(req_Class)bindingType
+                     expressionText:(req_NSString)expressionText
+                          aggregate:(opt_AKABindingStatistics)aggregate
+{
+    if (self = [super init])
+    {
+        _bindingType = bindingType;
+        _expressionText = [expressionText copy];
+        _aggregate = aggregate;
+        for (NSUInteger i = 0; i < AKABindingStatisticsCounterCount; ++i)
+        {
+            atomic_init(&_counters[i], 0);
+        }
+    }
+    return self;
+}
+
+- (uint_fast64_t)valueOfCounter:(AKABindingStatisticsCounter)counter
+{
+    return atomic_load_explicit(&_counters[counter], memory_order_relaxed);
+}
+
+- (void)addValue:(uint_fast64_t)value toCounter:(AKABindingStatisticsCounter)counter
+{
+    atomic_fetch_add_explicit(&_counters[counter], value, memory_order_relaxed);
+}
+
++ (NSTimeInterval)timeIntervalForMachTime:(uint_fast64_t)machTime
+{
+    static mach_timebase_info_data_t timebase;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        mach_timebase_info(&timebase);
+    });
+
+    return (NSTimeInterval)machTime * timebase.numer / timebase.denom / NSEC_PER_SEC;
+}
+
+- (NSUInteger)sourceChangeCount
+{
+    return (NSUInteger)[self valueOfCounter:AKABindingStatisticsCounterSourceChanges];
+}
+
+- (NSUInteger)targetUpdateCount
+{
+    return (NSUInteger)[self valueOfCounter:AKABindingStatisticsCounterTargetUpdates];
+}
+
+- (NSUInteger)conversionCount
+{
+    return (NSUInteger)[self valueOfCounter:AKABindingStatisticsCounterConversions];
+}
+
+- (NSUInteger)validationFailureCount
+{
+    return (NSUInteger)[self valueOfCounter:AKABindingStatisticsCounterValidationFailures];
+}
+
+- (NSTimeInterval)conversionTime
+{
+    return [AKABindingStatistics timeIntervalForMachTime:[self valueOfCounter:AKABindingStatisticsCounterConversionTime]];
+}
+
+- (NSTimeInterval)targetUpdateTime
+{
+    return [AKABindingStatistics timeIntervalForMachTime:[self valueOfCounter:AKABindingStatisticsCounterTargetUpdateTime]];
+}
+
+- (void)recordEvent:(AKABindingInstrumentationEvent)event
+           duration:(uint_fast64_t)duration
+{
+    switch (event)
+    {
+        case AKABindingInstrumentationEventSourceChange:
+            [self addValue:1 toCounter:AKABindingStatisticsCounterSourceChanges];
+            break;
+        case AKABindingInstrumentationEventTargetUpdate:
+            [self addValue:1 toCounter:AKABindingStatisticsCounterTargetUpdates];
+            [self addValue:duration toCounter:AKABindingStatisticsCounterTargetUpdateTime];
+            break;
+        case AKABindingInstrumentationEventConversion:
+            [self addValue:1 toCounter:AKABindingStatisticsCounterConversions];
+            [self addValue:duration toCounter:AKABindingStatisticsCounterConversionTime];
+            break;
+        case AKABindingInstrumentationEventValidationFailure:
+            [self addValue:1 toCounter:AKABindingStatisticsCounterValidationFailures];
+            break;
+    }
+    [self.aggregate recordEvent:event duration:duration];
+}
+
+- (NSString *)description
+{
+    return [NSString stringWithFormat:@"<%@: %@ \"%@\" sourceChanges=%lu targetUpdates=%lu (%.3fms) conversions=%lu (%.3fms) validationFailures=%lu>",
+            self.class, NSStringFromClass(self.bindingType), self.expressionText,
+            (unsigned long)self.sourceChangeCount,
+            (unsigned long)self.targetUpdateCount, self.targetUpdateTime * 1000.0,
+            (unsigned long)self.conversionCount, self.conversionTime * 1000.0,
+            (unsigned long)self.validationFailureCount];
+}
+
+@end
+
+
+#pragma mark - AKABindingInstrumentation - Implementation
+#pragma mark -
+
+@implementation AKABindingInstrumentation
+
++ (NSLock*)lock
+{
+    static NSLock* result;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        result = [NSLock new];
+    });
+    return result;
+}
+
++ (NSMutableDictionary<NSString*, AKABindingStatistics*>*)aggregatedStatisticsByKey
+{
+    static NSMutableDictionary* result;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        result = [NSMutableDictionary new];
+    });
+    return result;
+}
+
++ (NSArray<AKABindingStatistics*>*)aggregatedStatistics
+{
+    [self.lock lock];
+    NSArray* result = self.aggregatedStatisticsByKey.allValues;
+    [self.lock unlock];
+
+    return [self sortedByTargetUpdateTime:result limit:result.count];
+}
+
++ (void)resetAggregatedStatistics
+{
+    [self.lock lock];
+    [self.aggregatedStatisticsByKey removeAllObjects];
+    [self.lock unlock];
+}
+
++ (AKABindingStatistics*)statisticsForBindingType:(req_Class)bindingType
+                                   expressionText:(req_NSString)expressionText
+{
+    NSString* key = [NSString stringWithFormat:@"%@|%@", NSStringFromClass(bindingType), expressionText];
+
+    [self.lock lock];
+    AKABindingStatistics* aggregate = self.aggregatedStatisticsByKey[key];
+    if (aggregate == nil)
+    {
+        aggregate = [[AKABindingStatistics alloc] initWithBindingType:bindingType
+                                                       expressionText:expressionText
+                                                            aggregate:nil];
+        self.aggregatedStatisticsByKey[key] = aggregate;
+    }
+    [self.lock unlock];
+
+    return [[AKABindingStatistics alloc] initWithBindingType:bindingType
+                                              expressionText:expressionText
+                                                   aggregate:aggregate];
+}
+
++ (NSArray<AKABindingStatistics*>*)sortedByTargetUpdateTime:(NSArray<AKABindingStatistics*>*)statistics
+                                                      limit:(NSUInteger)limit
+{
+    NSArray* result = [statistics sortedArrayUsingComparator:
+                       ^NSComparisonResult(AKABindingStatistics* _Nonnull s1, AKABindingStatistics* _Nonnull s2)
+                       {
+                           uint_fast64_t t1 = [s1 valueOfCounter:AKABindingStatisticsCounterTargetUpdateTime];
+                           uint_fast64_t t2 = [s2 valueOfCounter:AKABindingStatisticsCounterTargetUpdateTime];
+                           return t1 > t2 ? NSOrderedAscending : (t1 < t2 ? NSOrderedDescending : NSOrderedSame);
+                       }];
+    if (result.count > limit)
+    {
+        result = [result subarrayWithRange:NSMakeRange(0, limit)];
+    }
+
+    return result;
+}
+
+@end
+
+
+#pragma mark - AKABindingController(Instrumentation) - Implementation
+#pragma mark -
+
+@implementation AKABindingController(Instrumentation)
+
+- (NSArray<AKABindingStatistics*>*)mostExpensiveBindingStatisticsWithLimit:(NSUInteger)limit
+{
+    NSMutableArray* statistics = [NSMutableArray new];
+    [self collectBindingStatistics:statistics];
+
+    return [AKABindingInstrumentation sortedByTargetUpdateTime:statistics limit:limit];
+}
+
+- (void)collectBindingStatistics:(NSMutableArray<AKABindingStatistics*>*)statistics
+{
+    [self enumerateBindingsUsingBlock:^(req_AKABinding binding, outreq_BOOL stop __unused) {
+        AKABindingStatistics* bindingStatistics = binding.statistics;
+        if (bindingStatistics)
+        {
+            [statistics addObject:bindingStatistics];
+        }
+    }];
+    [self enumerateBindingControllersUsingBlock:^(req_AKABindingController controller, outreq_BOOL stop __unused) {
+        [controller collectBindingStatistics:statistics];
+    }];
+}
+
+@end
+
+
+#pragma mark - Instrumentation Hooks
+#pragma mark -
+
+uint64_t AKABindingInstrumentationTimestamp(void)
+{
+    return mach_absolute_time();
+}
+
+void AKABindingInstrumentationRecord(opt_AKABindingStatistics statistics,
+                                     AKABindingInstrumentationEvent event,
+                                     uint64_t startTimestamp)
+{
+    uint64_t duration = startTimestamp > 0 ? mach_absolute_time() - startTimestamp : 0;
+    [statistics recordEvent:event duration:duration];
+}
+
+#endif
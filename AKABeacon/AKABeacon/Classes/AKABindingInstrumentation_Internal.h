@@ -0,0 +1,34 @@
+//
+//  AKABindingInstrumentation_Internal.h
+//  AKABeacon
+//
+//  Created by Michael Utech on 19.10.16.
+//  Copyright © 2016 Michael Utech & AKA Sarl. All rights reserved.
+//
+
+#import "AKABindingInstrumentation.h"
+
+#if AKA_BINDING_INSTRUMENTATION
+
+@interface AKABindingStatistics (Internal)
+
+- (void)recordEvent:(AKABindingInstrumentationEvent)event
+           duration:(uint_fast64_t)duration;
+
+@end
+
+
+@interface AKABindingInstrumentation (Internal)
+
+/**
+ Creates the statistics for a new binding. Events recorded for the binding are also recorded in the aggregated statistics for the binding type and expression text.
+ */
++ (req_AKABindingStatistics)statisticsForBindingType:(req_Class)bindingType
+                                      expressionText:(req_NSString)expressionText;
+
++ (nonnull NSArray<AKABindingStatistics*>*)sortedByTargetUpdateTime:(nonnull NSArray<AKABindingStatistics*>*)statistics
+                                                              limit:(NSUInteger)limit;
+
+@end
+
+#endif
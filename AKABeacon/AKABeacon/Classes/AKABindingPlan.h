@@ -0,0 +1,71 @@
+//
+//  AKABindingPlan.h
+//  AKABeacon
+//
+//  Created by Michael Utech on 19.10.16.
+//  Copyright © 2016 Michael Utech & AKA Sarl. All rights reserved.
+//
+
+#import "AKABeaconNullability.h"
+
+@class AKABindingPlan;
+#define req_AKABindingPlan AKABindingPlan*_Nonnull
+#define opt_AKABindingPlan AKABindingPlan*_Nullable
+
+
+#pragma mark - AKABindingPlan - Interface
+#pragma mark -
+
+/**
+ Records the locations of binding targets in a target object hierarchy instantiated from a prototype (a table or collection view cell identified by its class, reuse identifier and owning table or collection view or a view controller identified by its class, nib name and storyboard or bundle).
+
+ Binding controllers scan target object hierarchies recursively for binding expressions. For hierarchies which are instantiated repeatedly from the same prototype (most importantly table view cells), the scan looks up binding expressions of the same views over and over, only to find them at the same locations. A binding plan is compiled by scanning the first instance of a prototype and records the paths (child indexes in terms of AKABindingTargetContainerProtocol enumerations) leading to the objects which define binding expressions. Other instances are then processed by following the recorded paths, without visiting objects outside of them.
+
+ Each container on a recorded path carries a structural fingerprint: the classes of its children and their numbers of children. If an instance does not match the fingerprint (f.e. because views have been added to or removed from a container on a path or from one of its children), the plan cannot be used and binding controllers fall back to scanning the hierarchy.
+
+ @note Plans assume that all instances of a prototype define binding expressions for the same objects, which is the case for instances loaded from the same nib or storyboard scene. Binding expressions which are added programmatically to objects which are unbound in the prototype's first instance will not be found, neither will objects which are added below the children of containers on recorded paths.
+
+ Binding plans are only accessed from the main thread.
+ */
+@interface AKABindingPlan: NSObject
+
+#pragma mark - Accessing Plans
+
+/**
+ Returns the binding plan for the prototype of the specified target object hierarchy, compiling it if needed.
+
+ @param rootTarget the root of the target object hierarchy.
+
+ @return the binding plan or nil if the prototype of the target object hierarchy cannot be determined (f.e. for cells which have not yet been added to a table view).
+ */
++ (opt_AKABindingPlan)planForTargetObjectHierarchy:(req_id)rootTarget;
+
+/**
+ Discards all compiled plans.
+ */
++ (void)removeAllPlans;
+
+#pragma mark - Properties
+
+/**
+ The key identifying the prototype for which the plan has been compiled.
+ */
+@property(nonatomic, readonly, nonnull) NSString* prototypeKey;
+
+/**
+ The number of binding targets recorded in the plan.
+ */
+@property(nonatomic, readonly) NSUInteger count;
+
+#pragma mark - Resolving Plans
+
+/**
+ Resolves the recorded binding targets in the specified target object hierarchy.
+
+ @param rootTarget the root of a target object hierarchy instantiated from the plan's prototype.
+
+ @return the binding targets in the order in which a recursive scan would have visited them or nil if the target object hierarchy does not match the structural fingerprint recorded in the plan.
+ */
+- (nullable NSArray*)bindingTargetsInTargetObjectHierarchy:(req_id)rootTarget;
+
+@end
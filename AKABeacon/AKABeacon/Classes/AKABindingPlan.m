@@ -0,0 +1,375 @@
+//
+//  AKABindingPlan.m
+//  AKABeacon
+//
+//  Created by Michael Utech on 19.10.16.
+//  Copyright © 2016 Michael Utech & AKA Sarl. All rights reserved.
+//
+
+@import UIKit;
+
+#import "AKABindingPlan.h"
+#import "AKABindingTargetContainerProtocol.h"
+#import "AKABindingExpression+Accessors.h"
+
+
+#pragma mark - Potential Binding Targets
+#pragma mark -
+
+/**
+ Determines whether targets of the specified class enumerate their subviews as potential binding targets (the default implementation for views), in which case their children can be accessed directly.
+ */
+static BOOL akaBindingPlanEnumeratesSubviews(Class targetClass)
+{
+    static IMP viewImplementation = NULL;
+    static dispatch_once_t onceToken;
+    SEL selector = @selector(aka_enumeratePotentialBindingTargetsUsingBlock:);
+
+    dispatch_once(&onceToken, ^{
+        viewImplementation = [UIView instanceMethodForSelector:selector];
+    });
+
+    return ([targetClass isSubclassOfClass:[UIView class]] &&
+            [targetClass instanceMethodForSelector:selector] == viewImplementation);
+}
+
+/**
+ @return the potential child binding targets of the specified target in the order in which a recursive scan visits them, or nil if the target is not a container.
+ */
+static NSArray* akaBindingPlanChildren(id target, BOOL enumeratesSubviews)
+{
+    NSArray* result = nil;
+
+    if (enumeratesSubviews)
+    {
+        result = ((UIView*)target).subviews;
+    }
+    else if ([target conformsToProtocol:@protocol(AKABindingTargetContainerProtocol)])
+    {
+        NSMutableArray* children = [NSMutableArray new];
+        [(id<AKABindingTargetContainerProtocol>)target aka_enumeratePotentialBindingTargetsUsingBlock:
+         ^(req_id bindingTarget, outreq_BOOL stop __unused)
+         {
+             [children addObject:bindingTarget];
+         }];
+        result = children;
+    }
+
+    return result;
+}
+
+/**
+ An entry of the structural fingerprint of a container: the class of a child and its number of children.
+ */
+typedef struct
+{
+    __unsafe_unretained Class   targetClass;
+    NSUInteger                  childCount;
+} AKABindingPlanFingerprintEntry;
+
+static AKABindingPlanFingerprintEntry akaBindingPlanFingerprintEntry(id target)
+{
+    Class targetClass = [target class];
+    AKABindingPlanFingerprintEntry result = { targetClass, 0 };
+
+    result.childCount = akaBindingPlanChildren(target, akaBindingPlanEnumeratesSubviews(targetClass)).count;
+
+    return result;
+}
+
+
+#pragma mark - AKABindingPlanNode
+#pragma mark -
+
+/**
+ A target on the path to a bound target: its class, its position and, for containers of other path nodes, the structural fingerprint of its children. Nodes are recorded in the order in which a recursive scan visits targets (pre-order).
+ */
+@interface AKABindingPlanNode: NSObject
+
+@property(nonatomic) Class targetClass;
+@property(nonatomic) BOOL enumeratesSubviews;
+@property(nonatomic) NSUInteger depth;
+@property(nonatomic) NSUInteger index;
+@property(nonatomic) BOOL isBound;
+
+/**
+ AKABindingPlanFingerprintEntry's of the node's children or nil if the children of the node are not on any path.
+ */
+@property(nonatomic) NSData* fingerprint;
+
+@end
+
+@implementation AKABindingPlanNode
+@end
+
+
+#pragma mark - AKABindingPlan - Private Interface
+#pragma mark -
+
+@interface AKABindingPlan()
+
+@property(nonatomic, readonly) NSArray<AKABindingPlanNode*>* nodes;
+
+@end
+
+
+#pragma mark - AKABindingPlan - Implementation
+#pragma mark -
+
+@implementation AKABindingPlan
+
+
+#pragma mark - Accessing Plans
+
+/**
+ Plans by prototype key, by the owner of the prototypes. Owners are not retained, plans are discarded along with their owners.
+ */
++ (NSMapTable<id, NSMutableDictionary<NSString*, AKABindingPlan*>*>*)plansByOwner
+{
+    static NSMapTable* result = nil;
+    static dispatch_once_t onceToken;
+
+    dispatch_once(&onceToken, ^{
+        result = [[NSMapTable alloc] initWithKeyOptions:(NSPointerFunctionsWeakMemory |
+                                                         NSPointerFunctionsObjectPointerPersonality)
+                                           valueOptions:NSPointerFunctionsStrongMemory
+                                               capacity:8];
+    });
+
+    return result;
+}
+
++ (opt_AKABindingPlan)planForTargetObjectHierarchy:(req_id)rootTarget
+{
+    NSAssert([NSThread isMainThread], @"Invalid attempt to access binding plans outside of main thread");
+
+    AKABindingPlan* result = nil;
+
+    id owner = nil;
+    NSString* key = [self prototypeKeyForTargetObjectHierarchy:rootTarget owner:&owner];
+    if (key)
+    {
+        NSMutableDictionary<NSString*, AKABindingPlan*>* plans = [self.plansByOwner objectForKey:owner];
+        if (plans == nil)
+        {
+            plans = [NSMutableDictionary new];
+            [self.plansByOwner setObject:plans forKey:owner];
+        }
+
+        result = plans[key];
+        if (result == nil)
+        {
+            result = [[AKABindingPlan alloc] initWithPrototypeKey:key
+                                            targetObjectHierarchy:rootTarget];
+            plans[key] = result;
+        }
+    }
+
+    return result;
+}
+
++ (void)removeAllPlans
+{
+    [self.plansByOwner removeAllObjects];
+}
+
+/**
+ Identifies the prototype from which the specified target object hierarchy has been instantiated.
+
+ Reuse identifiers and nib names are only unique in the scope of the table or collection view, storyboard or bundle defining them. The key identifies the prototype in the scope of this owner, which is returned in ownerStorage.
+
+ @return a key identifying the prototype or nil, if the hierarchy has not been instantiated from an identifiable prototype.
+ */
++ (opt_NSString)prototypeKeyForTargetObjectHierarchy:(req_id)rootTarget
+                                               owner:(out_id)ownerStorage
+{
+    NSString* result = nil;
+    NSString* identifier = nil;
+    id owner = nil;
+
+    if ([rootTarget isKindOfClass:[UITableViewCell class]] ||
+        [rootTarget isKindOfClass:[UITableViewHeaderFooterView class]] ||
+        [rootTarget isKindOfClass:[UICollectionReusableView class]])
+    {
+        identifier = [rootTarget reuseIdentifier];
+
+        // Reusable views are scanned (the slow way) until they have been added to their owner
+        for (UIView* view = ((UIView*)rootTarget).superview; view != nil && owner == nil; view = view.superview)
+        {
+            if ([view isKindOfClass:[UITableView class]] ||
+                [view isKindOfClass:[UICollectionView class]])
+            {
+                owner = view;
+            }
+        }
+    }
+    else if ([rootTarget isKindOfClass:[UIViewController class]])
+    {
+        UIViewController* viewController = rootTarget;
+        identifier = viewController.nibName;
+        owner = viewController.storyboard;
+        if (owner == nil)
+        {
+            owner = viewController.nibBundle ? viewController.nibBundle : [NSBundle mainBundle];
+        }
+    }
+
+    if (identifier.length > 0 && owner != nil)
+    {
+        result = [NSString stringWithFormat:@"%@:%@", NSStringFromClass([rootTarget class]), identifier];
+        if (ownerStorage)
+        {
+            *ownerStorage = owner;
+        }
+    }
+
+    return result;
+}
+
+#pragma mark - Initialization
+
+- (instancetype)initWithPrototypeKey:(req_NSString)prototypeKey
+               targetObjectHierarchy:(req_id)rootTarget
+{
+    if (self = [super init])
+    {
+        _prototypeKey = prototypeKey;
+
+        NSMutableArray* nodes = [NSMutableArray new];
+        [self recordTarget:rootTarget
+                     depth:0
+                     index:0
+                     nodes:nodes];
+        _nodes = nodes;
+    }
+    return self;
+}
+
+/**
+ Records the specified target and the paths to bound targets in its subtree, visiting targets in the same order as AKABindingController does when scanning the hierarchy. The root target is always recorded, so that its fingerprint is verified even if no targets are bound.
+
+ @return YES if the target or one of its descendants is bound.
+ */
+- (BOOL)recordTarget:(req_id)target
+               depth:(NSUInteger)depth
+               index:(NSUInteger)index
+               nodes:(NSMutableArray<AKABindingPlanNode*>*)nodes
+{
+    AKABindingPlanNode* node = [AKABindingPlanNode new];
+    node.targetClass = [target class];
+    node.enumeratesSubviews = akaBindingPlanEnumeratesSubviews(node.targetClass);
+    node.depth = depth;
+    node.index = index;
+    node.isBound = [AKABindingExpression hasBindingExpressionsForTarget:target];
+
+    NSUInteger position = nodes.count;
+    [nodes addObject:node];
+
+    BOOL result = node.isBound;
+    NSArray* children = akaBindingPlanChildren(target, node.enumeratesSubviews);
+    for (NSUInteger i = 0; i < children.count; ++i)
+    {
+        result = [self recordTarget:children[i]
+                              depth:depth + 1
+                              index:i
+                              nodes:nodes] || result;
+    }
+
+    if (result || depth == 0)
+    {
+        if (node.isBound)
+        {
+            ++_count;
+        }
+        if (children != nil && (nodes.count > position + 1 || depth == 0))
+        {
+            NSMutableData* fingerprint =
+                [NSMutableData dataWithCapacity:children.count * sizeof(AKABindingPlanFingerprintEntry)];
+            for (id child in children)
+            {
+                AKABindingPlanFingerprintEntry entry = akaBindingPlanFingerprintEntry(child);
+                [fingerprint appendBytes:&entry length:sizeof(entry)];
+            }
+            node.fingerprint = fingerprint;
+        }
+    }
+    else
+    {
+        [nodes removeObjectsInRange:NSMakeRange(position, nodes.count - position)];
+    }
+
+    return result;
+}
+
+#pragma mark - Resolving Plans
+
+/**
+ Follows the recorded paths in a single pass over the recorded nodes. The children of each visited container are kept (by depth) for the nodes following it, its fingerprint is verified before its children are accessed.
+ */
+- (NSArray*)bindingTargetsInTargetObjectHierarchy:(req_id)rootTarget
+{
+    NSMutableArray* result = [NSMutableArray arrayWithCapacity:self.count];
+    NSMutableArray<NSArray*>* childrenByDepth = [NSMutableArray new];
+
+    for (AKABindingPlanNode* node in self.nodes)
+    {
+        id target = nil;
+        if (node.depth == 0)
+        {
+            target = rootTarget;
+        }
+        else if (node.depth <= childrenByDepth.count)
+        {
+            NSArray* siblings = childrenByDepth[node.depth - 1];
+            target = node.index < siblings.count ? siblings[node.index] : nil;
+        }
+
+        if (target == nil || [target class] != node.targetClass)
+        {
+            result = nil;
+            break;
+        }
+
+        if (node.isBound)
+        {
+            [result addObject:target];
+        }
+
+        if (node.fingerprint != nil)
+        {
+            NSArray* children = akaBindingPlanChildren(target, node.enumeratesSubviews);
+            if (![self children:children matchFingerprint:node.fingerprint])
+            {
+                result = nil;
+                break;
+            }
+            [childrenByDepth removeObjectsInRange:NSMakeRange(node.depth,
+                                                              childrenByDepth.count - node.depth)];
+            [childrenByDepth addObject:children];
+        }
+    }
+
+    return result;
+}
+
+/**
+ Checking classes and child counts is much cheaper than looking up binding expressions and guarantees that an instance which differs from the recorded one in the vicinity of the recorded paths (f.e. by views added to a cell instance) is scanned instead of silently ignoring some of its targets.
+ */
+- (BOOL)    children:(NSArray*)children
+    matchFingerprint:(NSData*)fingerprint
+{
+    const AKABindingPlanFingerprintEntry* entries = fingerprint.bytes;
+    NSUInteger count = fingerprint.length / sizeof(AKABindingPlanFingerprintEntry);
+
+    BOOL result = children.count == count;
+    for (NSUInteger i = 0; result && i < count; ++i)
+    {
+        AKABindingPlanFingerprintEntry entry = akaBindingPlanFingerprintEntry(children[i]);
+        result = (entry.targetClass == entries[i].targetClass &&
+                  entry.childCount == entries[i].childCount);
+    }
+
+    return result;
+}
+
+@end
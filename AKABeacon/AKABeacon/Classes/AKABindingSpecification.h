@@ -498,6 +498,17 @@ NSDictionary<NSString*, AKABindingAttributeSpecification*>*    attributes;
 #pragma mark - Enumeration and Options Constant Registry
 // @name Registering enumeration and options types
 
+/**
+ Registers multiple enumeration and options types at once, see registerEnumerationType:withValuesByName: and registerOptionsType:withValuesByName:.
+
+ The registry can be used from any thread. Lookups do not lock, each registration replaces the registry's immutable state; registering related types in one call replaces it only once. Types which are already registered are ignored.
+
+ @param enumerations valuesByName dictionaries by enumeration type name.
+ @param options valuesByName dictionaries by options type name, registered after the enumerations.
+ */
++ (void)                              registerEnumerationTypes:(NSDictionary<NSString*, NSDictionary<NSString*, id>*>*_Nullable)enumerations
+                                                  optionsTypes:(NSDictionary<NSString*, NSDictionary<NSString*, NSNumber*>*>*_Nullable)options;
+
 /**
  Registers a name/value mapping for the enumeration with the specified enumeration type name.
 
@@ -7,9 +7,9 @@
 //
 
 #include <objc/runtime.h>
+#import <stdatomic.h>
 
 #import "AKALog.h"
-#import "NSObject+AKAConcurrencyTools.h"
 
 #import "AKABindingSpecification.h"
 #import "AKABindingExpression_Internal.h"
@@ -267,6 +267,58 @@ NSString*const kAKABindingAttributesSpecificationBindingPropertyKey = @"bindingP
 @end
 
 
+#pragma mark - AKAEnumerationRegistrySnapshot
+#pragma mark -
+
+/**
+ Immutable state of the enumeration and options registry.
+
+ Registrations create a new snapshot and publish it atomically, lookups read the current snapshot without locking. Published snapshots are never released (registrations are rare and typically happen once per type), so that readers can safely use a snapshot even if it has been replaced in the meantime.
+ */
+@interface AKAEnumerationRegistrySnapshot: NSObject
+
+- (instancetype)initWithEnumerations:(NSDictionary<NSString*, NSDictionary<NSString*, id>*>*)enumerations
+                             options:(NSDictionary<NSString*, NSDictionary<NSString*, NSNumber*>*>*)options;
+
+@property(nonatomic, readonly) NSDictionary<NSString*, NSDictionary<NSString*, id>*>*           enumerations;
+@property(nonatomic, readonly) NSDictionary<NSString*, NSDictionary<NSString*, NSNumber*>*>*    options;
+
+@end
+
+@implementation AKAEnumerationRegistrySnapshot
+
+- (instancetype)initWithEnumerations:(NSDictionary<NSString*, NSDictionary<NSString*, id>*>*)enumerations
+                             options:(NSDictionary<NSString*, NSDictionary<NSString*, NSNumber*>*>*)options
+{
+    if (self = [super init])
+    {
+        _enumerations = [enumerations copy];
+        _options = [options copy];
+    }
+    return self;
+}
+
+@end
+
+static _Atomic(void*) akaEnumerationRegistrySnapshot;
+
+/**
+ Publishes the snapshot. Callers have to serialize calls.
+ */
+static void akaPublishEnumerationRegistrySnapshot(AKAEnumerationRegistrySnapshot* snapshot)
+{
+    static NSMutableArray<AKAEnumerationRegistrySnapshot*>* publishedSnapshots;
+
+    if (publishedSnapshots == nil)
+    {
+        publishedSnapshots = [NSMutableArray new];
+    }
+    [publishedSnapshots addObject:snapshot];
+
+    atomic_store_explicit(&akaEnumerationRegistrySnapshot, (__bridge void*)snapshot, memory_order_release);
+}
+
+
 #pragma mark - AKABindingExpressionSpecification
 #pragma mark -
 
@@ -438,18 +490,74 @@ NSString*const kAKABindingAttributesSpecificationBindingPropertyKey = @"bindingP
     }
 }
 
-#pragma mark - Enumeration Constant Registry
+#pragma mark - Enumeration and Options Constant Registry
 
-+ (nonnull NSMutableDictionary<NSString*, NSDictionary<NSString*, id>*>*) registry
++ (AKAEnumerationRegistrySnapshot*)                                     registrySnapshot
 {
-    static NSMutableDictionary<NSString*, NSDictionary<NSString*, id>*>* result;
     static dispatch_once_t onceToken;
 
     dispatch_once(&onceToken, ^{
-        result = [NSMutableDictionary new];
+        akaPublishEnumerationRegistrySnapshot([[AKAEnumerationRegistrySnapshot alloc] initWithEnumerations:@{}
+                                                                                                  options:@{}]);
     });
 
-    return result;
+    return (__bridge AKAEnumerationRegistrySnapshot*)atomic_load_explicit(&akaEnumerationRegistrySnapshot,
+                                                                           memory_order_acquire);
+}
+
++ (void)            registerEnumerationTypes:(NSDictionary<NSString*, NSDictionary<NSString*, id>*>*_Nullable)enumerations
+                                optionsTypes:(NSDictionary<NSString*, NSDictionary<NSString*, NSNumber*>*>*_Nullable)options
+{
+    static NSLock* lock;
+    static dispatch_once_t onceToken;
+
+    dispatch_once(&onceToken, ^{
+        lock = [NSLock new];
+    });
+
+    [lock lock];
+
+    AKAEnumerationRegistrySnapshot* snapshot = [self registrySnapshot];
+    NSMutableDictionary<NSString*, NSDictionary<NSString*, id>*>* updatedEnumerations =
+        [snapshot.enumerations mutableCopy];
+    NSMutableDictionary<NSString*, NSDictionary<NSString*, NSNumber*>*>* updatedOptions =
+        [snapshot.options mutableCopy];
+    __block BOOL changed = NO;
+
+    // TODO: add error parameter + handling for conflicting registrations, which are ignored.
+    [enumerations enumerateKeysAndObjectsUsingBlock:
+     ^(NSString* _Nonnull enumerationType, NSDictionary<NSString*, id>* _Nonnull valuesByName, outreq_BOOL stop)
+     {
+         (void)stop;
+
+         if (!updatedEnumerations[enumerationType])
+         {
+             updatedEnumerations[enumerationType] = [valuesByName copy];
+             changed = YES;
+         }
+     }];
+
+    [options enumerateKeysAndObjectsUsingBlock:
+     ^(NSString* _Nonnull optionsType, NSDictionary<NSString*, NSNumber*>* _Nonnull valuesByName, outreq_BOOL stop)
+     {
+         (void)stop;
+
+         if (!updatedEnumerations[optionsType] && !updatedOptions[optionsType])
+         {
+             NSDictionary<NSString*, NSNumber*>* values = [valuesByName copy];
+             updatedEnumerations[optionsType] = values;
+             updatedOptions[optionsType] = values;
+             changed = YES;
+         }
+     }];
+
+    if (changed)
+    {
+        akaPublishEnumerationRegistrySnapshot([[AKAEnumerationRegistrySnapshot alloc] initWithEnumerations:updatedEnumerations
+                                                                                                  options:updatedOptions]);
+    }
+
+    [lock unlock];
 }
 
 + (id)resolveEnumeratedValue:(opt_NSString)symbolicValue
@@ -460,14 +568,25 @@ NSString*const kAKABindingAttributesSpecificationBindingPropertyKey = @"bindingP
 
     if (enumerationType.length > 0)
     {
-        NSDictionary<NSString*, NSNumber*>* valuesByName =
-            [self registry][(req_NSString)enumerationType];
+        NSDictionary<NSString*, id>* valuesByName =
+            [self registrySnapshot].enumerations[(req_NSString)enumerationType];
 
         if (valuesByName != nil)
         {
             if (symbolicValue.length > 0)
             {
-                result = [valuesByName valueForKeyPath:(req_NSString)symbolicValue];
+                // Symbolic values may be followed by a key path which is applied to the enumerated value
+                NSRange separator = [(req_NSString)symbolicValue rangeOfString:@"."];
+
+                if (separator.location == NSNotFound)
+                {
+                    result = valuesByName[(req_NSString)symbolicValue];
+                }
+                else
+                {
+                    result = valuesByName[[(req_NSString)symbolicValue substringToIndex:separator.location]];
+                    result = [result valueForKeyPath:[(req_NSString)symbolicValue substringFromIndex:NSMaxRange(separator)]];
+                }
 
                 if (result == nil && error != nil)
                 {
@@ -484,48 +603,19 @@ NSString*const kAKABindingAttributesSpecificationBindingPropertyKey = @"bindingP
 
 + (NSDictionary<NSString*, id>*)enumeratedValuesForEnumerationType:(req_NSString)enumerationType
 {
-    return [self registry][enumerationType];
+    return [self registrySnapshot].enumerations[enumerationType];
 }
 
 + (void)registerEnumerationType:(req_NSString)enumerationType
                withValuesByName:(NSDictionary<NSString*, id>* _Nonnull)valuesByName
 {
-    __block BOOL result = NO;
-
-    NSAssert([NSThread isMainThread], @"Invalid attempt to register an enumeration type outside of main thread!");
-
-    [enumerationType aka_performBlockInMainThreadOrQueue:^{
-        NSMutableDictionary<NSString*, NSDictionary<NSString*, id>*>* registry =
-        [self registry];
-
-        if (!registry[enumerationType])
-        {
-            registry[enumerationType] = valuesByName;
-            result = YES;
-        }
-    }
-                                       waitForCompletion:YES];
-    
-    (void)result; // TODO: add error parameter + handling
+    [self registerEnumerationTypes:@{ enumerationType: valuesByName }
+                      optionsTypes:nil];
 }
 
 + (BOOL)isEnumerationTypeDefined:(NSString *)enumerationType
 {
-    return [self registry][enumerationType] != nil;
-}
-
-#pragma mark - Options Constant Registry
-
-+ (nonnull NSMutableDictionary<NSString*, NSDictionary<NSString*, NSNumber*>*>*) optionsRegistry
-{
-    static NSMutableDictionary<NSString*, NSDictionary<NSString*, NSNumber*>*>* result;
-    static dispatch_once_t onceToken;
-
-    dispatch_once(&onceToken, ^{
-        result = [NSMutableDictionary new];
-    });
-
-    return result;
+    return [self registrySnapshot].enumerations[enumerationType] != nil;
 }
 
 + (NSNumber*)resolveOptionsValue:(opt_AKABindingExpressionAttributes)attributes
@@ -537,7 +627,7 @@ NSString*const kAKABindingAttributesSpecificationBindingPropertyKey = @"bindingP
     if (optionsType.length > 0)
     {
         NSDictionary<NSString*, NSNumber*>* valuesByName =
-            [self optionsRegistry][(req_NSString)optionsType];
+            [self registrySnapshot].options[(req_NSString)optionsType];
 
         if (valuesByName != nil)
         {
@@ -573,38 +663,18 @@ NSString*const kAKABindingAttributesSpecificationBindingPropertyKey = @"bindingP
 + (void)registerOptionsType:(req_NSString)enumerationType
             withValuesByName:(NSDictionary<NSString*, NSNumber*>* _Nonnull)valuesByName
 {
-    __block BOOL result = NO;
-
-    NSAssert([NSThread isMainThread], @"Invalid attempt to register an options type outside of main thread!");
-
-    [enumerationType aka_performBlockInMainThreadOrQueue:^{
-        NSMutableDictionary<NSString*, NSDictionary<NSString*, NSNumber*>*>* optionsRegistry =
-            [self optionsRegistry];
-        NSMutableDictionary<NSString*, NSDictionary<NSString*, id>*>* enumRegistry =
-            [self registry];
-
-
-        if (!enumRegistry[enumerationType] && !optionsRegistry[enumerationType])
-        {
-            [self registerEnumerationType:enumerationType
-                         withValuesByName:valuesByName];
-            optionsRegistry[enumerationType] = valuesByName;
-            result = YES;
-        }
-    }
-                                       waitForCompletion:YES];
-
-    (void)result;
+    [self registerEnumerationTypes:nil
+                      optionsTypes:@{ enumerationType: valuesByName }];
 }
 
 + (NSArray<NSString*>* _Nullable)registeredOptionNamesForOptionsType:(req_NSString)optionsType
 {
-    return [self optionsRegistry][optionsType].allKeys;
+    return [self registrySnapshot].options[optionsType].allKeys;
 }
 
 + (BOOL)isOptionsTypeDefined:(NSString *)optionsType
 {
-    return [self optionsRegistry][optionsType] != nil;
+    return [self registrySnapshot].options[optionsType] != nil;
 }
 
 #pragma mark - Expression Type (Set) Names
@@ -810,10 +880,56 @@ NSString*const kAKABindingAttributesSpecificationBindingPropertyKey = @"bindingP
 #pragma mark - AKATypePattern
 #pragma mark -
 
+/**
+ Results of matching a class, stored in the low bits of the last matched class in AKATypePattern's match cache.
+ */
+typedef NS_ENUM(uintptr_t, AKATypePatternClassMatch)
+{
+    AKATypePatternClassMatchRejected = 0,
+    AKATypePatternClassMatchAccepted = 1,
+    /// The class is accepted but instances (NSValues) also have to match the value type constraints.
+    AKATypePatternClassMatchValueTypeDependent = 2,
+
+    AKATypePatternClassMatchMask = 3
+};
+
+/**
+ Limits the size of the per pattern match caches, caches are cleared when they are full.
+ */
+static const NSUInteger kAKATypePatternMatchCacheCapacity = 256;
+
 @implementation AKATypePattern
+{
+    // The last matched class combined with the match result, used as lock free fast path.
+    _Atomic(uintptr_t)                                              _lastClassMatch;
+
+    NSLock*                                                         _matchCacheLock;
+    NSMapTable<Class, NSNumber*>*                                   _classMatches;
+
+    // C string keys (objCType encodings) are compared by content and owned by the map table
+    NSMapTable*                                                     _valueTypeMatches;
+}
 
 #pragma mark - Initialization
 
+- (instancetype)init
+{
+    if (self = [super init])
+    {
+        atomic_init(&_lastClassMatch, (uintptr_t)0);
+        _matchCacheLock = [NSLock new];
+        _classMatches = [[NSMapTable alloc] initWithKeyOptions:(NSPointerFunctionsOpaqueMemory |
+                                                                NSPointerFunctionsOpaquePersonality)
+                                                  valueOptions:NSPointerFunctionsStrongMemory
+                                                      capacity:8];
+        _valueTypeMatches = [[NSMapTable alloc] initWithKeyOptions:(NSPointerFunctionsMallocMemory |
+                                                                    NSPointerFunctionsCStringPersonality)
+                                                      valueOptions:NSPointerFunctionsStrongMemory
+                                                          capacity:8];
+    }
+    return self;
+}
+
 
 + (AKATypePattern*)typePatternWithObject:(id)value required:(BOOL)required
 {
@@ -889,7 +1005,7 @@ NSString*const kAKABindingAttributesSpecificationBindingPropertyKey = @"bindingP
         _rejectedTypes = [AKATypePattern setOfClassesFromClassOrArrayOfClasses:dictionary[@"rejectedTypes"]
                                                                        basedOn:base.rejectedTypes];
         _rejectedValueTypes =
-            [AKATypePattern setOfValueTypeFromStringOrArrayOfStrings:dictionary[@"acceptedValueTypes"]
+            [AKATypePattern setOfValueTypeFromStringOrArrayOfStrings:dictionary[@"rejectedValueTypes"]
                                                              basedOn:base.rejectedValueTypes];
     }
 
@@ -961,12 +1077,12 @@ NSString*const kAKABindingAttributesSpecificationBindingPropertyKey = @"bindingP
     }
 }
 
-+ (BOOL) setOfTypes:(NSSet<Class>*)typeSet matchesObject:(id)object
++ (BOOL) setOfTypes:(NSSet<Class>*)typeSet matchesClass:(Class)type
 {
     BOOL result = NO;
-    for (Class type in typeSet)
+    for (Class acceptedType in typeSet)
     {
-        if ([[object class] isSubclassOfClass:type])
+        if ([type isSubclassOfClass:acceptedType])
         {
             result = YES;
             break;
@@ -975,9 +1091,9 @@ NSString*const kAKABindingAttributesSpecificationBindingPropertyKey = @"bindingP
     return result;
 }
 
-+ (BOOL) setOfValueTypeCodes:(NSSet<NSString*>*)typeSet matchesValue:(NSValue*)value
++ (BOOL) setOfValueTypeCodes:(NSSet<NSString*>*)typeSet matchesTypeCode:(const char*)objCType
 {
-    NSString* code = [NSString stringWithCString:(value).objCType
+    NSString* code = [NSString stringWithCString:objCType
                                         encoding:NSASCIIStringEncoding];
     BOOL result = [typeSet containsObject:code];
     return result;
@@ -989,28 +1105,100 @@ NSString*const kAKABindingAttributesSpecificationBindingPropertyKey = @"bindingP
 
     if (object != nil)
     {
-        result = ![AKATypePattern setOfTypes:self.rejectedTypes matchesObject:object];
+        Class type = [object class];
+        uintptr_t lastClassMatch = atomic_load_explicit(&_lastClassMatch, memory_order_relaxed);
+        AKATypePatternClassMatch match = ((lastClassMatch & ~(uintptr_t)AKATypePatternClassMatchMask) == (uintptr_t)type
+                                          ? (AKATypePatternClassMatch)(lastClassMatch & AKATypePatternClassMatchMask)
+                                          : [self matchForClass:type]);
+
+        result = (match == AKATypePatternClassMatchAccepted ||
+                  (match == AKATypePatternClassMatchValueTypeDependent &&
+                   [self matchesValueTypeCode:((NSValue*)object).objCType]));
+    }
+
+    return result;
+}
 
-        if (result && self.acceptedTypes.count > 0)
+- (AKATypePatternClassMatch)                      matchForClass:(Class)type
+{
+    [_matchCacheLock lock];
+
+    NSNumber* cachedMatch = [_classMatches objectForKey:type];
+    AKATypePatternClassMatch result;
+
+    if (cachedMatch != nil)
+    {
+        result = cachedMatch.unsignedIntegerValue;
+    }
+    else
+    {
+        BOOL matches = ![AKATypePattern setOfTypes:self.rejectedTypes matchesClass:type];
+
+        if (matches && self.acceptedTypes.count > 0)
         {
-            result = [AKATypePattern setOfTypes:self.acceptedTypes matchesObject:object];
+            matches = [AKATypePattern setOfTypes:self.acceptedTypes matchesClass:type];
         }
 
-        if (result && (self.rejectedValueTypes.count > 0 || self.acceptedValueTypes.count > 0))
+        if (!matches)
         {
-            if ([object isKindOfClass:[NSValue class]])
-            {
-                NSValue* value = object;
-                result = ![AKATypePattern setOfValueTypeCodes:self.rejectedValueTypes matchesValue:value];
+            result = AKATypePatternClassMatchRejected;
+        }
+        else if ((self.rejectedValueTypes.count > 0 || self.acceptedValueTypes.count > 0) &&
+                 [type isSubclassOfClass:[NSValue class]])
+        {
+            result = AKATypePatternClassMatchValueTypeDependent;
+        }
+        else
+        {
+            result = AKATypePatternClassMatchAccepted;
+        }
 
-                if (result && self.acceptedTypes.count > 0)
-                {
-                    result = [AKATypePattern setOfValueTypeCodes:self.acceptedValueTypes matchesValue:value];
-                }
-            }
+        if (_classMatches.count >= kAKATypePatternMatchCacheCapacity)
+        {
+            [_classMatches removeAllObjects];
+        }
+        [_classMatches setObject:@(result) forKey:type];
+    }
+
+    // Class pointers are aligned, the low bits are free to hold the result
+    NSAssert(((uintptr_t)type & AKATypePatternClassMatchMask) == 0, @"Unexpected unaligned class pointer %p", type);
+    atomic_store_explicit(&_lastClassMatch, (uintptr_t)type | result, memory_order_relaxed);
+
+    [_matchCacheLock unlock];
+
+    return result;
+}
+
+- (BOOL)                                  matchesValueTypeCode:(const char*)objCType
+{
+    [_matchCacheLock lock];
+
+    NSNumber* cachedMatch = (__bridge NSNumber*)NSMapGet(_valueTypeMatches, objCType);
+    BOOL result;
+
+    if (cachedMatch != nil)
+    {
+        result = cachedMatch.boolValue;
+    }
+    else
+    {
+        result = ![AKATypePattern setOfValueTypeCodes:self.rejectedValueTypes matchesTypeCode:objCType];
+
+        if (result && self.acceptedValueTypes.count > 0)
+        {
+            result = [AKATypePattern setOfValueTypeCodes:self.acceptedValueTypes matchesTypeCode:objCType];
         }
+
+        if (_valueTypeMatches.count >= kAKATypePatternMatchCacheCapacity)
+        {
+            [_valueTypeMatches removeAllObjects];
+        }
+        // The map table owns (and frees) the copy of the type encoding
+        NSMapInsertKnownAbsent(_valueTypeMatches, strdup(objCType), (__bridge void*)@(result));
     }
 
+    [_matchCacheLock unlock];
+
     return result;
 }
 
@@ -10,6 +10,7 @@
 #import "AKATransitionAnimationParametersPropertyBinding.h"
 #import "AKABinding_Protected.h"
 #import "AKABinding+SubclassInitialization.h"
+#import "AKAImageLoader.h"
 
 @interface AKABinding_UIImageView_imageBinding()
 
@@ -25,6 +26,8 @@
 @property(nonatomic) NSNumber* maxWidth;
 @property(nonatomic) NSNumber* maxHeight;
 
+@property(nonatomic) AKAImageLoadRequest* pendingImageRequest;
+
 @end
 
 
@@ -86,30 +89,6 @@
     return image;
 }
 
-+ (UIImage *)resizeImage:(UIImage*)image scale:(CGFloat)scale
-{
-    return [self resizeImage:image
-                     newSize:CGSizeMake(image.size.width * scale,
-                                        image.size.height * scale)];
-}
-
-+ (UIImage *)resizeImage:(UIImage*)image newSize:(CGSize)newSize
-{
-    UIGraphicsBeginImageContext(newSize);
-
-    // Draw the scaled image in the current context
-    [image drawInRect:CGRectMake(0, 0, newSize.width, newSize.height)];
-
-    // Create a new image from current context
-    UIImage* scaledImage = UIGraphicsGetImageFromCurrentImageContext();
-
-    // Pop the current context from the stack
-    UIGraphicsEndImageContext();
-
-    // Return our new scaled image
-    return scaledImage;
-}
-
 - (req_AKAProperty  )createTargetValuePropertyForTarget:(req_id)view
                                                   error:(out_NSError __unused)error
 {
@@ -127,40 +106,18 @@
             ^(id target, id value)
             {
                 AKABinding_UIImageView_imageBinding* binding = target;
-                UIImage* image;
 
-                if ([value isKindOfClass:[UIImage class]])
+                if ([value isKindOfClass:[AKAImageLoadRequest class]])
                 {
-                    image = value;
-                    if (binding.maxWidth || binding.maxHeight)
-                    {
-                        CGFloat vscale = 1.0;
-                        CGFloat hscale = 1.0;
-                        if (binding.maxHeight && binding.maxHeight.floatValue < image.size.height)
-                        {
-                            vscale = binding.maxHeight.floatValue / image.size.height;
-                        }
-                        if (binding.maxWidth && binding.maxWidth.floatValue < image.size.width)
-                        {
-                            hscale = binding.maxWidth.floatValue / image.size.width;
-                        }
-                        CGFloat scale = MIN(vscale, hscale);
-                        if (scale < 1.0)
-                        {
-                            image = [binding.class resizeImage:image scale:scale];
-                        }
-                    }
+                    // The image is being loaded, clear the image (which might be that of a previous
+                    // use of a recycled cell) without animation, the transition is performed when
+                    // the image arrives.
+                    binding.imageView.image = nil;
                 }
-                else if (value == nil || value == [NSNull null])
+                else
                 {
-                   image = nil;
+                    [binding setImage:[value isKindOfClass:[UIImage class]] ? value : nil];
                 }
-
-                [binding transitionAnimation:^{
-                    [binding adjustAspectRatioForImage:image];
-                    binding.imageView.image = image;
-                    [binding.imageView layoutIfNeeded];
-                }];
             }
                           observationStarter:
             ^BOOL (id target)
@@ -184,10 +141,22 @@
                     binding.isObserving = NO;
                 }
 
+                [binding.pendingImageRequest cancel];
+                binding.pendingImageRequest = nil;
+
                 return !binding.isObserving;
             }];
 }
 
+- (void)setImage:(UIImage*)image
+{
+    [self transitionAnimation:^{
+        [self adjustAspectRatioForImage:image];
+        self.imageView.image = image;
+        [self.imageView layoutIfNeeded];
+    }];
+}
+
 - (void)adjustAspectRatioForImage:(UIImage*)image
 {
     if (self.adjustAspectRatioConstraint.length > 0)
@@ -298,11 +267,49 @@
 
     NSParameterAssert(targetValueStore != nil);
 
-    if ([sourceValue isKindOfClass:[NSString class]])
+    // Cancel loading the image for the previous source value
+    [self.pendingImageRequest cancel];
+    self.pendingImageRequest = nil;
+
+    BOOL hasMaximumSize = self.maxWidth || self.maxHeight;
+    if ([sourceValue isKindOfClass:[NSString class]] ||
+        [sourceValue isKindOfClass:[NSURL class]] ||
+        ([sourceValue isKindOfClass:[UIImage class]] && hasMaximumSize))
     {
-        UIImage* image = [UIImage imageNamed:(NSString*)sourceValue];
-        self.syntheticTargetValue = image; // Keep a strong reference to the loaded image
-        *targetValueStore = image;
+        AKAImageLoader* loader = [AKAImageLoader sharedLoader];
+
+        UIImageView* imageView = self.imageView;
+        CGSize fillSize = imageView.bounds.size;
+        CGSize maxSize = CGSizeMake(self.maxWidth.doubleValue, self.maxHeight.doubleValue);
+        CGFloat scale = imageView.window ? imageView.window.screen.scale : [UIScreen mainScreen].scale;
+
+        UIImage* image = [loader cachedImageForSource:(req_id)sourceValue
+                                             fillSize:fillSize
+                                              maxSize:maxSize
+                                                scale:scale];
+        if (image)
+        {
+            self.syntheticTargetValue = image; // Keep a strong reference to the loaded image
+            *targetValueStore = image;
+        }
+        else
+        {
+            __weak typeof(self) weakSelf = self;
+            AKAImageLoadRequest* request =
+                [loader loadImageForSource:(req_id)sourceValue
+                                  fillSize:fillSize
+                                   maxSize:maxSize
+                                     scale:scale
+                                completion:
+                 ^(req_AKAImageLoadRequest loadedRequest, opt_UIImage loadedImage)
+                 {
+                     [weakSelf didLoadImage:loadedImage forRequest:loadedRequest];
+                 }];
+            self.pendingImageRequest = request;
+
+            // The target value setter will clear the image until the request completes.
+            *targetValueStore = request;
+        }
         result = YES;
     }
     else
@@ -313,4 +320,19 @@
     return result;
 }
 
+- (void)                                   didLoadImage:(UIImage*)image
+                                             forRequest:(AKAImageLoadRequest*)request
+{
+    if (request == self.pendingImageRequest)
+    {
+        self.pendingImageRequest = nil;
+        self.syntheticTargetValue = image; // Keep a strong reference to the loaded image
+
+        if (self.isObserving)
+        {
+            [self setImage:image];
+        }
+    }
+}
+
 @end
@@ -17,6 +17,7 @@
 #import "AKAAttributedFormatterPropertyBinding.h"
 #import "AKATransitionAnimationParametersPropertyBinding.h"
 #import "AKANSEnumerations.h"
+#import "AKAConversionCache.h"
 
 
 #pragma mark - AKABinding_UILabel_textBinding - Private Interface
@@ -28,6 +29,10 @@
 
 @property(nonatomic) BOOL isObserving;
 
+#pragma mark - Conversion Cache
+
+@property(nonatomic, readonly) AKAConversionCache*    conversionCache;
+
 #pragma mark - Convenience
 
 @property(nonatomic, readonly) UILabel*               label;
@@ -40,6 +45,8 @@
 
 @implementation AKABinding_UILabel_textBinding
 
+@synthesize conversionCache = _conversionCache;
+
 + (AKABindingSpecification*)specification
 {
     static AKABindingSpecification* result = nil;
@@ -237,6 +244,28 @@
 {
     NSAssert(formatter == nil || [formatter isKindOfClass:NSFormatter.class], @"bam!");
     _formatter = formatter;
+    [_conversionCache invalidate];
+}
+
+- (void)setNumberFormatter:(NSNumberFormatter*)numberFormatter
+{
+    _numberFormatter = numberFormatter;
+    [_conversionCache invalidate];
+}
+
+- (void)setDateFormatter:(NSDateFormatter*)dateFormatter
+{
+    _dateFormatter = dateFormatter;
+    [_conversionCache invalidate];
+}
+
+- (AKAConversionCache*)conversionCache
+{
+    if (_conversionCache == nil)
+    {
+        _conversionCache = [AKAConversionCache new];
+    }
+    return _conversionCache;
 }
 
 #pragma mark - Conversion
@@ -249,7 +278,17 @@
 
     NSParameterAssert(targetValueStore != nil);
 
-    if ([sourceValue isKindOfClass:[NSNumber class]])
+    // Labels displaying frequently refreshed values tend to convert the same values over and over:
+    NSFormatter* formatter = [self formatterForSourceValue:sourceValue];
+    BOOL cached = formatter && [self.conversionCache lookupText:targetValueStore
+                                                       forValue:sourceValue
+                                                        context:formatter];
+
+    if (cached)
+    {
+        result = YES;
+    }
+    else if ([sourceValue isKindOfClass:[NSNumber class]])
     {
         if (self.numberFormatter)
         {
@@ -295,6 +334,43 @@
         result = [super convertSourceValue:sourceValue toTargetValue:targetValueStore error:error];
     }
 
+    if (result && formatter && !cached)
+    {
+        [self.conversionCache recordText:*targetValueStore
+                                forValue:sourceValue
+                                 context:formatter];
+    }
+
+    return result;
+}
+
+/**
+ * Determines the formatter that convertSourceValue:toTargetValue:error: uses to convert the specified source value or nil, if the conversion does not use a formatter.
+ */
+- (NSFormatter*)formatterForSourceValue:(opt_id)sourceValue
+{
+    NSFormatter* result = nil;
+
+    if ([sourceValue isKindOfClass:[NSNumber class]])
+    {
+        if (self.numberFormatter)
+        {
+            result = self.numberFormatter;
+        }
+        else if (!(self.textForYes && self.textForNo))
+        {
+            result = self.formatter;
+        }
+    }
+    else if ([sourceValue isKindOfClass:[NSDate class]])
+    {
+        result = self.dateFormatter ? self.dateFormatter : self.formatter;
+    }
+    else if (sourceValue != nil)
+    {
+        result = self.formatter;
+    }
+
     return result;
 }
 
@@ -316,6 +392,10 @@
                  forSourceValue:(opt_id __unused)oldSourceValue
                        changeTo:(opt_id __unused)newSourceValue
 {
+    // Formatter property bindings update formatters in place if formatter attributes are bound,
+    // cached conversions might no longer be valid.
+    [_conversionCache invalidate];
+
     // TODO: this is a bit crude, check if there is a more elegant way to do this:
     // Update target value if the attribute formatter or its pattern changes (f.e. a search pattern)
     if (self.textAttributeFormatter)
@@ -9,10 +9,11 @@
 #import "NSObject+AKAConcurrencyTools.h"
 
 #import "AKABinding_UIPickerView_valueBinding.h"
+#import "AKAChoiceList.h"
 
 @interface AKABinding_UIPickerView_valueBinding() <UIPickerViewDelegate, UIPickerViewDataSource>
 
-@property(nonatomic, readonly)       NSArray*                  choices;
+@property(nonatomic, readonly)       AKAChoiceList*            choiceList;
 @property(nonatomic, readonly)       AKAProperty*              choicesProperty;
 @property(nonatomic, readonly)       AKAUnboundProperty*       titleProperty;
 @property(nonatomic)                 NSInteger                 previouslySelectedRow;
@@ -207,44 +208,110 @@
     return _choicesProperty;
 }
 
-@synthesize choices = _choices;
-- (NSArray*)                                           choices
+- (NSArray*)                                  choicesForValue:(id)value
 {
-   if (!self.pickerBindingEnabled)
-      return @[];
-   
-    if (_choices == nil)
+    NSArray* result = nil;
+
+    if ([value isKindOfClass:[NSArray class]])
+    {
+        result = value;
+    }
+    else if ([value isKindOfClass:[NSSet class]])
     {
-        id value = self.choicesProperty.value;
+        result = [((NSSet*)value) allObjects];
+    }
 
-        if ([value isKindOfClass:[NSArray class]])
-        {
-            _choices = value;
-        }
-        else if ([value isKindOfClass:[NSSet class]])
-        {
-            _choices = [((NSSet*)value) allObjects];
-        }
+    return result;
+}
+
+@synthesize choiceList = _choiceList;
+- (AKAChoiceList*)                                  choiceList
+{
+    AKAChoiceList* result = _choiceList;
+
+    if (result == nil)
+    {
+        NSArray* choices = self.pickerBindingEnabled ? [self choicesForValue:self.choicesProperty.value] : nil;
+
+        result = [[AKAChoiceList alloc] initWithItems:choices];
 
-        if (_choices != nil)
+        if (choices != nil)
         {
+            __weak typeof(self) weakSelf = self;
+            result.titleProvider = ^NSString*(id choice)
+            {
+                return [weakSelf titleForChoice:choice];
+            };
+            _choiceList = result;
+
             [self setNeedsReloadChoices];
             [self reloadChoicesIfNeeded];
         }
     }
 
-    return _choices;
+    return result;
 }
 
 - (void)                                      choicesDidChange
 {
     [self aka_performBlockInMainThreadOrQueue:^{
-        self->_choices = nil;
-        [self setNeedsReloadChoices];
+        if (self->_choiceList == nil)
+        {
+            [self setNeedsReloadChoices];
+        }
+        else
+        {
+            NSArray* choices = [self choicesForValue:self.choicesProperty.value];
+            BOOL isPickerDataSource = self.pickerView.dataSource == self;
+            id selectedChoice = (isPickerDataSource
+                                 ? [self itemForRow:[self.pickerView selectedRowInComponent:0]]
+                                 : nil);
+
+            // Choices may have been replaced by equal instances or changed in ways affecting
+            // their titles, cached titles are recomputed on demand when the picker is reloaded.
+            [self.choiceList invalidateTitles];
+            BOOL choicesChanged = [self.choiceList updateItems:choices usingBlock:nil];
+
+            [self setNeedsReloadChoices];
+            [self reloadChoicesIfNeeded];
+
+            if (choicesChanged && isPickerDataSource && selectedChoice != nil)
+            {
+                // Keep the selected choice selected if it moved to another row
+                NSInteger row = [self rowForItem:selectedChoice];
+
+                if (row != NSNotFound && row != [self.pickerView selectedRowInComponent:0])
+                {
+                    [self.pickerView selectRow:row inComponent:0 animated:NO];
+                    self.previouslySelectedRow = row;
+                }
+            }
+        }
     }
                             waitForCompletion:NO];
 }
 
+- (NSString*)                                   titleForChoice:(id)choice
+{
+    NSString* result = nil;
+
+    if (self.titleProperty != nil)
+    {
+        choice = [self.titleProperty valueForTarget:choice];
+    }
+
+    if ([choice isKindOfClass:NSString.class])
+    {
+        result = choice;
+    }
+    else if ([choice isKindOfClass:NSObject.class])
+    {
+        result = ((NSObject*)choice).description;
+    }
+
+    return result;
+}
+
 - (void)                                 setNeedsReloadChoices
 {
     _needsReloadChoices = YES;
@@ -310,24 +377,11 @@
     else
     {
         NSInteger index = [self indexForRow:row];
+        AKAChoiceList* choiceList = self.choiceList;
 
-        if (index >= 0 && index < self.choices.count)
+        if (index >= 0 && index < choiceList.count)
         {
-            id choice = self.choices[(NSUInteger)index];
-
-            if (self.titleProperty != nil)
-            {
-                choice = [self.titleProperty valueForTarget:choice];
-            }
-
-            if ([choice isKindOfClass:NSString.class])
-            {
-                result = choice;
-            }
-            else if ([choice isKindOfClass:NSObject.class])
-            {
-                result = ((NSObject*)choice).description;
-            }
+            result = [choiceList titleForItemAtIndex:(NSUInteger)index];
         }
     }
 
@@ -370,7 +424,7 @@
     NSParameterAssert(pickerView == self.pickerView);
     NSParameterAssert(component == 0);
 
-    NSInteger result = (NSInteger)self.choices.count;
+    NSInteger result = (NSInteger)self.choiceList.count;
 
     if (self.supportsUndefinedValue)
     {
@@ -404,7 +458,7 @@
 
 - (NSInteger)                                 rowForOtherValue
 {
-    NSInteger result = self.supportsOtherValue ? (NSInteger)self.choices.count : NSNotFound;
+    NSInteger result = self.supportsOtherValue ? (NSInteger)self.choiceList.count : NSNotFound;
 
     if (result != NSNotFound && self.supportsUndefinedValue)
     {
@@ -532,10 +586,11 @@
     else
     {
         NSInteger index = [self indexForRow:row];
+        AKAChoiceList* choiceList = self.choiceList;
 
-        if (index >= 0 && index < self.choices.count)
+        if (index >= 0 && index < choiceList.count)
         {
-            result = self.choices[(NSUInteger)index];
+            result = [choiceList itemAtIndex:(NSUInteger)index];
         }
     }
 
@@ -545,7 +600,7 @@
 - (NSInteger)                                       rowForItem:(id)item
 {
     NSInteger result = NSNotFound;
-    NSInteger index = (NSInteger)[self.choices indexOfObject:(item == nil ? [NSNull null] : item)];
+    NSInteger index = (NSInteger)[self.choiceList indexOfItem:item];
 
     if (index == NSNotFound)
     {
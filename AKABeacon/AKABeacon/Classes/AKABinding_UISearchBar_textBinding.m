@@ -87,6 +87,16 @@
                                                @"expressionType":      @(AKABindingExpressionTypeBoolean),
                                                @"use":                 @(AKABindingAttributeUseAssignValueToBindingProperty),
                                                @"bindingProperty":     @"showCancelButtonWhileEditiing"
+                                               },
+                                       @"debounce": @{
+                                               @"expressionType":      @(AKABindingExpressionTypeNumber),
+                                               @"use":                 @(AKABindingAttributeUseAssignValueToBindingProperty),
+                                               @"bindingProperty":     @"debounceInterval"
+                                               },
+                                       @"throttle": @{
+                                               @"expressionType":      @(AKABindingExpressionTypeNumber),
+                                               @"use":                 @(AKABindingAttributeUseAssignValueToBindingProperty),
+                                               @"bindingProperty":     @"throttleInterval"
                                                }
                                        }
                                };
@@ -489,7 +499,7 @@
     NSString* oldValue = self.previousText;
     NSString* newValue = self.searchBar.text;
 
-    if (self.liveModelUpdates || !self.searchBar.isFirstResponder)
+    if ((self.liveModelUpdates || !self.searchBar.isFirstResponder) && ![self deferViewValueChange])
     {
         // Send change notification
         if (newValue != oldValue && ![newValue isEqualToString:oldValue])
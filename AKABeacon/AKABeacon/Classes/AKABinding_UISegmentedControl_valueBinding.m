@@ -10,6 +10,7 @@
 
 #import "AKABinding_UISegmentedControl_valueBinding.h"
 #import "AKABinding+DelegateSupport.h"
+#import "AKAChoiceList.h"
 
 #import "AKACollectionControlViewBinding.h"
 #import "AKABindingErrors.h"
@@ -23,6 +24,7 @@
 @property(nonatomic, readonly)       UISegmentedControl*                segmentedControl;
 
 @property(nonatomic)                 NSArray*                           choices;
+@property(nonatomic, readonly)       AKAChoiceList*                     choiceList;
 @property(nonatomic, readonly)       AKAUnboundProperty*                titleProperty;
 @property(nonatomic, readonly)       AKAUnboundProperty*                imageProperty;
 @property(nonatomic)                 NSInteger                          previouslySelectedRow;
@@ -184,9 +186,10 @@
     else if ([targetValue isKindOfClass:[NSNumber class]])
     {
         NSInteger index = [targetValue integerValue];
-        if (index >= 0 && index < self.choices.count)
+        AKAChoiceList* choiceList = self.choiceList;
+        if (index >= 0 && index < choiceList.count)
         {
-            *sourceValueStore = self.choices[(NSUInteger)index];
+            *sourceValueStore = [choiceList itemAtIndex:(NSUInteger)index];
         }
         else if (index == NSNotFound)
         {
@@ -195,7 +198,7 @@
         else
         {
             *sourceValueStore = nil;
-            [AKABindingErrors bindingErrorConversionOfBinding:self targetValue:targetValue failedWithRangeError:NSMakeRange(0, self.choices.count)];
+            [AKABindingErrors bindingErrorConversionOfBinding:self targetValue:targetValue failedWithRangeError:NSMakeRange(0, choiceList.count)];
         }
     }
     else
@@ -225,7 +228,7 @@
     }
     else
     {
-        NSUInteger index = [self.choices indexOfObject:(req_id)sourceValue];
+        NSUInteger index = [self.choiceList indexOfItem:sourceValue];
 
         *targetValueStore = index == NSNotFound ? nil : @((NSInteger)index);
     }
@@ -271,6 +274,28 @@
     return (UISegmentedControl*)result;
 }
 
+@synthesize choices = _choices;
+- (void)                                           setChoices:(NSArray*)choices
+{
+    _choices = choices;
+
+    if (_choiceList.items != choices)
+    {
+        _choiceList = nil;
+    }
+}
+
+@synthesize choiceList = _choiceList;
+- (AKAChoiceList*)                                 choiceList
+{
+    if (_choiceList == nil)
+    {
+        _choiceList = [[AKAChoiceList alloc] initWithItems:self.choices];
+    }
+
+    return _choiceList;
+}
+
 @synthesize titleProperty = _titleProperty;
 - (AKAUnboundProperty*)                         titleProperty
 {
@@ -418,77 +443,44 @@
 
         NSInteger placeholderContentSection = 0;
 
-        // Remove items no longer in new items collection
-        NSMutableArray* oldItems = nil;
-
-        if (actualItems.count > 0)
-        {
-            oldItems = [NSMutableArray arrayWithArray:actualItems];
-            for (NSInteger i = (NSInteger)oldItems.count - 1; i >= 0; --i)
-            {
-                id oldItem = oldItems[(NSUInteger)i];
-
-                if ([items indexOfObject:oldItem] == NSNotFound)
-                {
-                    [oldItems removeObjectAtIndex:(NSUInteger)i];
-
-                    NSIndexPath* oldItemIndexPath = [NSIndexPath indexPathForRow:i
-                                                                       inSection:placeholderContentSection];
-                    [self binding:binding sourceController:self.sourceValueProperty
-                      deletedItem:oldItem
-                      atIndexPath:oldItemIndexPath];
-                }
-            }
-        }
-        else
+        // Segments are updated one change at a time, in the order the choice list reports them.
+        AKAChoiceList* segments = [[AKAChoiceList alloc] initWithItems:actualItems];
+        [segments updateItems:items usingBlock:
+         ^(AKAChoiceListChangeType type, id item, NSUInteger fromIndex, NSUInteger toIndex)
+         {
+             switch (type)
+             {
+                 case AKAChoiceListChangeTypeDelete:
+                     [self binding:binding sourceController:self.sourceValueProperty
+                       deletedItem:item
+                       atIndexPath:[NSIndexPath indexPathForRow:(NSInteger)fromIndex
+                                                      inSection:placeholderContentSection]];
+                     break;
+
+                 case AKAChoiceListChangeTypeInsert:
+                     [self binding:binding sourceController:self.sourceValueProperty
+                      insertedItem:item
+                       atIndexPath:[NSIndexPath indexPathForRow:(NSInteger)toIndex
+                                                      inSection:placeholderContentSection]];
+                     break;
+
+                 case AKAChoiceListChangeTypeMove:
+                     [self binding:binding sourceController:self.sourceValueProperty
+                         movedItem:item
+                     fromIndexPath:[NSIndexPath indexPathForRow:(NSInteger)fromIndex
+                                                      inSection:placeholderContentSection]
+                       toIndexPath:[NSIndexPath indexPathForRow:(NSInteger)toIndex
+                                                      inSection:placeholderContentSection]];
+                     break;
+             }
+         }];
+
+        if (items == self.choices)
         {
-            oldItems = NSMutableArray.new;
+            // Reuse the index built for the update
+            _choiceList = segments;
         }
 
-        // Process insertions and movements
-        NSUInteger insertedItemCount = 0;
-
-        for (NSInteger i = 0; i < ((NSArray*)items).count; ++i)
-        {
-            id item = ((NSArray*)items)[(NSUInteger)i];
-            NSUInteger oldIndex = [oldItems indexOfObject:item];
-
-            NSIndexPath* itemIndexPath = [NSIndexPath indexPathForRow:i
-                                                            inSection:placeholderContentSection];
-            // TODO: consider manipulating oldItems to match changes
-            if (oldIndex == NSNotFound)
-            {
-                [self binding:binding sourceController:self.sourceValueProperty
-                 insertedItem:item
-                  atIndexPath:itemIndexPath];
-                ++insertedItemCount;
-            }
-            else if (oldIndex + insertedItemCount != i)
-            {
-                NSAssert(oldIndex + insertedItemCount > i, @"");
-
-                [oldItems removeObjectAtIndex:oldIndex];
-
-                NSIndexPath* itemOldIndexPath =
-                [NSIndexPath indexPathForRow:(NSInteger)(oldIndex + insertedItemCount)
-                                   inSection:placeholderContentSection];
-
-                [self binding:binding sourceController:self.sourceValueProperty
-                    movedItem:item
-                fromIndexPath:itemOldIndexPath
-                  toIndexPath:itemIndexPath];
-                ++insertedItemCount;
-            }
-            else
-            {
-                /*
-                [self binding:binding sourceController:self.sourceValueProperty
-                  updatedItem:items[(NSUInteger)itemIndexPath.row]
-                  atIndexPath:itemIndexPath];
-                 */
-            }
-        }
-        
         [self binding:binding sourceControllerDidChangeContent:self.sourceValueProperty];
     }
 }
@@ -7,6 +7,8 @@
 //
 
 #import "AKAArrayComparer.h"
+#import "AKALog.h"
+#import "AKAMainThreadWatchdog.h"
 @import CoreData;
 
 #import "AKABinding_UITableView_dataSourceBinding.h"
@@ -31,6 +33,7 @@
 #import "AKATableViewCellFactory.h"
 #import "AKATableViewSectionDataSourceInfoPropertyBinding.h"
 #import "AKATableViewDataSourceAndDelegateDispatcher.h"
+#import "AKATableViewItemIndex.h"
 
 #import "AKABindingController+ChildBindingControllers.h"
 
@@ -52,6 +55,7 @@
 @property(nonatomic, readonly) NSArray<AKATableViewSectionDataSourceInfo*>* sections;
 @property(nonatomic) AKABindingExpressionEvaluator*                         defaultCellMapping;
 @property(nonatomic) id                                                     selectedItem;
+@property(nonatomic) NSArray*                                               selectedItems;
 @property(nonatomic) UITableViewRowAnimation                                insertAnimation;
 @property(nonatomic) UITableViewRowAnimation                                updateAnimation;
 @property(nonatomic) UITableViewRowAnimation                                deleteAnimation;
@@ -87,6 +91,10 @@
 @property(nonatomic) BOOL                                                   applySelectionsDispatched;
 @property(nonatomic) NSMutableDictionary<NSNumber*, AKAArrayComparer*>*     pendingTableViewChanges;
 
+#pragma mark - Item Lookup
+
+@property(nonatomic, readonly) AKATableViewItemIndex*                       itemIndex;
+
 @end
 
 
@@ -121,6 +129,10 @@
                                                @"bindingType":         [AKAPropertyBinding class],
                                                @"use":                 @(AKABindingAttributeUseBindToBindingProperty)
                                                },
+                                       @"selectedItems": @{
+                                               @"bindingType":         [AKAPropertyBinding class],
+                                               @"use":                 @(AKABindingAttributeUseBindToBindingProperty)
+                                               },
                                        @"dynamic":             @{
                                                @"bindingType":         [AKATableViewSectionDataSourceInfoPropertyBinding class],
                                                @"use":                 @(AKABindingAttributeUseAssignExpressionToBindingProperty),
@@ -171,6 +183,7 @@
     if (self = [super init])
     {
         _pendingTableViewChanges = [NSMutableDictionary new];
+        _itemIndex = [AKATableViewItemIndex new];
 
         _deleteAnimation = UITableViewRowAnimationAutomatic;
         _insertAnimation = UITableViewRowAnimationAutomatic;
@@ -243,6 +256,12 @@
                                                                                                        delegateOverwrites:binding];
                 }
 
+                // selectedItems expects the table view to support multiple selections.
+                if (binding.bindingExpression.attributes[@"selectedItems"] != nil)
+                {
+                    tableView.allowsMultipleSelection = YES;
+                }
+
                 return YES;
             }
 
@@ -265,6 +284,7 @@
                            binding.dynamicSectionsSource = nil;
                            [self removeArrayItemBindings];
                        }
+                       [binding.itemIndex invalidateAll];
 
                        // Reload tableView to let original delegate take over (if defined, otherwise
                        // the table will be empty.
@@ -416,7 +436,10 @@
     }
 
     self.dynamicSectionsSource = newSourceValue;
-    
+
+    // Sections have been updated in place, relocated sections keep their rows index.
+    [self.itemIndex invalidateSections];
+
     for (AKABinding* binding in stoppedBindings)
     {
         [binding startObservingChanges];
@@ -429,6 +452,17 @@
     }
 }
 
+- (void)                             targetArrayItemAtIndex:(NSUInteger)index
+                                                      value:(opt_id)oldValue
+                                                didChangeTo:(opt_id)newValue
+{
+    // A section info has been replaced
+    [self.itemIndex invalidateRowsForSectionInfo:oldValue];
+    [self.itemIndex invalidateSections];
+
+    [super targetArrayItemAtIndex:index value:oldValue didChangeTo:newValue];
+}
+
 
 #pragma mark - Properties
 
@@ -447,6 +481,19 @@
     return result;
 }
 
+@synthesize itemIndex = _itemIndex;
+- (AKATableViewItemIndex*)                         itemIndex
+{
+    // Static sections are provided lazily and dynamic sections are (re)created when observation
+    // starts, so the index has to pick up the current sections array on demand:
+    NSArray* sections = self.sections;
+    if (_itemIndex.sections != sections)
+    {
+        _itemIndex.sections = sections;
+    }
+    return _itemIndex;
+}
+
 #pragma mark - Change Tracking
 
 - (BOOL)stopObservingChanges
@@ -525,6 +572,12 @@
     // Do not update if the binding is starting to observe changes (a table view reload will be
     // performed when start is completed).
     // Also do not update if target value did not change (assuming immutable arrays)
+    // The item index is invalidated in any case, since it's not rebuilt by table view reloads.
+    if ([binding isKindOfClass:[AKAArrayPropertyBinding class]])
+    {
+        [self.itemIndex invalidateRowsForSectionInfo:[self sectionInfoForArrayBinding:(id)binding]];
+    }
+
     if (!self.startingChangeObservation)
     {
         if (oldTargetValue != newTargetValue)
@@ -539,12 +592,7 @@
                         AKAArrayPropertyBinding* apBinding = (id)binding;
                         if (!apBinding.generateContentChangeEventsForSourceArrayChanges)
                         {
-                            NSUInteger section = NSNotFound;
-                            id value = sectionBinding.targetValueProperty.value;
-                            if (value)
-                            {
-                                section = [self.sections indexOfObject:value];
-                            }
+                            NSUInteger section = [self.itemIndex indexOfSectionInfo:sectionBinding.targetValueProperty.value];
 
                             NSAssert(section != NSNotFound, @"Section info not found");
                             
@@ -642,38 +690,20 @@
 
 #pragma mark - Selections
 
-- (void)                            enumerateItemsWithBlock:(void(^)(NSUInteger section, NSUInteger row, id item, outreq_BOOL stop))block
+- (void)                                    setSelectedItem:(id)selectedItem
 {
-    if (block != NULL)
+    if (_selectedItem != selectedItem)
     {
-        BOOL stop = NO;
-        UITableView* tableView = self.tableView;
-        NSUInteger sectionCount = [self numberOfSectionsInTableView:tableView];
-
-        if (sectionCount == self.sections.count)
-        {
-            for (NSUInteger section = 0; !stop && section < sectionCount; ++section)
-            {
-                AKATableViewSectionDataSourceInfo* sectionInfo = [self tableView:tableView infoForSection:section];
-                NSUInteger rowCount = [tableView numberOfRowsInSection:section];
-                if (sectionInfo.rows.count == rowCount)
-                {
-                    for (NSUInteger row = 0; !stop && row < rowCount; ++row)
-                    {
-                        id item = sectionInfo.rows[row];
-                        block(section, row, item, &stop);
-                    }
-                }
-            }
-        }
+        _selectedItem = selectedItem;
     }
+    [self dispatchApplySelections];
 }
 
-- (void)                                    setSelectedItem:(id)selectedItem
+- (void)                                   setSelectedItems:(NSArray*)selectedItems
 {
-    if (_selectedItem != selectedItem)
+    if (_selectedItems != selectedItems)
     {
-        _selectedItem = selectedItem;
+        _selectedItems = selectedItems;
     }
     [self dispatchApplySelections];
 }
@@ -702,23 +732,68 @@
     }
 }
 
+- (NSIndexPath*)                     indexPathForSelectedItem:(id)item
+{
+    NSIndexPath* result = [self.itemIndex indexPathForItem:item];
+
+    if (result)
+    {
+        // Skip items which are not yet known to the table view (pending updates will apply
+        // selections once performed).
+        UITableView* tableView = self.tableView;
+        if (result.section >= tableView.numberOfSections ||
+            result.row >= [tableView numberOfRowsInSection:result.section])
+        {
+            result = nil;
+        }
+    }
+
+    return result;
+}
+
 - (void)                            applySelectionsAnimated:(BOOL)animated
-                                             scrollPosition:(UITableViewScrollPosition)scrollPosition
+                                             scrollPosition:(UITableViewScrollPosition __unused)scrollPosition
 {
-    // TODO: support multiple selections
-    if (self.selectedItem)
+    NSArray* selectedItems = self.selectedItems;
+
+    if (self.selectedItem || selectedItems)
     {
-        //[self removeSelectionsAnimated:animated];
-        [self enumerateItemsWithBlock:^(NSUInteger section, NSUInteger row, id item, BOOL * _Nonnull stop) {
-            if (self.selectedItem == item)
+        UITableView* tableView = self.tableView;
+        NSMutableSet<NSIndexPath*>* selectedIndexPaths = [NSMutableSet new];
+
+        NSIndexPath* indexPath = [self indexPathForSelectedItem:self.selectedItem];
+        if (indexPath)
+        {
+            [selectedIndexPaths addObject:indexPath];
+        }
+        for (id item in selectedItems)
+        {
+            indexPath = [self indexPathForSelectedItem:item];
+            if (indexPath)
             {
-                NSIndexPath* indexPath = [NSIndexPath indexPathForRow:(NSInteger)row inSection:(NSInteger)section];
-                [self.tableView selectRowAtIndexPath:indexPath
-                                            animated:animated
-                                      scrollPosition:UITableViewScrollPositionNone];
-                *stop = YES;
+                [selectedIndexPaths addObject:indexPath];
             }
-        }];
+        }
+
+        // If selectedItems is bound, it defines the selection of the table view. Otherwise
+        // selections made by the user are preserved.
+        if (selectedItems)
+        {
+            for (NSIndexPath* selectedIndexPath in tableView.indexPathsForSelectedRows)
+            {
+                if (![selectedIndexPaths containsObject:selectedIndexPath])
+                {
+                    [tableView deselectRowAtIndexPath:selectedIndexPath animated:animated];
+                }
+            }
+        }
+
+        for (NSIndexPath* selectedIndexPath in selectedIndexPaths)
+        {
+            [tableView selectRowAtIndexPath:selectedIndexPath
+                                   animated:animated
+                             scrollPosition:UITableViewScrollPositionNone];
+        }
     }
 }
 
@@ -839,6 +914,7 @@
         [self.pendingTableViewChanges removeAllObjects];
 
         void (^block)() = ^{
+            uint64_t watchdogStart = AKAMainThreadWatchdogBeginSpan();
             UITableView* tableView = self.tableView;
             if (tableView)
             {
@@ -857,6 +933,7 @@
 //                    });
 //                }
             }
+            AKAMainThreadWatchdogEndSpan(watchdogStart, __PRETTY_FUNCTION__, self);
         };
 
         // Wrap reload in an animator block - if defined. This can be used to synchronize table view
@@ -879,6 +956,7 @@
     if (self.tableViewUpdateDispatched)
     {
         void (^block)() = ^{
+            uint64_t watchdogStart = AKAMainThreadWatchdogBeginSpan();
             UITableView* tableView = self.tableView;
             if (tableView)
             {
@@ -909,6 +987,7 @@
 //                    });
 //                }
             }
+            AKAMainThreadWatchdogEndSpan(watchdogStart, __PRETTY_FUNCTION__, self);
         };
 
         // Wrap updates in an animator block - if defined. This can be used to synchronize table view
@@ -949,8 +1028,9 @@
     {
         // TODO: defer updates if scrolling
 
-        NSInteger section = (NSInteger)[self.sections indexOfObject:sectionInfo];
+        NSInteger section = (NSInteger)[self.itemIndex indexOfSectionInfo:sectionInfo];
         NSAssert(section != NSNotFound, @"Invalid section info %@: not found in %@", sectionInfo, self.sections);
+        [self.itemIndex invalidateRowsForSectionInfo:sectionInfo];
 
         [self.tableView insertRowsAtIndexPaths:@[ [NSIndexPath indexPathForRow:(NSInteger)index inSection:section] ]
                               withRowAnimation:self.insertAnimation];
@@ -969,8 +1049,9 @@
     {
         // TODO: defer updates if scrolling
 
-        NSInteger section = (NSInteger)[self.sections indexOfObject:sectionInfo];
+        NSInteger section = (NSInteger)[self.itemIndex indexOfSectionInfo:sectionInfo];
         NSAssert(section != NSNotFound, @"Invalid section info %@: not found in %@", sectionInfo, self.sections);
+        [self.itemIndex invalidateRowsForSectionInfo:sectionInfo];
 
         [self.tableView reloadRowsAtIndexPaths:@[ [NSIndexPath indexPathForRow:(NSInteger)index inSection:section] ]
                               withRowAnimation:self.updateAnimation];
@@ -989,8 +1070,9 @@
     {
         // TODO: defer updates if scrolling
 
-        NSInteger section = (NSInteger)[self.sections indexOfObject:sectionInfo];
+        NSInteger section = (NSInteger)[self.itemIndex indexOfSectionInfo:sectionInfo];
         NSAssert(section != NSNotFound, @"Invalid section info %@: not found in %@", sectionInfo, self.sections);
+        [self.itemIndex invalidateRowsForSectionInfo:sectionInfo];
 
         [self.tableView deleteRowsAtIndexPaths:@[ [NSIndexPath indexPathForRow:(NSInteger)index inSection:section] ]
                               withRowAnimation:self.deleteAnimation];
@@ -1010,8 +1092,9 @@
     {
         // TODO: defer updates if scrolling
 
-        NSInteger section = (NSInteger)[self.sections indexOfObject:sectionInfo];
+        NSInteger section = (NSInteger)[self.itemIndex indexOfSectionInfo:sectionInfo];
         NSAssert(section != NSNotFound, @"Invalid section info %@: not found in %@", sectionInfo, self.sections);
+        [self.itemIndex invalidateRowsForSectionInfo:sectionInfo];
 
         [self.tableView moveRowAtIndexPath:[NSIndexPath indexPathForRow:(NSInteger)oldIndex inSection:section]
                                toIndexPath:[NSIndexPath indexPathForRow:(NSInteger)newIndex inSection:section]];
@@ -1092,13 +1175,15 @@
 
     AKATableViewSectionDataSourceInfo* sectionInfo = [self tableView:tableView infoForSection:section];
     NSInteger result = (NSInteger)sectionInfo.rows.count;
-   NSLog(@"AKABinding_UITableView_dataSourceBinding | numberOfRowsInSection: %ld = %ld", (long)section, (long)result);
+    AKALogVerboseC(TableView, @"numberOfRowsInSection: %ld = %ld", (long)section, (long)result);
     return result;
 }
 
 - (UITableViewCell*)                              tableView:(UITableView*)tableView
                                       cellForRowAtIndexPath:(NSIndexPath*)indexPath
 {
+    uint64_t watchdogStart = AKAMainThreadWatchdogBeginSpan();
+
     AKATableViewSectionDataSourceInfo* sectionInfo = [self tableView:tableView infoForSection:indexPath.section];
     id item = sectionInfo.rows[(NSUInteger)indexPath.row];
 
@@ -1117,6 +1202,8 @@
         result = [self.delegateDispatcher.originalDataSource tableView:tableView cellForRowAtIndexPath:indexPath];
     }
 
+    AKAMainThreadWatchdogEndSpan(watchdogStart, __PRETTY_FUNCTION__, self);
+
     return result;
 }
 
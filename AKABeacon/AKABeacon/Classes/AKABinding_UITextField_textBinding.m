@@ -8,6 +8,7 @@
 
 #import "AKABinding_UITextField_textBinding.h"
 #import "AKABindingErrors.h"
+#import "AKAConversionCache.h"
 
 #import "AKAFormatterPropertyBinding.h"
 #import "AKANumberFormatterPropertyBinding.h"
@@ -24,6 +25,14 @@
 @property(nonatomic, nullable) NSString*                   previousText;
 @property(nonatomic) BOOL useEditingFormat;
 
+#pragma mark - Conversion Cache
+
+// Conversions using the display and editing format are cached separately, since the same formatter
+// can produce different texts in both modes.
+@property(nonatomic, readonly) AKAConversionCache*         conversionCache;
+@property(nonatomic, readonly) AKAConversionCache*         editingConversionCache;
+@property(nonatomic, readonly) AKAConversionCache*         activeConversionCache;
+
 #pragma mark - Convenience
 
 @property(nonatomic, readonly) UITextField*                textField;
@@ -36,6 +45,9 @@
 
 @implementation AKABinding_UITextField_textBinding
 
+@synthesize conversionCache = _conversionCache;
+@synthesize editingConversionCache = _editingConversionCache;
+
 #pragma mark - Specification
 
 + (AKABindingSpecification*)                 specification
@@ -89,6 +101,16 @@
                     @"expressionType":      @(AKABindingExpressionTypeBoolean),
                     @"use":                 @(AKABindingAttributeUseAssignValueToBindingProperty),
                     @"bindingProperty":     @"treatEmptyTextAsUndefined"
+                },
+                @"debounce": @{
+                    @"expressionType":      @(AKABindingExpressionTypeNumber),
+                    @"use":                 @(AKABindingAttributeUseAssignValueToBindingProperty),
+                    @"bindingProperty":     @"debounceInterval"
+                },
+                @"throttle": @{
+                    @"expressionType":      @(AKABindingExpressionTypeNumber),
+                    @"use":                 @(AKABindingAttributeUseAssignValueToBindingProperty),
+                    @"bindingProperty":     @"throttleInterval"
                 }
             }
         };
@@ -228,16 +250,30 @@
         if (self.useEditingFormat && self.editingFormatter)
         {
             formatter = self.editingFormatter;
-            result = [formatter getObjectValue:sourceValueStore
-                                     forString:(req_id)targetValue
-                              errorDescription:&errorDescription];
         }
         else if (self.formatter)
         {
             formatter = self.formatter;
-            result = [formatter getObjectValue:sourceValueStore
-                                     forString:(req_id)targetValue
-                              errorDescription:&errorDescription];
+        }
+
+        if (formatter)
+        {
+            AKAConversionCache* cache = self.activeConversionCache;
+            result = [cache lookupValue:sourceValueStore
+                                forText:targetValue
+                                context:formatter];
+            if (!result)
+            {
+                result = [formatter getObjectValue:sourceValueStore
+                                         forString:(req_id)targetValue
+                                  errorDescription:&errorDescription];
+                if (result)
+                {
+                    [cache recordValue:*sourceValueStore
+                               forText:targetValue
+                               context:formatter];
+                }
+            }
         }
         else
         {
@@ -292,25 +328,37 @@
         NSFormatter* formatter = nil;
         NSString* text = nil;
 
+        AKAConversionCache* cache = self.activeConversionCache;
+
         if (self.useEditingFormat && self.editingFormatter)
         {
             formatter = self.editingFormatter;
-            text = [formatter stringForObjectValue:(req_id)effectiveSourceValue];
+            if (![cache lookupText:&text forValue:effectiveSourceValue context:formatter])
+            {
+                text = [formatter stringForObjectValue:(req_id)effectiveSourceValue];
+                [cache recordText:text forValue:effectiveSourceValue context:formatter];
+            }
             result = text != nil;
         }
         else if (self.formatter)
         {
             formatter = self.formatter;
 
-            if (self.useEditingFormat)
+            if ([cache lookupText:&text forValue:effectiveSourceValue context:formatter])
+            {
+                result = text != nil;
+            }
+            else if (self.useEditingFormat)
             {
                 text = [formatter editingStringForObjectValue:(req_id)effectiveSourceValue];
                 result = text != nil;
+                [cache recordText:text forValue:effectiveSourceValue context:formatter];
             }
             else
             {
                 text = [self.formatter stringForObjectValue:(req_id)effectiveSourceValue];
                 result = text != nil;
+                [cache recordText:text forValue:effectiveSourceValue context:formatter];
             }
         }
         else
@@ -345,8 +393,51 @@
     return result;
 }
 
+#pragma mark - Conversion Cache
+
+- (AKAConversionCache*)                    conversionCache
+{
+    if (_conversionCache == nil)
+    {
+        _conversionCache = [AKAConversionCache new];
+    }
+    return _conversionCache;
+}
+
+- (AKAConversionCache*)             editingConversionCache
+{
+    if (_editingConversionCache == nil)
+    {
+        _editingConversionCache = [AKAConversionCache new];
+    }
+    return _editingConversionCache;
+}
+
+- (AKAConversionCache*)              activeConversionCache
+{
+    return self.useEditingFormat ? self.editingConversionCache : self.conversionCache;
+}
+
+- (void)                      invalidateConversionCaches
+{
+    [_conversionCache invalidate];
+    [_editingConversionCache invalidate];
+}
+
 #pragma mark - Properties
 
+- (void)                                      setFormatter:(NSFormatter*)formatter
+{
+    _formatter = formatter;
+    [self invalidateConversionCaches];
+}
+
+- (void)                               setEditingFormatter:(NSFormatter*)editingFormatter
+{
+    _editingFormatter = editingFormatter;
+    [self invalidateConversionCaches];
+}
+
 - (UITextField*)                                 textField
 {
     UIView* view = self.target;
@@ -567,7 +658,7 @@
     NSString* oldValue = self.previousText;
     NSString* newValue = self.textField.text;
 
-    if (self.liveModelUpdates || !self.textField.isFirstResponder)
+    if ((self.liveModelUpdates || !self.textField.isFirstResponder) && ![self deferViewValueChange])
     {
         // Send change notification
         if (newValue != oldValue && ![newValue isEqualToString:oldValue])
@@ -584,6 +675,29 @@
     }
 }
 
+#pragma mark - Binding Delegate implementation
+
+- (BOOL)                shouldReceiveDelegateMessagesForSubBindings
+{
+    return YES;
+}
+
+- (BOOL)      shouldReceiveDelegateMessagesForTransitiveSubBindings
+{
+    return YES;
+}
+
+- (void)                                           binding:(req_AKABinding __unused)binding
+                                      didUpdateTargetValue:(opt_id __unused)oldTargetValue
+                                                        to:(opt_id __unused)newTargetValue
+                                            forSourceValue:(opt_id __unused)oldSourceValue
+                                                  changeTo:(opt_id __unused)newSourceValue
+{
+    // Formatter property bindings update formatters in place if formatter attributes are bound,
+    // cached conversions might no longer be valid.
+    [self invalidateConversionCaches];
+}
+
 #pragma mark - Keyboard Activation Sequence
 
 - (BOOL)     shouldParticipateInKeyboardActivationSequence
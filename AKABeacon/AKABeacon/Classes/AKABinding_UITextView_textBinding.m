@@ -43,7 +43,19 @@
         NSDictionary* spec =
         @{ @"bindingType":          [AKABinding_UITextView_textBinding class],
            @"targetType":           [UITextView class],
-           @"expressionType":       @(AKABindingExpressionTypeString)
+           @"expressionType":       @(AKABindingExpressionTypeString),
+           @"attributes":
+               @{ @"debounce":
+                      @{ @"expressionType":  @(AKABindingExpressionTypeNumber),
+                         @"use":             @(AKABindingAttributeUseAssignValueToBindingProperty),
+                         @"bindingProperty": @"debounceInterval"
+                         },
+                  @"throttle":
+                      @{ @"expressionType":  @(AKABindingExpressionTypeNumber),
+                         @"use":             @(AKABindingAttributeUseAssignValueToBindingProperty),
+                         @"bindingProperty": @"throttleInterval"
+                         }
+                  }
            };
 
         result = [[AKABindingSpecification alloc] initWithDictionary:spec basedOn:[super specification]];
@@ -147,17 +159,20 @@
     NSString* oldValue = self.previousText;
     NSString* newValue = self.textView.text;
 
-    // Send change notification
-    if (newValue != oldValue && ![newValue isEqualToString:oldValue])
+    if (![self deferViewValueChange])
     {
-        [self targetValueDidChangeFromOldValue:oldValue toNewValue:newValue];
-        newValue = self.textView.text; // the delegate may change the value
-    }
+        // Send change notification
+        if (newValue != oldValue && ![newValue isEqualToString:oldValue])
+        {
+            [self targetValueDidChangeFromOldValue:oldValue toNewValue:newValue];
+            newValue = self.textView.text; // the delegate may change the value
+        }
 
-    if (newValue != oldValue && ![newValue isEqualToString:oldValue])
-    {
-        [self.targetValueProperty notifyPropertyValueDidChangeFrom:oldValue to:newValue];
-        self.previousText = newValue;
+        if (newValue != oldValue && ![newValue isEqualToString:oldValue])
+        {
+            [self.targetValueProperty notifyPropertyValueDidChangeFrom:oldValue to:newValue];
+            self.previousText = newValue;
+        }
     }
 }
 
@@ -350,7 +365,8 @@
         [secondary textViewDidEndEditing:textView];
     }
 
-    if (!self.liveModelUpdates)
+    // Debounced or throttled changes are committed immediately
+    if (!self.liveModelUpdates || self.hasDeferredViewValueChange)
     {
         [self viewValueDidChange];
     }
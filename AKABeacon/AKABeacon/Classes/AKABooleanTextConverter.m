@@ -8,6 +8,13 @@
 
 #import "AKABooleanTextConverter.h"
 #import "AKABeaconErrors_Internal.h"
+#import "AKAConversionCache.h"
+
+@interface AKABooleanTextConverter()
+
+@property(nonatomic, readonly) AKAConversionCache* conversionCache;
+
+@end
 
 @implementation AKABooleanTextConverter
 
@@ -24,6 +31,12 @@
         _textForYes = textForYes;
         _textForNo = textForNo;
         _textForUndefined = textForUndefined;
+        if (baseConverter)
+        {
+            // Texts are looked up without conversion, only conversions involving the base converter
+            // are worth caching.
+            _conversionCache = [AKAConversionCache new];
+        }
     }
     return self;
 }
@@ -47,13 +60,15 @@
     BOOL result = YES;
     id booleanValue = modelValue;
 
-    if (self.baseConverter)
+    BOOL cached = [self.conversionCache lookupText:viewValueStorage forValue:modelValue context:nil];
+
+    if (self.baseConverter && !cached)
     {
         result = [self.baseConverter convertModelValue:modelValue
                                            toViewValue:&booleanValue
                                                  error:error];
     }
-    if (result)
+    if (result && !cached)
     {
         if (booleanValue == nil || [booleanValue isKindOfClass:[NSNull class]])
         {
@@ -64,6 +79,7 @@
             *viewValueStorage = (((NSNumber*)booleanValue).boolValue
                                  ? self.textForYes
                                  : self.textForNo);
+            [self.conversionCache recordText:*viewValueStorage forValue:modelValue context:nil];
         }
         else
         {
@@ -137,9 +153,16 @@
     {
         if (self.baseConverter)
         {
-            result = [self.baseConverter convertViewValue:modelValue
-                                             toModelValue:modelValueStorage
-                                                    error:error];
+            if (![self.conversionCache lookupValue:modelValueStorage forText:viewValue context:nil])
+            {
+                result = [self.baseConverter convertViewValue:modelValue
+                                                 toModelValue:modelValueStorage
+                                                        error:error];
+                if (result)
+                {
+                    [self.conversionCache recordValue:*modelValueStorage forText:viewValue context:nil];
+                }
+            }
         }
         else
         {
@@ -0,0 +1,77 @@
+//
+//  AKAChoiceList.h
+//  AKABeacon
+//
+//  Created by Michael Utech on 19.10.16.
+//  Copyright © 2016 Michael Utech & AKA Sarl. All rights reserved.
+//
+
+@import Foundation;
+
+#import "AKANullability.h"
+
+@class AKAChoiceList;
+#define req_AKAChoiceList AKAChoiceList*_Nonnull
+#define opt_AKAChoiceList AKAChoiceList*_Nullable
+
+typedef NS_ENUM(NSUInteger, AKAChoiceListChangeType)
+{
+    AKAChoiceListChangeTypeDelete,
+    AKAChoiceListChangeTypeInsert,
+    AKAChoiceListChangeTypeMove
+};
+
+/**
+ Reports a single change of a choice list. Changes are reported in an order in which they can be applied one by one to a view displaying the choices (like removing, inserting and moving segments of a segmented control): Deletions come first in descending order of their old index (fromIndex). Insertions and moves follow in ascending order of their new index (toIndex), the fromIndex of moved items refers to the position of the item after all previously reported changes have been applied.
+
+ Indexes which do not apply to a change type (toIndex for deletions, fromIndex for insertions) are NSNotFound.
+ */
+typedef void(^AKAChoiceListChangeBlock)(AKAChoiceListChangeType type,
+                                        req_id                  item,
+                                        NSUInteger              fromIndex,
+                                        NSUInteger              toIndex);
+
+typedef opt_NSString(^AKAChoiceListTitleProvider)(req_id item);
+
+
+/**
+ Model of the choices of selection control view bindings (picker views, segmented controls).
+
+ Looking up the index of an item uses a hash index (items are compared using isEqual: like indexOfObject: does, the first occurrence of duplicate items wins). Titles are computed on demand using the titleProvider and cached per item. Updating the items computes the differences to the previous items in linear time (plus logarithmic time per moved item) and preserves the cached titles of items which are still present.
+ */
+@interface AKAChoiceList: NSObject
+
+- (instancetype _Nonnull)                        initWithItems:(opt_NSArray)items;
+
+@property(nonatomic, readonly, nonnull) NSArray*                    items;
+
+@property(nonatomic, readonly) NSUInteger                           count;
+
+/**
+ Computes the title of an item when it's requested for the first time. If no title provider is defined, the item itself is used if it is a string and its description otherwise.
+ */
+@property(nonatomic, copy, nullable) AKAChoiceListTitleProvider     titleProvider;
+
+- (req_id)                                       itemAtIndex:(NSUInteger)index;
+
+/**
+ Returns the index of the first item equal to the specified item or NSNotFound if the item is not a choice. Nil is treated as NSNull.
+ */
+- (NSUInteger)                                   indexOfItem:(opt_id)item;
+
+- (opt_NSString)                         titleForItemAtIndex:(NSUInteger)index;
+
+- (void)                                    invalidateTitles;
+
+/**
+ Replaces the items of the choice list.
+
+ @param items the new items.
+ @param block called for each change in the order defined by AKAChoiceListChangeBlock, the choice list still reports its previous items while changes are reported. Differences are not computed if block is nil.
+
+ @return YES if the new items are different from the previous items.
+ */
+- (BOOL)                                         updateItems:(opt_NSArray)items
+                                                  usingBlock:(AKAChoiceListChangeBlock _Nullable)block;
+
+@end
@@ -0,0 +1,264 @@
+//
+//  AKAChoiceList.m
+//  AKABeacon
+//
+//  Created by Michael Utech on 19.10.16.
+//  Copyright © 2016 Michael Utech & AKA Sarl. All rights reserved.
+//
+
+#import "AKAChoiceList.h"
+
+
+#pragma mark - Static Helpers
+#pragma mark -
+
+/**
+ Maps items to the index of their first occurrence. Map tables use the object personality, items are compared using isEqual: and hash and, unlike dictionary keys, they do not have to conform to NSCopying.
+ */
+static NSMapTable<id, NSNumber*>* akaChoiceListIndexItems(NSArray* items)
+{
+    NSMapTable<id, NSNumber*>* result = [NSMapTable strongToStrongObjectsMapTable];
+
+    [items enumerateObjectsUsingBlock:^(id item, NSUInteger idx, BOOL * _Nonnull stop __unused) {
+        if ([result objectForKey:item] == nil)
+        {
+            [result setObject:@(idx) forKey:item];
+        }
+    }];
+
+    return result;
+}
+
+/*
+ The positions of items which have not yet been moved to their final position are tracked in a binary indexed tree (Fenwick tree) over the retained items, in which each entry is 1 as long as the corresponding item has not been placed.
+ */
+
+static NSUInteger akaChoiceListUnplacedCountBefore(const NSUInteger* tree, NSUInteger index)
+{
+    NSUInteger result = 0;
+
+    for (NSUInteger i = index; i > 0; i -= i & (~i + 1))
+    {
+        result += tree[i];
+    }
+
+    return result;
+}
+
+static void akaChoiceListMarkPlaced(NSUInteger* tree, NSUInteger count, NSUInteger index)
+{
+    for (NSUInteger i = index + 1; i <= count; i += i & (~i + 1))
+    {
+        tree[i] -= 1;
+    }
+}
+
+
+#pragma mark - AKAChoiceList - Private Interface
+#pragma mark -
+
+@interface AKAChoiceList()
+
+@property(nonatomic) NSMapTable<id, NSNumber*>*                     indexes;
+@property(nonatomic) NSMapTable<id, id>*                            titles;
+
+@end
+
+
+#pragma mark - AKAChoiceList - Implementation
+#pragma mark -
+
+@implementation AKAChoiceList
+
+#pragma mark - Initialization
+
+- (instancetype)init
+{
+    return [self initWithItems:nil];
+}
+
+- (instancetype)initWithItems:(opt_NSArray)items
+{
+    if (self = [super init])
+    {
+        _items = items ? [items copy] : @[];
+        _indexes = akaChoiceListIndexItems(_items);
+        _titles = [NSMapTable strongToStrongObjectsMapTable];
+    }
+    return self;
+}
+
+#pragma mark - Properties
+
+- (NSUInteger)count
+{
+    return self.items.count;
+}
+
+- (void)setTitleProvider:(AKAChoiceListTitleProvider)titleProvider
+{
+    _titleProvider = [titleProvider copy];
+    [self invalidateTitles];
+}
+
+#pragma mark - Items
+
+- (req_id)itemAtIndex:(NSUInteger)index
+{
+    return self.items[index];
+}
+
+- (NSUInteger)indexOfItem:(opt_id)item
+{
+    NSNumber* index = [self.indexes objectForKey:(item == nil ? [NSNull null] : item)];
+
+    return index == nil ? NSNotFound : index.unsignedIntegerValue;
+}
+
+#pragma mark - Titles
+
+- (opt_NSString)titleForItemAtIndex:(NSUInteger)index
+{
+    id item = self.items[index];
+    id result = [self.titles objectForKey:item];
+
+    if (result == nil)
+    {
+        if (self.titleProvider != nil)
+        {
+            result = self.titleProvider(item);
+        }
+        else if ([item isKindOfClass:[NSString class]])
+        {
+            result = item;
+        }
+        else
+        {
+            result = [item description];
+        }
+
+        [self.titles setObject:(result ?: [NSNull null]) forKey:item];
+    }
+
+    return result == [NSNull null] ? nil : result;
+}
+
+- (void)invalidateTitles
+{
+    [self.titles removeAllObjects];
+}
+
+#pragma mark - Updates
+
+- (BOOL)updateItems:(opt_NSArray)items
+         usingBlock:(AKAChoiceListChangeBlock)block
+{
+    NSArray* oldItems = self.items;
+    NSArray* newItems = items ? [items copy] : @[];
+
+    BOOL result = !(newItems == oldItems || [newItems isEqualToArray:oldItems]);
+
+    if (result)
+    {
+        NSMapTable<id, NSNumber*>* newIndexes = akaChoiceListIndexItems(newItems);
+
+        if (block != nil)
+        {
+            [self enumerateChangesFromItems:oldItems
+                                    indexes:self.indexes
+                                    toItems:newItems
+                                    indexes:newIndexes
+                                 usingBlock:block];
+        }
+
+        // Keep the titles of items which are still present
+        NSMapTable<id, id>* titles = [NSMapTable strongToStrongObjectsMapTable];
+        for (id item in self.titles)
+        {
+            if ([newIndexes objectForKey:item] != nil)
+            {
+                [titles setObject:[self.titles objectForKey:item] forKey:item];
+            }
+        }
+
+        _items = newItems;
+        self.indexes = newIndexes;
+        self.titles = titles;
+    }
+
+    return result;
+}
+
+- (void)enumerateChangesFromItems:(NSArray*)oldItems
+                          indexes:(NSMapTable<id, NSNumber*>*)oldIndexes
+                          toItems:(NSArray*)newItems
+                          indexes:(NSMapTable<id, NSNumber*>*)newIndexes
+                       usingBlock:(AKAChoiceListChangeBlock)block
+{
+    if (oldIndexes.count != oldItems.count || newIndexes.count != newItems.count)
+    {
+        // Items are not unique and cannot be identified, replace all of them
+        for (NSUInteger i = oldItems.count; i > 0; --i)
+        {
+            block(AKAChoiceListChangeTypeDelete, oldItems[i - 1], i - 1, NSNotFound);
+        }
+        for (NSUInteger i = 0; i < newItems.count; ++i)
+        {
+            block(AKAChoiceListChangeTypeInsert, newItems[i], NSNotFound, i);
+        }
+    }
+    else
+    {
+        NSMutableArray* retainedItems = [NSMutableArray arrayWithCapacity:oldItems.count];
+        for (NSUInteger i = oldItems.count; i > 0; --i)
+        {
+            id item = oldItems[i - 1];
+
+            if ([newIndexes objectForKey:item] == nil)
+            {
+                block(AKAChoiceListChangeTypeDelete, item, i - 1, NSNotFound);
+            }
+        }
+        for (id item in oldItems)
+        {
+            if ([newIndexes objectForKey:item] != nil)
+            {
+                [retainedItems addObject:item];
+            }
+        }
+        NSMapTable<id, NSNumber*>* retainedIndexes = akaChoiceListIndexItems(retainedItems);
+
+        // The items at positions below i are in their final position, the remaining retained items follow in their original order.
+        NSUInteger retainedCount = retainedItems.count;
+        NSMutableData* treeStorage = [NSMutableData dataWithLength:(retainedCount + 1) * sizeof(NSUInteger)];
+        NSUInteger* tree = treeStorage.mutableBytes;
+        for (NSUInteger i = 1; i <= retainedCount; ++i)
+        {
+            tree[i] = i & (~i + 1);
+        }
+
+        for (NSUInteger i = 0; i < newItems.count; ++i)
+        {
+            id item = newItems[i];
+            NSNumber* retainedIndex = [retainedIndexes objectForKey:item];
+
+            if (retainedIndex == nil)
+            {
+                block(AKAChoiceListChangeTypeInsert, item, NSNotFound, i);
+            }
+            else
+            {
+                NSUInteger index = retainedIndex.unsignedIntegerValue;
+                NSUInteger position = i + akaChoiceListUnplacedCountBefore(tree, index);
+
+                if (position != i)
+                {
+                    block(AKAChoiceListChangeTypeMove, item, position, i);
+                }
+                akaChoiceListMarkPlaced(tree, retainedCount, index);
+            }
+        }
+    }
+}
+
+@end
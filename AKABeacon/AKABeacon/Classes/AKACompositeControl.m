@@ -14,6 +14,15 @@
 #import "AKATableViewCellCompositeControl.h"
 #import "AKAControl_Internal.h"
 #import "AKAControlViewProtocol.h"
+#import "AKABindingExpression+Accessors.h"
+
+typedef NS_OPTIONS(NSUInteger, AKACompositeControlViewTraits)
+{
+    AKACompositeControlViewTraitControlView = 1 << 0,
+    AKACompositeControlViewTraitToolbar = 1 << 1,
+    AKACompositeControlViewTraitOpaqueContainer = 1 << 2
+};
+
 
 @interface AKACompositeControl ()
 
@@ -474,7 +483,21 @@
 {
     NSUInteger __block count = 0;
 
-    if (![childControllerViews containsObject:rootView])
+    // Exclusions are tested for every visited view, an identity hash table avoids linear searches
+    // (and isEqual: calls) for each of them.
+    NSHashTable* excludedViews = nil;
+    if (childControllerViews.count > 0)
+    {
+        excludedViews = [[NSHashTable alloc] initWithOptions:(NSPointerFunctionsOpaqueMemory |
+                                                              NSPointerFunctionsObjectPointerPersonality)
+                                                    capacity:childControllerViews.count];
+        for (UIView* view in (req_NSArray)childControllerViews)
+        {
+            [excludedViews addObject:view];
+        }
+    }
+
+    if (![excludedViews containsObject:rootView])
     {
         [self beginInsertingControls];
         [rootView aka_enumerateSelfAndSubviewsUsingBlock:
@@ -482,8 +505,9 @@
          {
              (void)stop; // not used
 
-             BOOL excludeView = [childControllerViews containsObject:view];
-             BOOL createControl = [view conformsToProtocol:@protocol(AKAControlViewProtocol)];
+             AKACompositeControlViewTraits traits = [AKACompositeControl viewTraitsForClass:[view class]];
+             BOOL excludeView = excludedViews != nil && [excludedViews containsObject:view];
+             BOOL createControl = (traits & AKACompositeControlViewTraitControlView) != 0;
 
              if (excludeView)
              {
@@ -523,12 +547,12 @@
                      [self addBindingsForView:view];
                  }
              }
-             else
+             else if ([AKABindingExpression hasBindingExpressionsForTarget:view])
              {
                  [self addBindingsForView:view];
              }
 
-             if ([view isKindOfClass:[UIToolbar class]])
+             if (traits & AKACompositeControlViewTraitToolbar)
              {
                  UIToolbar* toolbar = (id)view;
                  [toolbar.items enumerateObjectsUsingBlock:
@@ -540,6 +564,11 @@
                       [self addBindingsForView:(id)item];
                   }];
              }
+
+             if (traits & AKACompositeControlViewTraitOpaqueContainer)
+             {
+                 *doNotDescend = YES;
+             }
          }];
         [self endInsertingControls];
     }
@@ -547,6 +576,73 @@
     return count;
 }
 
+/**
+ Determines the traits of the specified view class relevant for scanning view hierarchies. Results are cached per class, since checking for protocol conformance is comparatively expensive and view hierarchies typically consist of a small number of distinct view classes.
+ */
++ (AKACompositeControlViewTraits)viewTraitsForClass:(Class)viewClass
+{
+    NSAssert([NSThread isMainThread], @"Invalid attempt to scan view hierarchies outside of main thread");
+
+    static NSMutableDictionary* traitsByClass;
+    static NSArray<Class>* opaqueContainerTypes;
+    static NSBundle* uikitBundle;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        traitsByClass = [NSMutableDictionary new];
+        // UIKit views whose subviews are private implementation details. Interface builder
+        // does not support adding subviews to them and they do not define binding expressions for
+        // their private subviews.
+        opaqueContainerTypes = @[ [UIControl class],
+                                  [UILabel class],
+                                  [UIImageView class],
+                                  [UITextView class],
+                                  [UIProgressView class],
+                                  [UIActivityIndicatorView class],
+                                  [UIPickerView class],
+                                  [UISearchBar class],
+                                  [UINavigationBar class],
+                                  [UITabBar class] ];
+        uikitBundle = [NSBundle bundleForClass:[UIView class]];
+    });
+
+    AKACompositeControlViewTraits result = 0;
+
+    NSNumber* cached = traitsByClass[viewClass];
+    if (cached)
+    {
+        result = cached.unsignedIntegerValue;
+    }
+    else
+    {
+        if ([viewClass conformsToProtocol:@protocol(AKAControlViewProtocol)])
+        {
+            result |= AKACompositeControlViewTraitControlView;
+        }
+        if ([viewClass isSubclassOfClass:[UIToolbar class]])
+        {
+            result |= AKACompositeControlViewTraitToolbar;
+        }
+
+        // Only UIKit classes are considered opaque, subclasses defined elsewhere might add subviews.
+        // UIControl itself is often used as plain container view.
+        if (viewClass != [UIControl class] && [NSBundle bundleForClass:viewClass] == uikitBundle)
+        {
+            for (Class type in opaqueContainerTypes)
+            {
+                if ([viewClass isSubclassOfClass:type])
+                {
+                    result |= AKACompositeControlViewTraitOpaqueContainer;
+                    break;
+                }
+            }
+        }
+
+        traitsByClass[(id<NSCopying>)viewClass] = @(result);
+    }
+
+    return result;
+}
+
 - (NSUInteger)autoAddControlsForControlViewSubviewsInViewHierarchy:(UIView*)controlView
                                                       excludeViews:(opt_NSArray)childControllerViews
 {
@@ -16,6 +16,11 @@
 @property(nonatomic, readonly, nullable) NSPredicate* predicate;
 @property(nonatomic, readonly, nullable) AKABinding*  binding;
 
+/**
+ Determines whether the clause's predicate is currently observed. Predicates are only observed for clauses up to and including the active clause (or for all clauses if none is active), because changes of later predicates cannot affect the selection of the active clause.
+ */
+@property(nonatomic, readonly) BOOL                   isObservingPredicate;
+
 @end
 
 
@@ -29,6 +29,8 @@
 
 @property(nonatomic) AKABinding*                    binding;
 
+@property(nonatomic) BOOL                           isObservingPredicate;
+
 @end
 
 @implementation AKAConditionalBindingClause
@@ -45,6 +47,15 @@
 @property(nonatomic) AKAProperty*                   effectiveBindingTarget;
 @property(nonatomic) BOOL isObservingChanges;
 
+/// Set while binding source observation is active; predicates are only observed (lazily) while this is set.
+@property(nonatomic) BOOL isObservingPredicates;
+
+/// The number of leading clauses whose predicates are observed.
+@property(nonatomic) NSUInteger observedPredicateCount;
+
+/// Set while clauses are evaluated, predicate changes resulting from starting predicate observation are ignored.
+@property(nonatomic) BOOL isSelectingClause;
+
 @end
 
 
@@ -279,33 +290,88 @@
     return self;
 }
 
-- (void)                predicateForClause:(AKAConditionalBindingClause*)clause
+- (void)                predicateForClause:(AKAConditionalBindingClause* __unused)clause
                                    atIndex:(NSUInteger)index
                                changedFrom:(NSPredicate* __unused)oldPredicate
-                                        to:(NSPredicate*)newPredicate
+                                        to:(NSPredicate* __unused)newPredicate
 {
-    if (self.activeClause && index <= self.activeClause.expressionClauseIndex)
+    if (!self.isSelectingClause)
     {
-        if ([newPredicate evaluateWithObject:self.sourceValueProperty.value])
+        // Only predicates of clauses up to the active clause are observed, a change can thus always
+        // affect the selection. If no clause is active, all predicates are observed.
+        AKAConditionalBindingClause* activeClause = self.activeClause;
+        if (activeClause == nil || index <= activeClause.expressionClauseIndex)
         {
-            self.activeClause = clause;
+            self.activeClause = [self clauseForSourceValue:self.sourceValueProperty.value];
         }
-        else
+    }
+}
+
+#pragma mark - Clause Selection
+
+- (AKAConditionalBindingClause*)clauseForSourceValue:(id)sourceValue
+{
+    AKAConditionalBindingClause* result = nil;
+
+    BOOL wasSelectingClause = self.isSelectingClause;
+    self.isSelectingClause = YES;
+
+    NSUInteger count = self.clauses.count;
+    for (NSUInteger index = 0; index < count && result == nil; ++index)
+    {
+        if (self.isObservingPredicates)
         {
-            for (NSUInteger i = index + 1; i < self.clauses.count; ++i)
-            {
-                AKAConditionalBindingClause* nextClause = self.clauses[i];
-
-                if ([nextClause.predicate evaluateWithObject:self.sourceValueProperty.value])
-                {
-                    self.activeClause = nextClause;
-                    break;
-                }
-            }
+            // Starting observation updates the clause's predicate, which might be outdated if it was not observed.
+            [self startObservingPredicatesUpToClauseAtIndex:index];
+        }
+
+        AKAConditionalBindingClause* clause = self.clauses[index];
+        if ([clause.predicate evaluateWithObject:sourceValue])
+        {
+            result = clause;
         }
     }
+
+    if (self.isObservingPredicates && result != nil)
+    {
+        // Predicates following the selected clause cannot affect the selection and stay dormant
+        // until the selection moves past them.
+        [self stopObservingPredicatesFromClauseAtIndex:result.expressionClauseIndex + 1];
+    }
+
+    self.isSelectingClause = wasSelectingClause;
+
+    return result;
 }
 
+- (void)startObservingPredicatesUpToClauseAtIndex:(NSUInteger)index
+{
+    NSUInteger count = self.clauses.count;
+    while (self.observedPredicateCount <= index && self.observedPredicateCount < count)
+    {
+        AKAConditionalBindingClause* clause = self.clauses[self.observedPredicateCount];
+        self.observedPredicateCount += 1;
+
+        // The $else clause does not have a predicate binding
+        [clause.predicateBinding startObservingChanges];
+        clause.isObservingPredicate = YES;
+    }
+}
+
+- (void)stopObservingPredicatesFromClauseAtIndex:(NSUInteger)index
+{
+    while (self.observedPredicateCount > index)
+    {
+        self.observedPredicateCount -= 1;
+        AKAConditionalBindingClause* clause = self.clauses[self.observedPredicateCount];
+
+        [clause.predicateBinding stopObservingChanges];
+        clause.isObservingPredicate = NO;
+    }
+}
+
+#pragma mark - Binding Type Validation
+
 - (BOOL) validateBindingTypeWithExpression:(opt_AKABindingExpression)bindingExpression
                                      error:(out_NSError)error
 {
@@ -367,16 +433,7 @@
 {
     BOOL result = YES;
 
-    AKAConditionalBindingClause* targetValue = nil;
-
-    for (AKAConditionalBindingClause* clause in self.clauses)
-    {
-        if ([clause.predicate evaluateWithObject:sourceValue])
-        {
-            targetValue = clause;
-            break;
-        }
-    }
+    AKAConditionalBindingClause* targetValue = [self clauseForSourceValue:sourceValue];
 
     if (targetValueStore)
     {
@@ -396,19 +453,15 @@
 
 - (void)   willStartObservingBindingSource
 {
-    for (AKAConditionalBindingClause* clause in self.clauses)
-    {
-        [clause.predicateBinding startObservingChanges];
-    }
+    // Predicates are observed lazily when clauses are evaluated (see clauseForSourceValue:)
+    self.isObservingPredicates = YES;
     [super willStartObservingBindingSource];
 }
 
 - (void)     didStopObservingBindingSource
 {
-    for (AKAConditionalBindingClause* clause in self.clauses)
-    {
-        [clause.predicateBinding stopObservingChanges];
-    }
+    self.isObservingPredicates = NO;
+    [self stopObservingPredicatesFromClauseAtIndex:0];
     self.activeClause = nil;
     [super didStopObservingBindingSource];
 }
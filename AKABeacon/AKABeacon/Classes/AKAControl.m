@@ -143,7 +143,7 @@
     }
 }
 
-static NSString* const kRegisteredControlKey = @"aka_control";
+static char kRegisteredControlKey;
 
 - (BOOL)registerControlInControlView:(UIView*)view
 {
@@ -152,19 +152,19 @@ static NSString* const kRegisteredControlKey = @"aka_control";
     if (result)
     {
         [view aka_setAssociatedValue:[AKAWeakReference weakReferenceTo:self]
-                              forKey:kRegisteredControlKey];
+                        forStaticKey:&kRegisteredControlKey];
     }
     return result;
 }
 
 - (void)unregisterControlFromControlView:(UIView*)view
 {
-    [view aka_removeValueAssociatedWithKey:kRegisteredControlKey];
+    [view aka_removeValueAssociatedWithStaticKey:&kRegisteredControlKey];
 }
 
 + (opt_AKAControl)registeredControlForView:(req_UIView)view
 {
-    id result = [view aka_associatedValueForKey:kRegisteredControlKey];
+    id result = [view aka_associatedValueForStaticKey:&kRegisteredControlKey];
     if ([result isKindOfClass:[AKAWeakReference class]])
     {
         result = ((AKAWeakReference*)result).value;
@@ -0,0 +1,91 @@
+//
+//  AKAConversionCache.h
+//  AKABeacon
+//
+//  Created by Michael Utech on 19.10.16.
+//  Copyright © 2016 Michael Utech & AKA Sarl. All rights reserved.
+//
+
+#import "AKANullability.h"
+
+/**
+ Remembers the results of the most recent conversions between values and their textual representations.
+
+ Bindings displaying values which are refreshed frequently (for example a dashboard updating the same numbers every second) repeatedly convert the same values using the same formatters. A conversion cache holds the last N value to text and text to value conversions, so that repeated conversions are answered without invoking the formatter.
+
+ Values are matched by identity or by equality of values of the same class family (strings, numbers or dates), regardless of their concrete (private) classes. Boolean numbers only match booleans, so that for example @YES and @1 are not confused. Only immutable values (numbers, dates and strings) are cached. Each entry records the context (typically the formatter) used to perform the conversion, entries are only reused for the same context (compared by identity).
+
+ Owners have to invalidate the cache whenever the configuration of a context object changes in place (for example if a formatter property binding updates a property of the formatter). Invalidation increments the generation of the cache and discards all entries.
+
+ Conversion caches are not thread safe, they are intended to be used by the thread performing the conversions of their owner (for bindings, the main thread).
+ */
+@interface AKAConversionCache: NSObject
+
+#pragma mark - Initialization
+
+/**
+ Initializes a conversion cache holding up to the specified number of conversions in each direction.
+ */
+- (req_instancetype)initWithCapacity:(NSUInteger)capacity;
+
+#pragma mark - Configuration
+
+@property(nonatomic, readonly) NSUInteger capacity;
+
+/**
+ Incremented each time the cache is invalidated.
+ */
+@property(nonatomic, readonly) NSUInteger generation;
+
+#pragma mark - Value to Text Conversions
+
+/**
+ Looks up the text previously recorded for the specified value and context.
+
+ @param textStorage storage receiving the text if the lookup succeeds.
+ @param value       the value to convert.
+ @param context     the context (formatter) used for the conversion.
+
+ @return YES if the cache contained a matching conversion.
+ */
+- (BOOL)lookupText:(out_id)textStorage
+          forValue:(opt_id)value
+           context:(opt_id)context;
+
+- (void)recordText:(opt_NSString)text
+          forValue:(opt_id)value
+           context:(opt_id)context;
+
+#pragma mark - Text to Value Conversions
+
+/**
+ Looks up the value previously recorded for the specified text and context.
+
+ @param valueStorage storage receiving the value if the lookup succeeds.
+ @param text         the text to convert.
+ @param context      the context (formatter) used for the conversion.
+
+ @return YES if the cache contained a matching conversion.
+ */
+- (BOOL)lookupValue:(out_id)valueStorage
+            forText:(opt_NSString)text
+            context:(opt_id)context;
+
+- (void)recordValue:(opt_id)value
+            forText:(opt_NSString)text
+            context:(opt_id)context;
+
+#pragma mark - Invalidation
+
+/**
+ Discards all cached conversions and increments the generation.
+ */
+- (void)invalidate;
+
+#pragma mark - Statistics
+
+@property(nonatomic, readonly) NSUInteger hitCount;
+
+@property(nonatomic, readonly) NSUInteger missCount;
+
+@end
@@ -0,0 +1,217 @@
+//
+//  AKAConversionCache.m
+//  AKABeacon
+//
+//  Created by Michael Utech on 19.10.16.
+//  Copyright © 2016 Michael Utech & AKA Sarl. All rights reserved.
+//
+
+#import "AKAConversionCache.h"
+
+
+#pragma mark - AKAConversionCacheEntry
+#pragma mark -
+
+@interface AKAConversionCacheEntry: NSObject
+
+@property(nonatomic) id key;
+@property(nonatomic) id result;
+@property(nonatomic) id context;
+
+@end
+
+@implementation AKAConversionCacheEntry
+@end
+
+
+#pragma mark - AKAConversionCache
+#pragma mark -
+
+@interface AKAConversionCache()
+
+// Entries are ordered from least to most recently used.
+@property(nonatomic, readonly) NSMutableArray<AKAConversionCacheEntry*>* textsByValue;
+@property(nonatomic, readonly) NSMutableArray<AKAConversionCacheEntry*>* valuesByText;
+
+@end
+
+
+@implementation AKAConversionCache
+
+#pragma mark - Initialization
+
+- (instancetype)init
+{
+    return [self initWithCapacity:8];
+}
+
+- (instancetype)initWithCapacity:(NSUInteger)capacity
+{
+    if (self = [super init])
+    {
+        _capacity = capacity;
+        _textsByValue = [NSMutableArray arrayWithCapacity:capacity];
+        _valuesByText = [NSMutableArray arrayWithCapacity:capacity];
+    }
+    return self;
+}
+
+#pragma mark - Value to Text Conversions
+
+- (BOOL)lookupText:(out_id)textStorage
+          forValue:(opt_id)value
+           context:(opt_id)context
+{
+    return [self lookupResult:textStorage
+                       forKey:value
+                      context:context
+                    inEntries:self.textsByValue];
+}
+
+- (void)recordText:(opt_NSString)text
+          forValue:(opt_id)value
+           context:(opt_id)context
+{
+    [self recordResult:text
+                forKey:value
+               context:context
+             inEntries:self.textsByValue];
+}
+
+#pragma mark - Text to Value Conversions
+
+- (BOOL)lookupValue:(out_id)valueStorage
+            forText:(opt_NSString)text
+            context:(opt_id)context
+{
+    return [self lookupResult:valueStorage
+                       forKey:text
+                      context:context
+                    inEntries:self.valuesByText];
+}
+
+- (void)recordValue:(opt_id)value
+            forText:(opt_NSString)text
+            context:(opt_id)context
+{
+    [self recordResult:value
+                forKey:text
+               context:context
+             inEntries:self.valuesByText];
+}
+
+#pragma mark - Invalidation
+
+- (void)invalidate
+{
+    ++_generation;
+    [self.textsByValue removeAllObjects];
+    [self.valuesByText removeAllObjects];
+}
+
+#pragma mark - Implementation
+
++ (BOOL)isCacheableValue:(opt_id)value
+{
+    return ([value isKindOfClass:[NSNumber class]] ||
+            [value isKindOfClass:[NSDate class]] ||
+            [value isKindOfClass:[NSString class]]);
+}
+
+/**
+ * Keys match if they are equal and belong to the same class family. Concrete classes are not compared, since equal values are frequently represented by different private subclasses (f.e. constant, tagged pointer and heap allocated strings). Boolean numbers are equal to the numbers 0 and 1 but are converted differently, they only match booleans.
+ */
++ (BOOL)isKey:(req_id)key matchingKey:(req_id)otherKey
+{
+    BOOL result = key == otherKey;
+
+    if (!result)
+    {
+        for (Class family in @[ [NSString class], [NSNumber class], [NSDate class] ])
+        {
+            if ([key isKindOfClass:family])
+            {
+                result = [otherKey isKindOfClass:family] && [key isEqual:otherKey];
+                if (result && family == [NSNumber class])
+                {
+                    result = ((CFGetTypeID((__bridge CFTypeRef)key) == CFBooleanGetTypeID()) ==
+                              (CFGetTypeID((__bridge CFTypeRef)otherKey) == CFBooleanGetTypeID()));
+                }
+                break;
+            }
+        }
+    }
+
+    return result;
+}
+
+- (BOOL)lookupResult:(out_id)resultStorage
+              forKey:(opt_id)key
+             context:(opt_id)context
+           inEntries:(NSMutableArray<AKAConversionCacheEntry*>*)entries
+{
+    BOOL result = NO;
+
+    if (key != nil && entries.count > 0)
+    {
+        for (NSUInteger i = entries.count; !result && i > 0; --i)
+        {
+            AKAConversionCacheEntry* entry = entries[i - 1];
+            if (entry.context == context && [AKAConversionCache isKey:(req_id)key matchingKey:entry.key])
+            {
+                result = YES;
+                if (resultStorage)
+                {
+                    *resultStorage = entry.result;
+                }
+                if (i < entries.count)
+                {
+                    [entries removeObjectAtIndex:i - 1];
+                    [entries addObject:entry];
+                }
+            }
+        }
+    }
+
+    if (result)
+    {
+        ++_hitCount;
+    }
+    else
+    {
+        ++_missCount;
+    }
+
+    return result;
+}
+
+- (void)recordResult:(opt_id)result
+              forKey:(opt_id)key
+             context:(opt_id)context
+           inEntries:(NSMutableArray<AKAConversionCacheEntry*>*)entries
+{
+    if (self.capacity > 0 &&
+        [AKAConversionCache isCacheableValue:key] &&
+        [AKAConversionCache isCacheableValue:result])
+    {
+        AKAConversionCacheEntry* entry = nil;
+        if (entries.count >= self.capacity)
+        {
+            entry = entries.firstObject;
+            [entries removeObjectAtIndex:0];
+        }
+        else
+        {
+            entry = [AKAConversionCacheEntry new];
+        }
+
+        // Strings might be mutable, copies are cheap for immutable strings
+        entry.key = [key isKindOfClass:[NSString class]] ? [key copy] : key;
+        entry.result = [result isKindOfClass:[NSString class]] ? [result copy] : result;
+        entry.context = context;
+
+        [entries addObject:entry];
+    }
+}
+
+@end
@@ -118,17 +118,17 @@
                       }
                       if (isRequired && !implementedByDelegates)
                       {
-                          AKALogError(@"None of the delegates {%@} respond to required selector %@ specified in protocol %@, this violates the protocol's contract.",
-                                      [delegates componentsJoinedByString:@", "],
-                                      NSStringFromSelector(selector),
-                                      NSStringFromProtocol(protocolInfo.protocol));
+                          AKALogErrorC(Delegate, @"None of the delegates {%@} respond to required selector %@ specified in protocol %@, this violates the protocol's contract.",
+                                       [delegates componentsJoinedByString:@", "],
+                                       NSStringFromSelector(selector),
+                                       NSStringFromProtocol(protocolInfo.protocol));
                       }
                   }
               }];
 
              if (noConformingDelegate)
              {
-                 AKALogWarn(@"None of the delegates {%@} conform to protocol %@, however the dispatcher %@ is configured to conform to it. This will probably mislead modules using the dispatcher as implementation for this protocol.", [delegates componentsJoinedByString:@", "], NSStringFromProtocol(protocolInfo.protocol), self);
+                 AKALogWarnC(Delegate, @"None of the delegates {%@} conform to protocol %@, however the dispatcher %@ is configured to conform to it. This will probably mislead modules using the dispatcher as implementation for this protocol.", [delegates componentsJoinedByString:@", "], NSStringFromProtocol(protocolInfo.protocol), self);
              }
              [processedProtocols addObject:protocolInfo.protocol];
          }
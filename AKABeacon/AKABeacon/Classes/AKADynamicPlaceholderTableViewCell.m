@@ -40,15 +40,14 @@
 
 - (AKAMutableControlConfiguration*)aka_controlConfiguration
 {
-    NSString* key = NSStringFromSelector(@selector(aka_controlConfiguration));
-    AKAMutableControlConfiguration* result = [self aka_associatedValueForKey:key];
+    AKAMutableControlConfiguration* result = [self aka_associatedValueForStaticKey:@selector(aka_controlConfiguration)];
 
     if (result == nil)
     {
         result = [AKAMutableControlConfiguration new];
         result[kAKAControlTypeKey] = [AKADynamicPlaceholderTableViewCellCompositeControl class];
         result[kAKAControlViewBinding] = NSStringFromSelector(@selector(collectionBinding));
-        [self aka_setAssociatedValue:result forKey:key];
+        [self aka_setAssociatedValue:result forStaticKey:@selector(aka_controlConfiguration)];
     }
 
     return result;
@@ -309,7 +308,7 @@
 
 - (void)                   sourceControllerWillChangeContent:(req_id)sourceDataController
 {
-    NSLog(@"[sourceControllerWillChangeContent:%@]", self);
+    AKALogDebugC(TableView, @"[sourceControllerWillChangeContent:%@]", self);
 
     (void)sourceDataController;
 
@@ -320,7 +319,7 @@
                                                 insertedItem:(opt_id)sourceCollectionItem
                                                  atIndexPath:(req_NSIndexPath)indexPath
 {
-    NSLog(@"[sourceController:%@ insertedItem:%@ atIndexPath:%@]", self, sourceCollectionItem, indexPath);
+    AKALogDebugC(TableView, @"[sourceController:%@ insertedItem:%@ atIndexPath:%@]", self, sourceCollectionItem, indexPath);
     NSParameterAssert(indexPath != nil);
 
     NSParameterAssert(indexPath.section == 0 && indexPath.row >= 0 && indexPath.row != NSNotFound);
@@ -362,7 +361,7 @@
                                                  deletedItem:(opt_id)sourceCollectionItem
                                                  atIndexPath:(req_NSIndexPath)indexPath
 {
-    NSLog(@"[sourceController:%@ deletedItem:%@ atIndexPath:%@]", self, sourceCollectionItem, indexPath);
+    AKALogDebugC(TableView, @"[sourceController:%@ deletedItem:%@ atIndexPath:%@]", self, sourceCollectionItem, indexPath);
 
     NSParameterAssert(indexPath != nil);
     NSParameterAssert(indexPath.section == 0 && indexPath.row >= 0 && indexPath.row != NSNotFound);
@@ -397,7 +396,7 @@
                                                  updatedItem:(opt_id)sourceCollectionItem
                                                  atIndexPath:(req_NSIndexPath)indexPath
 {
-    NSLog(@"[sourceController:%@ updatedItem:%@ atIndexPath:%@]", self, sourceCollectionItem, indexPath);
+    AKALogDebugC(TableView, @"[sourceController:%@ updatedItem:%@ atIndexPath:%@]", self, sourceCollectionItem, indexPath);
 
     NSParameterAssert(indexPath != nil);
     NSParameterAssert(indexPath.section == 0 && indexPath.row >= 0 && indexPath.row != NSNotFound);
@@ -427,7 +426,7 @@
                                                fromIndexPath:(req_NSIndexPath)fromIndexPath
                                                  toIndexPath:(req_NSIndexPath)toIndexPath
 {
-    NSLog(@"[sourceController:%@ movedItem:%@ fromIndexPath:%@ toIndexPath:%@]", self, sourceCollectionItem, fromIndexPath, toIndexPath);
+    AKALogDebugC(TableView, @"[sourceController:%@ movedItem:%@ fromIndexPath:%@ toIndexPath:%@]", self, sourceCollectionItem, fromIndexPath, toIndexPath);
 
     NSParameterAssert(fromIndexPath != nil && toIndexPath != nil);
     NSParameterAssert(fromIndexPath.section == 0 && toIndexPath.section == 0);
@@ -461,7 +460,7 @@
 
 - (void)                    sourceControllerDidChangeContent:(req_id)sourceDataController
 {
-    NSLog(@"[sourceControllerDidChangeContent:%@]", self);
+    AKALogDebugC(TableView, @"[sourceControllerDidChangeContent:%@]", self);
 
 
     id<AKACollectionControlViewBindingDelegate> delegate = self.delegate;
@@ -16,6 +16,10 @@
 
 #import "AKAControl_Internal.h" // TODO: expose constructors and remove this import
 
+// Keys for values associated with member controls
+static char kDataItemKey;
+static char kStrongCellReferenceKey;
+
 
 @implementation AKADynamicPlaceholderTableViewCellCompositeControl
 
@@ -133,7 +137,7 @@
 
     AKACompositeControl* composite = [[AKACompositeControl alloc] initWithDataContext:sourceCollectionItem configuration:nil];
     // keep a strong reference to the item
-    [composite aka_setAssociatedValue:sourceCollectionItem forKey:@"data_item"];
+    [composite aka_setAssociatedValue:sourceCollectionItem forStaticKey:&kDataItemKey];
 
     [self insertControl:composite atIndex:index];
 
@@ -206,7 +210,7 @@
     NSAssert(indexPath.row >= 0, nil);
     AKACompositeControl* memberControl = [self objectInControlsAtIndex:(NSUInteger)indexPath.row];
 
-    UITableViewCell* result = [memberControl aka_associatedValueForKey:@"strongCellReference"];
+    UITableViewCell* result = [memberControl aka_associatedValueForStaticKey:&kStrongCellReferenceKey];
 
     AKABinding_AKADynamicPlaceholderTableViewCell_collectionBinding* collectionBinding = self.collectionBinding;
 
@@ -231,7 +235,7 @@
                                      recursively:YES];
 
             //AKALogDebug(@"Cloned placeholder cell %@ for row at index path %@: %@", self.placeholderCell, indexPath, result);
-            [memberControl aka_setAssociatedValue:result forKey:@"strongCellReference"];
+            [memberControl aka_setAssociatedValue:result forStaticKey:&kStrongCellReferenceKey];
         }
 
         if ([result isKindOfClass:[AKADynamicPlaceholderTableViewCell class]])
@@ -0,0 +1,61 @@
+//
+//  AKAFontCache.h
+//  AKABeacon
+//
+//  Created by Michael Utech on 19.10.16.
+//  Copyright © 2016 Michael Utech & AKA Sarl. All rights reserved.
+//
+
+@import UIKit;
+
+#import "AKANullability.h"
+
+@class AKAFontCache;
+#define req_AKAFontCache AKAFontCache*_Nonnull
+
+#ifndef opt_UIFont
+#define opt_UIFont UIFont*_Nullable
+#endif
+
+
+/**
+ Process wide cache of resolved fonts, used by font bindings and font constant binding expressions to avoid creating font descriptors and matching fonts for each update.
+
+ Fonts are keyed by a base (a font, font descriptor or font attributes dictionary, compared by equality), a textual representation of the customization applied to the base and the current content size category. The cache is invalidated as a whole when the content size category changes. The cache is thread safe.
+ */
+@interface AKAFontCache: NSObject
+
++ (req_AKAFontCache)                                sharedCache;
+
+/**
+ The content size category the cached fonts have been resolved for, nil if no content size category change has been observed since the cache was created.
+ */
+@property(nonatomic, readonly, nullable) NSString*  contentSizeCategory;
+
+@property(nonatomic, readonly) NSUInteger           count;
+
+/**
+ Returns the cached font for the specified base and customization, resolving and caching it using the specified resolver if needed.
+
+ @param base the font, font descriptor or font attributes the font is based on or nil.
+ @param customization a textual representation of the customization applied to the base (which has to be different for different customizations).
+ @param resolver resolves the font, called outside of the cache's lock. Nil results are cached, too.
+
+ @return the font.
+ */
+- (opt_UIFont)                                  fontForBase:(opt_id)base
+                                              customization:(req_NSString)customization
+                                                   resolver:(opt_UIFont(^_Nonnull)(void))resolver;
+
+/**
+ Discards all cached fonts if the content size category changed.
+
+ Bindings are notified about content size category changes by their binding behaviors, which call this method before notifying the bindings (the cache also observes the notification itself, but the order in which observers are notified is not defined).
+
+ @param contentSizeCategory the new content size category.
+ */
+- (void)                      updateForContentSizeCategory:(opt_NSString)contentSizeCategory;
+
+- (void)                                        removeAllFonts;
+
+@end
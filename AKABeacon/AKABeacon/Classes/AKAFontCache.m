@@ -0,0 +1,210 @@
+//
+//  AKAFontCache.m
+//  AKABeacon
+//
+//  Created by Michael Utech on 19.10.16.
+//  Copyright © 2016 Michael Utech & AKA Sarl. All rights reserved.
+//
+
+#import "AKAFontCache.h"
+
+
+/**
+ The cache is not expected to grow beyond a couple of dozen fonts, this limit only protects against unbounded growth caused by bindings to arbitrary fonts.
+ */
+static const NSUInteger kAKAFontCacheCapacity = 512;
+
+
+#pragma mark - AKAFontCacheKey
+#pragma mark -
+
+@interface AKAFontCacheKey: NSObject<NSCopying>
+
+@property(nonatomic, readonly) id           base;
+@property(nonatomic, readonly) NSString*    customization;
+@property(nonatomic, readonly) NSString*    contentSizeCategory;
+
+@end
+
+@implementation AKAFontCacheKey
+{
+    NSUInteger _hash;
+}
+
+- (instancetype)initWithBase:(id)base
+               customization:(NSString*)customization
+         contentSizeCategory:(NSString*)contentSizeCategory
+{
+    if (self = [super init])
+    {
+        _base = base;
+        _customization = customization;
+        _contentSizeCategory = contentSizeCategory;
+
+        // Dictionary hashes only depend on the number of entries, the customization makes up for that.
+        _hash = [base hash] ^ (customization.hash * 31) ^ (contentSizeCategory.hash * 17);
+    }
+    return self;
+}
+
+- (id)copyWithZone:(NSZone* __unused)zone
+{
+    return self;
+}
+
+- (NSUInteger)hash
+{
+    return _hash;
+}
+
+- (BOOL)isEqual:(id)object
+{
+    BOOL result = (object == self);
+
+    if (!result && [object isKindOfClass:[AKAFontCacheKey class]])
+    {
+        AKAFontCacheKey* other = object;
+        result = (_hash == other->_hash &&
+                  (_base == other->_base || [_base isEqual:other->_base]) &&
+                  [_customization isEqualToString:other->_customization] &&
+                  (_contentSizeCategory == other->_contentSizeCategory ||
+                   [_contentSizeCategory isEqualToString:other->_contentSizeCategory]));
+    }
+
+    return result;
+}
+
+@end
+
+
+#pragma mark - AKAFontCache - Private Interface
+#pragma mark -
+
+@interface AKAFontCache()
+
+@property(nonatomic, readonly) NSLock*                                  lock;
+@property(nonatomic, readonly) NSMutableDictionary<AKAFontCacheKey*, id>* fonts;
+
+@end
+
+
+#pragma mark - AKAFontCache - Implementation
+#pragma mark -
+
+@implementation AKAFontCache
+
+@synthesize contentSizeCategory = _contentSizeCategory;
+
+#pragma mark - Initialization
+
++ (req_AKAFontCache)sharedCache
+{
+    static AKAFontCache* result;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        result = [AKAFontCache new];
+    });
+    return result;
+}
+
+- (instancetype)init
+{
+    if (self = [super init])
+    {
+        _lock = [NSLock new];
+        _fonts = [NSMutableDictionary new];
+
+        [[NSNotificationCenter defaultCenter] addObserver:self
+                                                 selector:@selector(contentSizeCategoryDidChange:)
+                                                     name:UIContentSizeCategoryDidChangeNotification
+                                                   object:nil];
+    }
+    return self;
+}
+
+- (void)dealloc
+{
+    [[NSNotificationCenter defaultCenter] removeObserver:self];
+}
+
+#pragma mark - Properties
+
+- (NSString *)contentSizeCategory
+{
+    [self.lock lock];
+    NSString* result = _contentSizeCategory;
+    [self.lock unlock];
+
+    return result;
+}
+
+- (NSUInteger)count
+{
+    [self.lock lock];
+    NSUInteger result = self.fonts.count;
+    [self.lock unlock];
+
+    return result;
+}
+
+#pragma mark - Fonts
+
+- (opt_UIFont)fontForBase:(opt_id)base
+            customization:(req_NSString)customization
+                 resolver:(opt_UIFont(^)(void))resolver
+{
+    [self.lock lock];
+    AKAFontCacheKey* key = [[AKAFontCacheKey alloc] initWithBase:base
+                                                   customization:customization
+                                             contentSizeCategory:_contentSizeCategory];
+    id result = self.fonts[key];
+    [self.lock unlock];
+
+    if (result == nil)
+    {
+        result = resolver();
+
+        [self.lock lock];
+        // Skip if the content size category changed while resolving the font
+        if (key.contentSizeCategory == _contentSizeCategory)
+        {
+            if (self.fonts.count >= kAKAFontCacheCapacity)
+            {
+                [self.fonts removeAllObjects];
+            }
+            self.fonts[key] = result ?: [NSNull null];
+        }
+        [self.lock unlock];
+    }
+
+    return result == [NSNull null] ? nil : result;
+}
+
+#pragma mark - Invalidation
+
+- (void)updateForContentSizeCategory:(opt_NSString)contentSizeCategory
+{
+    [self.lock lock];
+    if (contentSizeCategory == nil ||
+        _contentSizeCategory == nil ||
+        ![contentSizeCategory isEqualToString:(req_NSString)_contentSizeCategory])
+    {
+        _contentSizeCategory = [contentSizeCategory copy];
+        [self.fonts removeAllObjects];
+    }
+    [self.lock unlock];
+}
+
+- (void)removeAllFonts
+{
+    [self.lock lock];
+    [self.fonts removeAllObjects];
+    [self.lock unlock];
+}
+
+- (void)contentSizeCategoryDidChange:(NSNotification*)notification
+{
+    [self updateForContentSizeCategory:notification.userInfo[UIContentSizeCategoryNewValueKey]];
+}
+
+@end
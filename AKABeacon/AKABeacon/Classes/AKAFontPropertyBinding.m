@@ -12,11 +12,37 @@
 #import "AKABinding+DelegateSupport.h"
 
 #import "AKANSEnumerations.h"
+#import "AKAFontCache.h"
+
+
+static void akaAppendFontAttributesCacheKey(NSMutableString* cacheKey, NSDictionary* attributes)
+{
+    for (NSString* key in [attributes.allKeys sortedArrayUsingSelector:@selector(compare:)])
+    {
+        id value = attributes[key];
+        if ([value isKindOfClass:[NSDictionary class]])
+        {
+            [cacheKey appendFormat:@"%@={", key];
+            akaAppendFontAttributesCacheKey(cacheKey, value);
+            [cacheKey appendString:@"};"];
+        }
+        else
+        {
+            [cacheKey appendFormat:@"%@=%@;", key, value];
+        }
+    }
+}
+
 
 @interface AKAFontDescriptorAttributes: NSObject
 
 @property(nonatomic) NSMutableDictionary<NSString*, id>* storage;
 
+/**
+ A textual representation of the storage identifying resolved fonts in the font cache.
+ */
+@property(nonatomic, readonly) NSString* cacheKey;
+
 @property(nonatomic) NSString* family;
 @property(nonatomic) NSString* name;
 @property(nonatomic) NSString* face;
@@ -33,6 +59,8 @@
 
 @implementation AKAFontDescriptorAttributes
 
+@synthesize cacheKey = _cacheKey;
+
 - (instancetype)                              init
 {
     if (self = [super init])
@@ -44,9 +72,23 @@
     return self;
 }
 
+- (NSString*)                             cacheKey
+{
+    if (_cacheKey == nil)
+    {
+        NSMutableString* cacheKey = [NSMutableString new];
+        akaAppendFontAttributesCacheKey(cacheKey, self.storage);
+        _cacheKey = [cacheKey copy];
+    }
+
+    return _cacheKey;
+}
+
 - (void)           setFontDescriptorAttributeValue:(id)value
                                             forKey:(NSString*)key
 {
+    _cacheKey = nil;
+
     if (value == nil)
     {
         [self.storage removeObjectForKey:key];
@@ -117,6 +159,8 @@
 
 - (void)                    setFontDescriptorTrait:(NSString*)traitKey value:(id)value
 {
+    _cacheKey = nil;
+
     if (value == nil)
     {
         [self.storage[UIFontDescriptorTraitsAttribute] removeObjectForKey:traitKey];
@@ -303,14 +347,12 @@
     static dispatch_once_t onceToken;
 
     dispatch_once(&onceToken, ^{
-        [AKABindingExpressionSpecification registerEnumerationType:@"UIFontTextStyle"
-                                                  withValuesByName:[AKANSEnumerations
-                                                                    uifontTextStylesByName]];
-        [AKABindingExpressionSpecification registerOptionsType:@"UIFontDescriptorSymbolicTraits"
-                                              withValuesByName:[AKANSEnumerations uifontDescriptorTraitsByName]];
-        [AKABindingExpressionSpecification registerEnumerationType:@"UIFontWeight"
-                                                  withValuesByName:[AKANSEnumerations
-                                                                    uifontWeightsByName]];
+        [AKABindingExpressionSpecification registerEnumerationTypes:@{ @"UIFontTextStyle":
+                                                                           [AKANSEnumerations uifontTextStylesByName],
+                                                                       @"UIFontWeight":
+                                                                           [AKANSEnumerations uifontWeightsByName] }
+                                                       optionsTypes:@{ @"UIFontDescriptorSymbolicTraits":
+                                                                           [AKANSEnumerations uifontDescriptorTraitsByName] }];
     });
 }
 
@@ -399,6 +441,33 @@
 {
     BOOL result = YES;
 
+    // The source value is only used as base for customization bindings:
+    BOOL isCustomizationBinding = self.isCustomizationBinding;
+    id base = nil;
+    if (isCustomizationBinding &&
+        ([sourceValue isKindOfClass:[UIFontDescriptor class]] ||
+         [sourceValue isKindOfClass:[UIFont class]] ||
+         [sourceValue isKindOfClass:[NSDictionary class]]))
+    {
+        base = sourceValue;
+    }
+
+    NSString* customization = [(isCustomizationBinding ? @"c:" : @"s:")
+                               stringByAppendingString:self.fontDescriptorAttributes.cacheKey];
+
+    *targetValueStore = [[AKAFontCache sharedCache] fontForBase:base
+                                                  customization:customization
+                                                       resolver:
+                         ^UIFont*
+                         {
+                             return [self resolveFontForSourceValue:base];
+                         }];
+
+    return result;
+}
+
+- (UIFont*)                          resolveFontForSourceValue:(id)sourceValue
+{
     UIFontDescriptor* baseDescriptor = nil;
     UIFontDescriptor* descriptor = nil;
     UIFont* font = nil;
@@ -462,9 +531,7 @@
         font = [UIFont fontWithDescriptor:descriptor size:size];
     }
 
-    *targetValueStore = font;
-
-    return result;
+    return font;
 }
 
 #pragma mark - Properties
@@ -204,7 +204,11 @@
 
     if ([memberControl isKindOfClass:[AKAKeyboardControl class]])
     {
-        [self.keyboardActivationSequence update];
+        AKAKeyboardControlViewBinding* binding = ((AKAKeyboardControl*)memberControl).controlViewBinding;
+        if (binding != nil)
+        {
+            [self.keyboardActivationSequence removeItem:(req_AKAKeyboardControlViewBinding)binding];
+        }
     }
 }
 
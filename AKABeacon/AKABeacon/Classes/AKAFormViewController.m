@@ -8,6 +8,7 @@
 
 #import "AKAFormViewController.h"
 #import "AKABindingBehavior.h"
+#import "AKALog.h"
 
 @implementation AKAFormViewController
 
@@ -147,7 +148,7 @@
         }
         else if (subviews.count > 1)
         {
-            NSLog(@"AKAFormViewController: will not automatically inject scroll view (more than one subview in view controllers top level content view). Scrolling in response to keyboard size changes will not be supported. If you need this feature, please add a scrollview and assign it to AKAFormViewController.scrollView outlet or wrap your views in a single UIView below the view controllers top level content view to enable auto injection of a scroll view");
+            AKALogWarnC(Control, @"AKAFormViewController: will not automatically inject scroll view (more than one subview in view controllers top level content view). Scrolling in response to keyboard size changes will not be supported. If you need this feature, please add a scrollview and assign it to AKAFormViewController.scrollView outlet or wrap your views in a single UIView below the view controllers top level content view to enable auto injection of a scroll view");
         }
 
         self.scrollView = scrollView;
@@ -0,0 +1,83 @@
+//
+//  AKAFormatterPool.h
+//  AKABeacon
+//
+//  Created by Michael Utech on 19.10.16.
+//  Copyright © 2016 Michael Utech & AKA Sarl. All rights reserved.
+//
+
+#import "AKANullability.h"
+
+/**
+ Process wide pool of shared formatters.
+
+ Creating and configuring NSNumberFormatter and NSDateFormatter instances is expensive. Formatter property bindings whose configuration is constant (which is the case for most bindings defined in storyboards) obtain their formatters from this pool, so that all bindings using the same configuration share one formatter instance.
+
+ Formatters are identified by their type, their configuration attributes (compared using isEqual:) and the current locale and time zone (so that formatters relying on the defaults are not shared across locale or time zone changes).
+
+ Pooled formatters are considered frozen. Clients must never modify a formatter obtained from the pool; if a customized formatter is needed, clients should copy the pooled formatter.
+
+ The number of pooled formatters is limited by countLimit, least recently used formatters are evicted first. The pool is emptied when the application receives a memory warning.
+
+ The pool is thread safe.
+ */
+@interface AKAFormatterPool: NSObject
+
+#pragma mark - Initialization
+
++ (req_instancetype)sharedPool;
+
+#pragma mark - Accessing Formatters
+
+/**
+ Returns the pooled formatter identified by the specified type and attributes. If the pool does not yet contain a matching formatter, the specified factory is called to create one, which is then added to the pool.
+
+ @param type       the formatter type. This is typically the formatter's class; formatter bindings synthesizing formatters use their binding type.
+ @param attributes the configuration attributes of the formatter. Attribute values are compared using isEqual:.
+ @param factory    creates a formatter configured with the specified attributes if the pool does not yet contain a matching formatter. The factory may return nil (setting *error), in which case nothing is added to the pool.
+ @param error      error details, set if the factory failed to create a formatter.
+
+ @return the shared formatter or nil if the factory failed.
+ */
+- (opt_NSFormatter)formatterOfType:(req_Class)type
+                    withAttributes:(req_NSDictionary)attributes
+                           factory:(opt_NSFormatter(^_Nonnull)(out_NSError error))factory
+                             error:(out_NSError)error;
+
+/**
+ Removes all formatters from the pool. Formatters which are in use remain valid.
+ */
+- (void)removeAllFormatters;
+
+#pragma mark - Capacity
+
+/**
+ The maximum number of pooled formatters, defaults to 128. If the limit is exceeded, least recently used formatters are removed from the pool (they remain valid for their current users).
+ */
+@property(nonatomic) NSUInteger countLimit;
+
+#pragma mark - Statistics
+
+/**
+ The number of formatters currently held by the pool.
+ */
+@property(nonatomic, readonly) NSUInteger count;
+
+/**
+ The number of requests that have been served with an existing formatter.
+ */
+@property(nonatomic, readonly) NSUInteger hitCount;
+
+/**
+ The number of requests that required the creation of a new formatter.
+ */
+@property(nonatomic, readonly) NSUInteger missCount;
+
+/**
+ The ratio of hits to requests, 0 if no requests have been made.
+ */
+@property(nonatomic, readonly) double hitRate;
+
+- (void)resetStatistics;
+
+@end
@@ -0,0 +1,286 @@
+//
+//  AKAFormatterPool.m
+//  AKABeacon
+//
+//  Created by Michael Utech on 19.10.16.
+//  Copyright © 2016 Michael Utech & AKA Sarl. All rights reserved.
+//
+
+@import UIKit;
+
+#import "AKAFormatterPool.h"
+#import "AKAMutableOrderedDictionary.h"
+
+
+/**
+ The default maximum number of pooled formatters. Applications typically use a few dozen formatter configurations, the limit only protects against unbounded growth caused by configurations which are not shared.
+ */
+static const NSUInteger kAKAFormatterPoolDefaultCountLimit = 128;
+
+
+#pragma mark - AKAFormatterPoolKey
+#pragma mark -
+
+@interface AKAFormatterPoolKey: NSObject<NSCopying>
+
+@property(nonatomic, readonly) Class            type;
+@property(nonatomic, readonly) NSString*        localeIdentifier;
+@property(nonatomic, readonly) NSString*        timeZoneName;
+@property(nonatomic, readonly) NSDictionary*    attributes;
+
+@end
+
+@implementation AKAFormatterPoolKey
+{
+    NSUInteger _hash;
+}
+
+- (instancetype)initWithType:(Class)type
+                  attributes:(NSDictionary*)attributes
+{
+    if (self = [super init])
+    {
+        _type = type;
+        _localeIdentifier = [NSLocale currentLocale].localeIdentifier;
+        _timeZoneName = [NSTimeZone defaultTimeZone].name;
+
+        // Attribute values are compared using isEqual:, so that formatters configured with equal
+        // (but not identical) values such as fonts, colors or paragraph styles are shared.
+        _attributes = [attributes copy];
+
+        // Dictionary hashes only depend on the number of entries, entries are combined in an order
+        // independent way instead.
+        __block NSUInteger hash = [type hash] ^ (_localeIdentifier.hash * 31) ^ (_timeZoneName.hash * 17);
+        [_attributes enumerateKeysAndObjectsUsingBlock:^(id key, id value, BOOL* stop) {
+            (void)stop;
+            hash ^= [key hash] + ([value hash] * 31);
+        }];
+        _hash = hash;
+    }
+    return self;
+}
+
+- (id)copyWithZone:(NSZone* __unused)zone
+{
+    return self;
+}
+
+- (NSUInteger)hash
+{
+    return _hash;
+}
+
+- (BOOL)isEqual:(id)object
+{
+    BOOL result = (object == self);
+
+    if (!result && [object isKindOfClass:[AKAFormatterPoolKey class]])
+    {
+        AKAFormatterPoolKey* other = object;
+        result = (_hash == other->_hash &&
+                  _type == other->_type &&
+                  [_localeIdentifier isEqualToString:other->_localeIdentifier] &&
+                  [_timeZoneName isEqualToString:other->_timeZoneName] &&
+                  [_attributes isEqualToDictionary:other->_attributes]);
+    }
+
+    return result;
+}
+
+@end
+
+
+#pragma mark - AKAFormatterPool - Private Interface
+#pragma mark -
+
+@interface AKAFormatterPool()
+
+@property(nonatomic, readonly) NSLock*                                                          lock;
+
+/**
+ Pooled formatters ordered by access, least recently used first.
+ */
+@property(nonatomic, readonly) AKAMutableOrderedDictionary<AKAFormatterPoolKey*, NSFormatter*>* formattersByKey;
+
+@end
+
+
+#pragma mark - AKAFormatterPool - Implementation
+#pragma mark -
+
+@implementation AKAFormatterPool
+
+@synthesize hitCount = _hitCount;
+@synthesize missCount = _missCount;
+@synthesize countLimit = _countLimit;
+
+#pragma mark - Initialization
+
++ (instancetype)sharedPool
+{
+    static AKAFormatterPool* result = nil;
+    static dispatch_once_t onceToken;
+
+    dispatch_once(&onceToken, ^{
+        result = [AKAFormatterPool new];
+    });
+
+    return result;
+}
+
+- (instancetype)init
+{
+    if (self = [super init])
+    {
+        _lock = [NSLock new];
+        _formattersByKey = [AKAMutableOrderedDictionary new];
+        _countLimit = kAKAFormatterPoolDefaultCountLimit;
+
+        [[NSNotificationCenter defaultCenter] addObserver:self
+                                                 selector:@selector(didReceiveMemoryWarning:)
+                                                     name:UIApplicationDidReceiveMemoryWarningNotification
+                                                   object:nil];
+    }
+    return self;
+}
+
+- (void)dealloc
+{
+    [[NSNotificationCenter defaultCenter] removeObserver:self];
+}
+
+- (void)didReceiveMemoryWarning:(NSNotification* __unused)notification
+{
+    [self removeAllFormatters];
+}
+
+#pragma mark - Accessing Formatters
+
+- (opt_NSFormatter)formatterOfType:(req_Class)type
+                    withAttributes:(req_NSDictionary)attributes
+                           factory:(opt_NSFormatter(^)(out_NSError error))factory
+                             error:(out_NSError)error
+{
+    AKAFormatterPoolKey* key = [[AKAFormatterPoolKey alloc] initWithType:type attributes:attributes];
+
+    [self.lock lock];
+    NSFormatter* result = self.formattersByKey[key];
+    if (result)
+    {
+        ++_hitCount;
+
+        // Move the formatter to the end (most recently used)
+        [self.formattersByKey removeObjectForKey:key];
+        self.formattersByKey[key] = result;
+    }
+    else
+    {
+        ++_missCount;
+    }
+    [self.lock unlock];
+
+    if (result == nil)
+    {
+        // Create the formatter outside of the lock, formatter creation is expensive and the factory
+        // may use the pool recursively. If another thread won the race, its formatter is used.
+        NSFormatter* formatter = factory(error);
+
+        if (formatter)
+        {
+            [self.lock lock];
+            result = self.formattersByKey[key];
+            if (result == nil)
+            {
+                result = formatter;
+                self.formattersByKey[key] = formatter;
+                [self evictFormattersExceedingCountLimit];
+            }
+            [self.lock unlock];
+        }
+    }
+
+    return result;
+}
+
+- (void)removeAllFormatters
+{
+    [self.lock lock];
+    [self.formattersByKey removeAllObjects];
+    [self.lock unlock];
+}
+
+#pragma mark - Capacity
+
+- (NSUInteger)countLimit
+{
+    [self.lock lock];
+    NSUInteger result = _countLimit;
+    [self.lock unlock];
+
+    return result;
+}
+
+- (void)setCountLimit:(NSUInteger)countLimit
+{
+    [self.lock lock];
+    _countLimit = countLimit;
+    [self evictFormattersExceedingCountLimit];
+    [self.lock unlock];
+}
+
+- (void)evictFormattersExceedingCountLimit
+{
+    while (self.formattersByKey.count > _countLimit)
+    {
+        [self.formattersByKey removeObjectForKey:[self.formattersByKey keyAtIndex:0]];
+    }
+}
+
+#pragma mark - Statistics
+
+- (NSUInteger)count
+{
+    [self.lock lock];
+    NSUInteger result = self.formattersByKey.count;
+    [self.lock unlock];
+
+    return result;
+}
+
+- (NSUInteger)hitCount
+{
+    [self.lock lock];
+    NSUInteger result = _hitCount;
+    [self.lock unlock];
+
+    return result;
+}
+
+- (NSUInteger)missCount
+{
+    [self.lock lock];
+    NSUInteger result = _missCount;
+    [self.lock unlock];
+
+    return result;
+}
+
+- (double)hitRate
+{
+    [self.lock lock];
+    NSUInteger requests = _hitCount + _missCount;
+    double result = requests > 0 ? (double)_hitCount / (double)requests : 0.0;
+    [self.lock unlock];
+
+    return result;
+}
+
+- (void)resetStatistics
+{
+    [self.lock lock];
+    _hitCount = 0;
+    _missCount = 0;
+    [self.lock unlock];
+}
+
+@end
@@ -17,12 +17,18 @@
 #import "AKABindingSpecification.h"
 #import "AKABindingErrors.h"
 #import "AKANSEnumerations.h"
+#import "AKAFormatterPool.h"
 
 @interface AKAFormatterPropertyBinding()
 
 @property(nonatomic)           id                                  formatterSource;
 @property(nonatomic, readonly) AKABindingExpression*               bindingExpression;
 
+/**
+ The formatter obtained from the shared formatter pool, if the binding's configuration is constant. If defined, formatter attributes are not bound to the (frozen) formatter.
+ */
+@property(nonatomic, nullable) NSFormatter*                        sharedFormatter;
+
 @end
 
 @implementation AKAFormatterPropertyBinding
@@ -98,7 +104,8 @@
 
     if (self.syntheticTargetValue == nil)
     {
-        self.syntheticTargetValue = [self defaultFormatter];
+        self.sharedFormatter = [self sharedFormatterForExpression:bindingExpression];
+        self.syntheticTargetValue = self.sharedFormatter ? self.sharedFormatter : [self defaultFormatter];
     }
 
     AKAProperty* result = [AKAProperty propertyOfWeakKeyValueTarget:self
@@ -107,6 +114,51 @@
     return result;
 }
 
+- (BOOL)    initializeAttributesWithExpression:(req_AKABindingExpression)bindingExpression
+                                         error:(out_NSError)error
+{
+    if (self.sharedFormatter == nil && bindingExpression.expressionType == AKABindingExpressionTypeClassConstant)
+    {
+        self.sharedFormatter = [self sharedFormatterForExpression:bindingExpression];
+    }
+
+    return [super initializeAttributesWithExpression:bindingExpression error:error];
+}
+
+- (BOOL)initializeTargetPropertyBindingAttribute:(NSString *)bindingProperty
+                               withSpecification:(AKABindingAttributeSpecification *)specification
+                             attributeExpression:(req_AKABindingExpression)attributeExpression
+                                           error:(out_NSError)error
+{
+    if (self.sharedFormatter != nil)
+    {
+        // The attribute value has been applied to the shared formatter when it was created.
+        return YES;
+    }
+
+    return [super initializeTargetPropertyBindingAttribute:bindingProperty
+                                         withSpecification:specification
+                                       attributeExpression:attributeExpression
+                                                     error:error];
+}
+
+- (BOOL)initializeTargetPropertyValueAssignmentAttribute:(req_NSString)bindingProperty
+                                       withSpecification:(req_AKABindingAttributeSpecification)specification
+                                     attributeExpression:(req_AKABindingExpression)attributeExpression
+                                                   error:(out_NSError)error
+{
+    if (self.sharedFormatter != nil)
+    {
+        // The attribute value has been applied to the shared formatter when it was created.
+        return YES;
+    }
+
+    return [super initializeTargetPropertyValueAssignmentAttribute:bindingProperty
+                                                 withSpecification:specification
+                                               attributeExpression:attributeExpression
+                                                             error:error];
+}
+
 - (BOOL)initializeUnspecifiedAttribute:(NSString *)attributeName
                    attributeExpression:(req_AKABindingExpression)attributeExpression
                                  error:(out_NSError)error
@@ -141,7 +193,7 @@
         if ([sourceValue isKindOfClass:[NSFormatter class]])
         {
             targetValue = sourceValue;
-            if (targetValue != nil && self.bindingExpression.attributes.count > 0)
+            if (targetValue != nil && targetValue != self.sharedFormatter && self.bindingExpression.attributes.count > 0)
             {
                 // If using an existing formatter and attributes are defined, we copy the formatter
                 // for not to produce potentially unwanted side effects when customizing it.
@@ -156,7 +208,14 @@
 
                 if ([type isSubclassOfClass:[NSFormatter class]])
                 {
-                    targetValue = [[type alloc] init];
+                    if ([self.sharedFormatter isKindOfClass:type])
+                    {
+                        targetValue = self.sharedFormatter;
+                    }
+                    else
+                    {
+                        targetValue = [[type alloc] init];
+                    }
                 }
                 else
                 {
@@ -199,6 +258,153 @@
     return result;
 }
 
+#pragma mark - Shared Formatters
+
+- (opt_NSFormatter)             sharedFormatterForExpression:(req_AKABindingExpression)bindingExpression
+{
+    id<AKABindingContextProtocol> bindingContext = self.bindingContext;
+
+    // Formatters are shared only if they are synthesized by this binding or created from a
+    // constant formatter class.
+    Class type = nil;
+    Class formatterType = nil;
+    if (bindingExpression.class == [AKABindingExpression class] ||
+        bindingExpression.expressionType == AKABindingExpressionTypeNone)
+    {
+        type = self.class;
+    }
+    else if (bindingExpression.expressionType == AKABindingExpressionTypeClassConstant)
+    {
+        id value = [bindingExpression bindingSourceValueInContext:bindingContext];
+        if (value != nil && class_isMetaClass(object_getClass(value)) && [value isSubclassOfClass:[NSFormatter class]])
+        {
+            type = formatterType = value;
+        }
+    }
+
+    if (type == nil)
+    {
+        return nil;
+    }
+
+    // All attributes affecting the formatter have to be constant:
+    AKABindingSpecification* specification = [self.class specification];
+    NSMutableDictionary<NSString*, id>* attributeValues = [NSMutableDictionary new];
+    NSMutableDictionary<NSString*, AKABindingExpression*>* attributeExpressions = [NSMutableDictionary new];
+    NSMutableDictionary<NSString*, AKABindingAttributeSpecification*>* attributeSpecifications = [NSMutableDictionary new];
+    __block BOOL isShareable = YES;
+
+    [((opt_AKABindingExpressionAttributes)bindingExpression.attributes) enumerateKeysAndObjectsUsingBlock:
+     ^(req_NSString attributeName, req_AKABindingExpression attribute, outreq_BOOL stop)
+     {
+         AKABindingAttributeSpecification* attributeSpec =
+            specification.bindingSourceSpecification.attributes[attributeName];
+         if (attributeSpec == nil)
+         {
+             attributeSpec = [self.class defaultAttributeSpecification];
+         }
+
+         switch (attributeSpec.attributeUse)
+         {
+             case AKABindingAttributeUseManually:
+                 // Not applied to the formatter
+                 break;
+
+             case AKABindingAttributeUseBindToTargetProperty:
+             case AKABindingAttributeUseAssignValueToTargetProperty:
+                 if (attribute.isConstant)
+                 {
+                     NSString* property = attributeSpec.bindingPropertyName ? attributeSpec.bindingPropertyName : attributeName;
+                     id value = [attribute bindingSourceValueInContext:bindingContext];
+                     attributeValues[property] = value ? value : [NSNull null];
+                     attributeExpressions[property] = attribute;
+                     attributeSpecifications[property] = attributeSpec;
+                 }
+                 else
+                 {
+                     isShareable = NO;
+                 }
+                 break;
+
+             default:
+                 isShareable = NO;
+                 break;
+         }
+         *stop = !isShareable;
+     }];
+
+    if (!isShareable)
+    {
+        return nil;
+    }
+
+    NSError* error = nil;
+    NSFormatter* result =
+    [[AKAFormatterPool sharedPool] formatterOfType:type
+                                    withAttributes:attributeValues
+                                           factory:
+     ^opt_NSFormatter(out_NSError factoryError)
+     {
+         NSFormatter* formatter = formatterType ? [formatterType new] : [self createMutableFormatter];
+
+         for (NSString* property in attributeValues)
+         {
+             id value = attributeValues[property];
+             if (value == [NSNull null])
+             {
+                 value = nil;
+             }
+
+             Class bindingType = attributeSpecifications[property].bindingType;
+             if (bindingType != nil && bindingType != [AKAPropertyBinding class])
+             {
+                 if (![self convertConstantAttributeValue:&value
+                                          withBindingType:bindingType
+                                      attributeExpression:attributeExpressions[property]
+                                                    error:factoryError])
+                 {
+                     return nil;
+                 }
+             }
+
+             [formatter setValue:value forKeyPath:property];
+         }
+
+         return formatter;
+     }
+                                             error:&error];
+    if (result == nil)
+    {
+        // Fall back to a non-shared formatter, attribute bindings will report the error.
+        AKALogDebug(@"%@: failed to obtain shared formatter: %@", self, error.localizedDescription);
+    }
+
+    return result;
+}
+
+- (BOOL)                   convertConstantAttributeValue:(inout_id)valueStore
+                                         withBindingType:(req_Class)bindingType
+                                     attributeExpression:(req_AKABindingExpression)attributeExpression
+                                                   error:(out_NSError)error
+{
+    // Use a transient binding to perform the same conversion an attribute binding would do
+    NSMutableDictionary* container = [NSMutableDictionary new];
+    AKAProperty* targetProperty = [AKAProperty propertyOfWeakKeyValueTarget:container
+                                                                    keyPath:@"value"
+                                                             changeObserver:nil];
+    AKABinding* binding = [bindingType bindingToTarget:container
+                                   targetValueProperty:targetProperty
+                                        withExpression:attributeExpression
+                                               context:(req_AKABindingContext)self.bindingContext
+                                                 owner:self
+                                              delegate:nil
+                                                 error:error];
+
+    return binding != nil && [binding convertSourceValue:*valueStore
+                                           toTargetValue:valueStore
+                                                   error:error];
+}
+
 #pragma mark - Change Propagation
 
 - (BOOL)           shouldUpdateSourceValueForTargetValue:(opt_id)oldTargetValue
@@ -0,0 +1,100 @@
+//
+//  AKAImageLoader.h
+//  AKABeacon
+//
+//  Created by Michael Utech on 19.10.16.
+//  Copyright © 2016 Michael Utech & AKA Sarl. All rights reserved.
+//
+
+@import UIKit;
+
+#import "AKANullability.h"
+
+#ifndef opt_UIImage
+#define opt_UIImage UIImage*_Nullable
+#endif
+
+@class AKAImageLoader;
+#define req_AKAImageLoader AKAImageLoader*_Nonnull
+
+@class AKAImageLoadRequest;
+#define req_AKAImageLoadRequest AKAImageLoadRequest*_Nonnull
+#define opt_AKAImageLoadRequest AKAImageLoadRequest*_Nullable
+
+typedef void(^AKAImageLoadCompletionBlock)(req_AKAImageLoadRequest request,
+                                           opt_UIImage image);
+
+
+#pragma mark - AKAImageLoadRequest - Interface
+#pragma mark -
+
+/**
+ Identifies an image load started by AKAImageLoader.
+ */
+@interface AKAImageLoadRequest: NSObject
+
+@property(nonatomic, readonly, nonnull) id                      source;
+
+@property(nonatomic, readonly, getter=isCancelled) BOOL         cancelled;
+
+/**
+ Cancels the request. The completion block of a cancelled request will not be called. Loading and decoding is skipped if it did not yet start.
+ */
+- (void)                                                        cancel;
+
+@end
+
+
+#pragma mark - AKAImageLoader - Interface
+#pragma mark -
+
+/**
+ Loads, decodes and downsamples images on a background queue and caches the results in a memory bounded cache which discards least recently used images first.
+
+ Supported sources are image names (NSString, see UIImage imageNamed:), file URLs (NSURL) and images (UIImage). Images are not cached (there is no stable key for them), they are only decoded and downsampled.
+
+ Sizes are specified in points. Images are downsampled (but never upsampled) to the smallest size which covers fillSize and does not exceed maxSize, using the specified scale (the screen scale of the target view) as long as the source image provides enough pixels.
+ */
+@interface AKAImageLoader: NSObject
+
++ (req_AKAImageLoader)                              sharedLoader;
+
+/**
+ The maximum total size in bytes of the decoded images kept in the cache. Defaults to 32 MB.
+ */
+@property(nonatomic) NSUInteger                                 cacheCostLimit;
+
+/**
+ The total size in bytes of the decoded images currently in the cache.
+ */
+@property(nonatomic, readonly) NSUInteger                       cacheCost;
+
+/**
+ Returns the cached image for the specified parameters or nil if no such image is cached. This is safe to call from the main thread, it does not load or decode images.
+
+ @param source the image name or file URL.
+ @param fillSize the size the image should cover; use CGSizeZero if the size is not known.
+ @param maxSize the maximum size of the image, a zero width or height is not limiting.
+ @param scale the scale of the resulting image.
+ */
+- (opt_UIImage)                        cachedImageForSource:(req_id)source
+                                                   fillSize:(CGSize)fillSize
+                                                    maxSize:(CGSize)maxSize
+                                                      scale:(CGFloat)scale;
+
+/**
+ Loads the image for the specified parameters on a background queue, unless it's found in the cache.
+
+ @param completion called asynchronously on the main queue with the image (or nil if it could not be loaded), unless the request has been cancelled.
+
+ @return the request.
+ */
+- (req_AKAImageLoadRequest)              loadImageForSource:(req_id)source
+                                                   fillSize:(CGSize)fillSize
+                                                    maxSize:(CGSize)maxSize
+                                                      scale:(CGFloat)scale
+                                                 completion:(AKAImageLoadCompletionBlock _Nonnull)completion;
+
+- (void)                                        removeAllCachedImages;
+
+@end
@@ -0,0 +1,435 @@
+//
+//  AKAImageLoader.m
+//  AKABeacon
+//
+//  Created by Michael Utech on 19.10.16.
+//  Copyright © 2016 Michael Utech & AKA Sarl. All rights reserved.
+//
+
+@import ImageIO;
+#import <stdatomic.h>
+
+#import "AKAImageLoader.h"
+#import "AKAMutableOrderedDictionary.h"
+
+
+#pragma mark - Decoding
+#pragma mark -
+
+/**
+ Determines the size (in points) of an image of the specified size which covers fillSize and does not exceed maxSize, without enlarging the image.
+ */
+static CGSize akaImageTargetSize(CGSize size, CGSize fillSize, CGSize maxSize)
+{
+    CGFloat factor = 1.0;
+
+    if (size.width > 0 && size.height > 0)
+    {
+        if (fillSize.width > 0 && fillSize.height > 0)
+        {
+            factor = MAX(fillSize.width / size.width, fillSize.height / size.height);
+        }
+        if (maxSize.width > 0)
+        {
+            factor = MIN(factor, maxSize.width / size.width);
+        }
+        if (maxSize.height > 0)
+        {
+            factor = MIN(factor, maxSize.height / size.height);
+        }
+        factor = MIN(factor, 1.0);
+    }
+
+    return CGSizeMake(size.width * factor, size.height * factor);
+}
+
+static BOOL akaImageOrientationIsRotated(UIImageOrientation orientation)
+{
+    return (orientation == UIImageOrientationLeft || orientation == UIImageOrientationLeftMirrored ||
+            orientation == UIImageOrientationRight || orientation == UIImageOrientationRightMirrored);
+}
+
+/**
+ Draws the image into a bitmap context of the target size, which forces the image to be decoded.
+ */
+static UIImage* akaDecodedImage(UIImage* image, CGSize fillSize, CGSize maxSize, CGFloat scale)
+{
+    UIImage* result = image;
+    CGImageRef cgImage = image.CGImage;
+
+    if (cgImage != NULL && image.size.width > 0 && image.size.height > 0)
+    {
+        CGSize size = akaImageTargetSize(image.size, fillSize, maxSize);
+
+        // Use the requested scale unless the image does not provide enough pixels
+        CGFloat resultScale = MIN(scale, image.scale * image.size.width / size.width);
+        size_t width = (size_t)MAX(1.0, round(size.width * resultScale));
+        size_t height = (size_t)MAX(1.0, round(size.height * resultScale));
+        if (akaImageOrientationIsRotated(image.imageOrientation))
+        {
+            size_t tmp = width; width = height; height = tmp;
+        }
+
+        CGImageAlphaInfo alphaInfo = CGImageGetAlphaInfo(cgImage);
+        BOOL hasAlpha = !(alphaInfo == kCGImageAlphaNone ||
+                          alphaInfo == kCGImageAlphaNoneSkipFirst ||
+                          alphaInfo == kCGImageAlphaNoneSkipLast);
+
+        CGColorSpaceRef colorSpace = CGColorSpaceCreateDeviceRGB();
+        CGContextRef context = CGBitmapContextCreate(NULL, width, height, 8, 0, colorSpace,
+                                                     (kCGBitmapByteOrder32Host |
+                                                      (hasAlpha
+                                                       ? kCGImageAlphaPremultipliedFirst
+                                                       : kCGImageAlphaNoneSkipFirst)));
+        CGColorSpaceRelease(colorSpace);
+
+        if (context != NULL)
+        {
+            CGContextSetInterpolationQuality(context, kCGInterpolationHigh);
+            CGContextDrawImage(context, CGRectMake(0, 0, width, height), cgImage);
+
+            CGImageRef decodedImage = CGBitmapContextCreateImage(context);
+            if (decodedImage != NULL)
+            {
+                result = [UIImage imageWithCGImage:decodedImage
+                                             scale:resultScale
+                                       orientation:image.imageOrientation];
+                CGImageRelease(decodedImage);
+            }
+            CGContextRelease(context);
+        }
+    }
+
+    return result;
+}
+
+/**
+ Creates a decoded and downsampled image from the contents of the file URL without decoding the full size image. Images loaded from URLs have a scale of 1.0, as do images created from data.
+ */
+static UIImage* akaDecodedImageAtURL(NSURL* url, CGSize fillSize, CGSize maxSize, CGFloat scale)
+{
+    UIImage* result = nil;
+    CGImageSourceRef source = CGImageSourceCreateWithURL((__bridge CFURLRef)url, NULL);
+
+    if (source != NULL)
+    {
+        NSDictionary* properties = CFBridgingRelease(CGImageSourceCopyPropertiesAtIndex(source, 0, NULL));
+        CGFloat width = [properties[(__bridge NSString*)kCGImagePropertyPixelWidth] doubleValue];
+        CGFloat height = [properties[(__bridge NSString*)kCGImagePropertyPixelHeight] doubleValue];
+
+        // EXIF orientations 5 to 8 are rotated by 90 degrees
+        if ([properties[(__bridge NSString*)kCGImagePropertyOrientation] intValue] >= 5)
+        {
+            CGFloat tmp = width; width = height; height = tmp;
+        }
+
+        if (width > 0 && height > 0)
+        {
+            CGSize size = akaImageTargetSize(CGSizeMake(width, height), fillSize, maxSize);
+            CGFloat resultScale = MIN(scale, width / size.width);
+            CGFloat maxPixelSize = MAX(1.0, round(MAX(size.width, size.height) * resultScale));
+
+            NSDictionary* options = @{ (__bridge NSString*)kCGImageSourceCreateThumbnailFromImageAlways: @YES,
+                                       (__bridge NSString*)kCGImageSourceCreateThumbnailWithTransform: @YES,
+                                       (__bridge NSString*)kCGImageSourceShouldCacheImmediately: @YES,
+                                       (__bridge NSString*)kCGImageSourceThumbnailMaxPixelSize: @(maxPixelSize) };
+            CGImageRef image = CGImageSourceCreateThumbnailAtIndex(source, 0, (__bridge CFDictionaryRef)options);
+            if (image != NULL)
+            {
+                result = [UIImage imageWithCGImage:image
+                                             scale:CGImageGetWidth(image) / size.width
+                                       orientation:UIImageOrientationUp];
+                CGImageRelease(image);
+            }
+        }
+        CFRelease(source);
+    }
+
+    return result;
+}
+
+static UIImage* akaImageNamed(NSString* name)
+{
+    __block UIImage* result = nil;
+
+    // UIImage is thread safe since iOS 9
+    if ([[NSProcessInfo processInfo] isOperatingSystemAtLeastVersion:(NSOperatingSystemVersion){ 9, 0, 0 }])
+    {
+        result = [UIImage imageNamed:name];
+    }
+    else
+    {
+        dispatch_sync(dispatch_get_main_queue(), ^{
+            result = [UIImage imageNamed:name];
+        });
+    }
+
+    return result;
+}
+
+static NSUInteger akaImageCost(UIImage* image)
+{
+    CGImageRef cgImage = image.CGImage;
+
+    return cgImage == NULL ? 0 : CGImageGetBytesPerRow(cgImage) * CGImageGetHeight(cgImage);
+}
+
+static NSString* akaImageCacheKey(id source, CGSize fillSize, CGSize maxSize, CGFloat scale)
+{
+    NSString* result = nil;
+    NSString* sourceKey = nil;
+
+    if ([source isKindOfClass:[NSString class]])
+    {
+        sourceKey = [@"name:" stringByAppendingString:(NSString*)source];
+    }
+    else if ([source isKindOfClass:[NSURL class]])
+    {
+        sourceKey = ((NSURL*)source).absoluteString;
+    }
+
+    if (sourceKey)
+    {
+        result = [NSString stringWithFormat:@"%@|%gx%g|%gx%g|@%g",
+                  sourceKey,
+                  fillSize.width, fillSize.height,
+                  maxSize.width, maxSize.height,
+                  scale];
+    }
+
+    return result;
+}
+
+
+#pragma mark - AKAImageLoadRequest - Implementation
+#pragma mark -
+
+@implementation AKAImageLoadRequest
+{
+    atomic_bool _cancelled;
+}
+
+- (instancetype)initWithSource:(req_id)source
+{
+    if (self = [super init])
+    {
+        _source = source;
+        atomic_init(&_cancelled, false);
+    }
+    return self;
+}
+
+- (BOOL)isCancelled
+{
+    return atomic_load(&_cancelled);
+}
+
+- (void)cancel
+{
+    atomic_store(&_cancelled, true);
+}
+
+@end
+
+
+#pragma mark - AKAImageLoader - Private Interface
+#pragma mark -
+
+@interface AKAImageLoader()
+
+@property(nonatomic, readonly) NSOperationQueue*                                    queue;
+
+/**
+ Cached images ordered by access, least recently used first.
+ */
+@property(nonatomic, readonly) AKAMutableOrderedDictionary<NSString*, UIImage*>*    cache;
+@property(nonatomic, readonly) NSLock*                                              cacheLock;
+
+@end
+
+
+#pragma mark - AKAImageLoader - Implementation
+#pragma mark -
+
+@implementation AKAImageLoader
+
+#pragma mark - Initialization
+
++ (req_AKAImageLoader)sharedLoader
+{
+    static AKAImageLoader* result;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        result = [AKAImageLoader new];
+    });
+    return result;
+}
+
+- (instancetype)init
+{
+    if (self = [super init])
+    {
+        _queue = [NSOperationQueue new];
+        _queue.name = @"AKAImageLoader";
+        _queue.maxConcurrentOperationCount = 2;
+        _queue.qualityOfService = NSQualityOfServiceUserInitiated;
+
+        _cache = [AKAMutableOrderedDictionary new];
+        _cacheLock = [NSLock new];
+        _cacheCostLimit = 32 * 1024 * 1024;
+
+        [[NSNotificationCenter defaultCenter] addObserver:self
+                                                 selector:@selector(didReceiveMemoryWarning:)
+                                                     name:UIApplicationDidReceiveMemoryWarningNotification
+                                                   object:nil];
+    }
+    return self;
+}
+
+- (void)dealloc
+{
+    [[NSNotificationCenter defaultCenter] removeObserver:self];
+}
+
+- (void)didReceiveMemoryWarning:(NSNotification* __unused)notification
+{
+    [self removeAllCachedImages];
+}
+
+#pragma mark - Loading
+
+- (opt_UIImage)cachedImageForSource:(req_id)source
+                           fillSize:(CGSize)fillSize
+                            maxSize:(CGSize)maxSize
+                              scale:(CGFloat)scale
+{
+    NSString* key = akaImageCacheKey(source, fillSize, maxSize, scale);
+
+    return key ? [self cachedImageForKey:key] : nil;
+}
+
+- (req_AKAImageLoadRequest)loadImageForSource:(req_id)source
+                                     fillSize:(CGSize)fillSize
+                                      maxSize:(CGSize)maxSize
+                                        scale:(CGFloat)scale
+                                   completion:(AKAImageLoadCompletionBlock)completion
+{
+    AKAImageLoadRequest* request = [[AKAImageLoadRequest alloc] initWithSource:source];
+    NSString* key = akaImageCacheKey(source, fillSize, maxSize, scale);
+
+    __weak typeof(self) weakSelf = self;
+    [self.queue addOperationWithBlock:^{
+        if (!request.isCancelled)
+        {
+            // Another request may have loaded the image in the meantime:
+            UIImage* image = key ? [weakSelf cachedImageForKey:key] : nil;
+
+            if (image == nil)
+            {
+                if ([source isKindOfClass:[NSString class]])
+                {
+                    image = akaDecodedImage(akaImageNamed(source), fillSize, maxSize, scale);
+                }
+                else if ([source isKindOfClass:[NSURL class]])
+                {
+                    image = akaDecodedImageAtURL(source, fillSize, maxSize, scale);
+                }
+                else if ([source isKindOfClass:[UIImage class]])
+                {
+                    image = akaDecodedImage(source, fillSize, maxSize, scale);
+                }
+
+                if (image && key)
+                {
+                    [weakSelf cacheImage:image forKey:key];
+                }
+            }
+
+            dispatch_async(dispatch_get_main_queue(), ^{
+                if (!request.isCancelled)
+                {
+                    completion(request, image);
+                }
+            });
+        }
+    }];
+
+    return request;
+}
+
+#pragma mark - Cache
+
+@synthesize cacheCost = _cacheCost;
+
+- (NSUInteger)cacheCost
+{
+    [self.cacheLock lock];
+    NSUInteger result = _cacheCost;
+    [self.cacheLock unlock];
+
+    return result;
+}
+
+- (void)setCacheCostLimit:(NSUInteger)cacheCostLimit
+{
+    [self.cacheLock lock];
+    _cacheCostLimit = cacheCostLimit;
+    [self evictImagesExceedingCostLimit];
+    [self.cacheLock unlock];
+}
+
+- (void)removeAllCachedImages
+{
+    [self.cacheLock lock];
+    [self.cache removeAllObjects];
+    _cacheCost = 0;
+    [self.cacheLock unlock];
+}
+
+- (UIImage*)cachedImageForKey:(NSString*)key
+{
+    [self.cacheLock lock];
+    UIImage* result = self.cache[key];
+    if (result)
+    {
+        // Move the image to the end (most recently used)
+        [self.cache removeObjectForKey:key];
+        self.cache[key] = result;
+    }
+    [self.cacheLock unlock];
+
+    return result;
+}
+
+- (void)cacheImage:(UIImage*)image forKey:(NSString*)key
+{
+    NSUInteger cost = akaImageCost(image);
+
+    [self.cacheLock lock];
+    if (cost <= _cacheCostLimit)
+    {
+        UIImage* previous = self.cache[key];
+        if (previous)
+        {
+            [self.cache removeObjectForKey:key];
+            _cacheCost -= akaImageCost(previous);
+        }
+        self.cache[key] = image;
+        _cacheCost += cost;
+
+        [self evictImagesExceedingCostLimit];
+    }
+    [self.cacheLock unlock];
+}
+
+- (void)evictImagesExceedingCostLimit
+{
+    while (_cacheCost > _cacheCostLimit && self.cache.count > 0)
+    {
+        NSString* key = [self.cache keyAtIndex:0];
+        _cacheCost -= akaImageCost(self.cache[key]);
+        [self.cache removeObjectForKey:key];
+    }
+}
+
+@end
@@ -42,6 +42,24 @@ typedef AKAKeyboardActivationSequence* _Nullable                    opt_AKAKeybo
 - (void)                                            updateIfNeeded;
 - (void)                                                    update;
 
+/**
+ Inserts the specified item at the position determined by the delegate's keyboardActivationSequence:compareItem:toItem: (or at the end of the sequence if the delegate does not compare items) without rebuilding the sequence.
+
+ The position of the item is determined when the sequence is next accessed, since items are typically inserted before their responders are laid out. The input accessory view is only updated if the item becomes a neighbour of the active item.
+
+ Items are located, inserted and removed in logarithmic time.
+
+ @return YES if the item has been inserted, NO if it is already part of the sequence, does not belong to this sequence or if the sequence has not yet been built or is scheduled to be updated anyway (in which case the item will be included by the update).
+ */
+- (BOOL)                                                insertItem:(req_AKAKeyboardActivationSequenceItem)item;
+
+/**
+ Removes the specified item without rebuilding the sequence. If the item is active, the active responder is unregistered.
+
+ @return YES if the item has been removed.
+ */
+- (BOOL)                                                removeItem:(req_AKAKeyboardActivationSequenceItem)item;
+
 #pragma mark - Properties
 
 @property(nonatomic, readonly) NSString*              identifier;
@@ -98,6 +116,14 @@ typedef AKAKeyboardActivationSequence* _Nullable                    opt_AKAKeybo
                                                                                   NSUInteger idx,
                                                                                   outreq_BOOL stop))block;
 
+/**
+ Compares the specified items with respect to their order in the keyboard activation sequence. If implemented, the order has to be a total order consistent with the order in which items are enumerated. The sequence uses it to determine the position of inserted items.
+ */
+@optional
+- (NSComparisonResult)                keyboardActivationSequence:(req_AKAKeyboardActivationSequence)keyboardActivationSequence
+                                                     compareItem:(req_AKAKeyboardActivationSequenceItem)item
+                                                          toItem:(req_AKAKeyboardActivationSequenceItem)otherItem;
+
 @optional
 - (req_UIView)createInputAccessoryViewForKeyboardActivationSequence:(req_AKAKeyboardActivationSequence)keyboardActivationSequence
                                              activatePreviousAction:(opt_SEL)activatePrevious
@@ -8,7 +8,7 @@
 
 @import UIKit;
 #import "AKALog.h"
-#import "AKAReference.h"
+#import "AKAOrderStatisticTree.h"
 
 #import "AKAKeyboardActivationSequence.h"
 #import "AKAKeyboardActivationSequenceAccessoryView.h"
@@ -19,9 +19,17 @@
 
 @interface AKAKeyboardActivationSequence ()
 
-@property(nonatomic, readonly)  NSMutableArray<AKAWeakReference<AKAKeyboardActivationSequenceItem>*>* items;
+/**
+ The ordered index of items. Items are kept in the order defined by the delegate and are located, inserted and removed in logarithmic time. Insert positions are determined by the delegate's keyboardActivationSequence:compareItem:toItem: (if implemented).
+ */
+@property(nonatomic, readonly)  AKAOrderStatisticTree* items;
+/**
+ Items which have been inserted but not yet been ordered. Insert positions are determined when the sequence is next accessed, because the positions of responders (which the delegate typically uses to order items) are not known before the layout of their views.
+ */
+@property(nonatomic, readonly)  NSHashTable* pendingItems;
 @property(nonatomic)            NSUInteger activeItemIndex;
 @property(nonatomic, nullable)  UIResponder*  activeResponder;
+@property(nonatomic)            BOOL needsUpdate;
 
 @end
 
@@ -49,6 +57,9 @@
     {
         self.activeItemIndex = NSNotFound;
         self.activeResponder = nil;
+        _pendingItems = [[NSHashTable alloc] initWithOptions:(NSPointerFunctionsWeakMemory |
+                                                              NSPointerFunctionsObjectPointerPersonality)
+                                                    capacity:0];
     }
 
     return self;
@@ -67,16 +78,30 @@
 
 #pragma mark - Items
 
-- (NSMutableArray*)                               items
+- (AKAOrderStatisticTree*)                        items
 {
-    if (_items == nil)
+    if (_items == nil || self.needsUpdate)
     {
         [self update];
     }
+    else if (self.pendingItems.count > 0)
+    {
+        [self insertPendingItems];
+    }
 
     return _items;
 }
 
+- (NSUInteger)                           activeItemIndex
+{
+    if (_items != nil && !self.needsUpdate && self.pendingItems.count > 0)
+    {
+        [self insertPendingItems];
+    }
+
+    return _activeItemIndex;
+}
+
 - (NSUInteger)                              countOfItems
 {
     return self.items.count;
@@ -84,20 +109,11 @@
 
 - (NSUInteger)                               indexOfItem:(req_AKAKeyboardActivationSequenceItem)item
 {
-    __block NSUInteger result = NSNotFound;
+    NSUInteger result = NSNotFound;
 
     if (item != nil)
     {
-        [self.items
-         enumerateObjectsUsingBlock:^(AKAWeakReference* _Nonnull obj, NSUInteger idx, BOOL* _Nonnull stop)
-         {
-             id rItem = obj.value;
-             if (item == rItem || [item isEqual:rItem])
-             {
-                 result = idx;
-                 *stop = YES;
-             }
-         }];
+        result = [self.items indexOfItem:item];
     }
     return result;
 }
@@ -108,8 +124,32 @@
 
     if (index != NSNotFound)
     {
-        AKAWeakReference* reference = self.items[index];
-        result = reference.value;
+        result = [self.items itemAtIndex:index];
+    }
+
+    return result;
+}
+
+#pragma mark Ordered Index
+
+/**
+ The comparator used to determine insert positions of items or nil if the delegate does not compare items, in which case items are appended.
+ */
+- (NSComparator)                            itemComparator
+{
+    NSComparator result = nil;
+    id<AKAKeyboardActivationSequenceDelegate> delegate = self.delegate;
+
+    if ([delegate respondsToSelector:@selector(keyboardActivationSequence:compareItem:toItem:)])
+    {
+        __weak AKAKeyboardActivationSequence* weakSelf = self;
+        result = ^NSComparisonResult(id item, id otherItem)
+        {
+            AKAKeyboardActivationSequence* sequence = weakSelf;
+            return [delegate keyboardActivationSequence:(req_AKAKeyboardActivationSequence)sequence
+                                            compareItem:item
+                                                 toItem:otherItem];
+        };
     }
 
     return result;
@@ -119,37 +159,111 @@
 
 - (void)                                  setNeedsUpdate
 {
-    [self removeAllItems];
-    _items = nil;
+    self.needsUpdate = YES;
 }
 
 - (void)                                  updateIfNeeded
 {
-    if (_items == nil)
+    if (_items == nil || self.needsUpdate)
     {
         [self update];
     }
 }
 
-- (void)addItem:(AKAKeyboardActivationSequenceItem)item
+- (BOOL)                                      insertItem:(req_AKAKeyboardActivationSequenceItem)item
 {
-    [self registerItem:item];
-    [_items addObject:[AKAWeakReference weakReferenceTo:item]];
+    BOOL result = (_items != nil &&
+                   !self.needsUpdate &&
+                   [item shouldParticipateInKeyboardActivationSequence] &&
+                   [item responderForKeyboardActivationSequence] != nil &&
+                   [item.keyboardActivationSequenceID isEqualToString:self.identifier] &&
+                   [_items indexOfItem:item] == NSNotFound &&
+                   ![self.pendingItems containsObject:item]);
+
+    if (result)
+    {
+        [self.pendingItems addObject:item];
+        [self registerItem:item];
+    }
+
+    return result;
 }
 
-- (void)removeAllItems
+/**
+ Inserts pending items at the positions determined by the delegate.
+ */
+- (void)                              insertPendingItems
 {
-    [_items enumerateObjectsUsingBlock:^(AKAWeakReference<AKAKeyboardActivationSequenceItem>*_Nonnull reference,
-                                         NSUInteger idx,
-                                         BOOL * _Nonnull stop)
-     {
-         (void)idx;
-         (void)stop;
-         
-         [self unregisterItem:reference.value];
-     }];
-    [_items removeAllObjects];
+    // Pending items are taken first, the accessors used below would otherwise insert them
+    NSArray* pendingItems = self.pendingItems.allObjects;
+    [self.pendingItems removeAllObjects];
+
+    AKAKeyboardActivationSequenceItem activeItem = self.activeItem;
+    AKAKeyboardActivationSequenceItem previousItem = self.previousItem;
+    AKAKeyboardActivationSequenceItem nextItem = self.nextItem;
+
+    NSComparator comparator = [self itemComparator];
+    for (AKAKeyboardActivationSequenceItem item in pendingItems)
+    {
+        [_items insertItem:item usingComparator:comparator];
+    }
+
+    if (activeItem != nil)
+    {
+        // The insertion removes deallocated items it encounters, so the index of the
+        // active item is not necessarily shifted by the number of inserted items.
+        _activeItemIndex = [_items indexOfItem:activeItem];
+    }
+
+    [self updateInputAccessoryViewIfNeighboursChangedFromPreviousItem:previousItem
+                                                             nextItem:nextItem];
+}
+
+- (BOOL)                                      removeItem:(req_AKAKeyboardActivationSequenceItem)item
+{
+    BOOL result = NO;
 
+    if ([self.pendingItems containsObject:item])
+    {
+        [self.pendingItems removeObject:item];
+        [self unregisterItem:item];
+        result = YES;
+    }
+    else if (_items != nil)
+    {
+        // Accessing the active item index inserts pending items, which would shift the index
+        NSUInteger activeItemIndex = self.activeItemIndex;
+        NSUInteger index = [_items indexOfItem:item];
+
+        result = index != NSNotFound;
+        if (result)
+        {
+            if (index == activeItemIndex)
+            {
+                [self unregisterActiveResponder];
+                [self unregisterItem:item];
+                [_items removeItem:item];
+            }
+            else
+            {
+                AKAKeyboardActivationSequenceItem previousItem = self.previousItem;
+                AKAKeyboardActivationSequenceItem nextItem = self.nextItem;
+
+                [self unregisterItem:item];
+                [_items removeItem:item];
+
+                if (self.activeItemIndex != NSNotFound && index < self.activeItemIndex)
+                {
+                    --_activeItemIndex;
+                }
+
+                [self updateInputAccessoryViewIfNeighboursChangedFromPreviousItem:previousItem
+                                                                         nextItem:nextItem];
+            }
+        }
+    }
+
+    return result;
 }
 
 - (void)registerItem:(AKAKeyboardActivationSequenceItem)item
@@ -172,55 +286,96 @@
 
 - (void)                                          update
 {
-    if (_items == nil)
-    {
-        _items = [NSMutableArray new];
-    }
-    else
+    self.needsUpdate = NO;
+
+    // Pending items are included if the delegate still enumerates them
+    NSArray* pendingItems = self.pendingItems.allObjects;
+    [self.pendingItems removeAllObjects];
+
+    AKAKeyboardActivationSequenceItem previousItem = nil;
+    AKAKeyboardActivationSequenceItem nextItem = nil;
+    if (self.activeItemIndex != NSNotFound && self.activeItemIndex < _items.count)
     {
-        [self removeAllItems];
+        previousItem = self.previousItem;
+        nextItem = self.nextItem;
     }
 
+    // Items which are already part of the sequence are neither re-registered nor checked for
+    // being first responder (the active responder is tracked by registerActiveResponder:...).
+    NSHashTable* previousItems = [[NSHashTable alloc] initWithOptions:(NSPointerFunctionsOpaqueMemory |
+                                                                       NSPointerFunctionsObjectPointerPersonality)
+                                                             capacity:_items.count];
+    NSMutableArray* retainedItems = [NSMutableArray arrayWithCapacity:_items.count];
+    [_items enumerateItemsUsingBlock:^(req_id item, NSUInteger idx __unused, outreq_BOOL stop __unused)
+     {
+         [previousItems addObject:item];
+         [retainedItems addObject:item];
+     }];
+    [retainedItems addObjectsFromArray:pendingItems];
+
+    NSMutableArray* items = [NSMutableArray arrayWithCapacity:_items.count];
+    NSHashTable* currentItems = [[NSHashTable alloc] initWithOptions:(NSPointerFunctionsOpaqueMemory |
+                                                                      NSPointerFunctionsObjectPointerPersonality)
+                                                            capacity:_items.count];
+    UIResponder* activeResponder = self.activeResponder;
+    __block NSUInteger activeItemIndex = NSNotFound;
+    __block AKAKeyboardActivationSequenceItem firstResponderItem = nil;
+    __block NSUInteger firstResponderItemIndex = NSNotFound;
+
     [self.delegate enumerateItemsInKeyboardActivationSequenceUsingBlock:
      ^(req_AKAKeyboardActivationSequenceItem    item,
        NSUInteger                               idx,
        outreq_BOOL                              stop)
      {
          (void)stop; // not needed
+         (void)idx;  // indexes of accepted items are used instead
          UIResponder* responder = [item responderForKeyboardActivationSequence];
 
          if (responder != nil && [item.keyboardActivationSequenceID isEqualToString:self.identifier])
          {
-             [self addItem:item];
-             UIResponder* activeResponder = self.activeResponder;
+             NSUInteger index = items.count;
+             BOOL isNew = ![previousItems containsObject:item];
+
+             [items addObject:item];
+             [currentItems addObject:item];
 
-             if (activeResponder != nil || self.activeItemIndex != NSNotFound)
+             if (isNew)
              {
-                 if (responder == activeResponder)
-                 {
-                     // Update possibly changed index of active responder
-                     self->_activeItemIndex = idx;
-                 }
-                 else if (self.activeItemIndex == idx)
-                 {
-                     // Reset the index of active responder, which is different after the update
-                     self->_activeItemIndex = NSNotFound;
-                 }
+                 [self registerItem:item];
              }
 
-             if (responder.isFirstResponder)
+             if (activeResponder != nil && responder == activeResponder)
              {
-                 // This will take care or unregistering a currently active item
-                 [self registerActiveResponder:responder
-                                       forItem:item
-                                       atIndex:idx];
+                 // Update possibly changed index of active responder
+                 activeItemIndex = index;
+             }
+             else if (firstResponderItem == nil && (isNew || activeResponder == nil) && responder.isFirstResponder)
+             {
+                 firstResponderItem = item;
+                 firstResponderItemIndex = index;
              }
          }
      }];
 
-    UIResponder* activeResponder = self.activeResponder;
+    for (id item in retainedItems)
+    {
+        if (![currentItems containsObject:item])
+        {
+            [self unregisterItem:item];
+        }
+    }
+
+    _items = [[AKAOrderStatisticTree alloc] initWithItems:items];
+    _activeItemIndex = activeItemIndex;
 
-    if (activeResponder != nil)
+    if (firstResponderItem != nil)
+    {
+        // This will take care or unregistering a currently active item
+        [self registerActiveResponder:[firstResponderItem responderForKeyboardActivationSequence]
+                              forItem:firstResponderItem
+                              atIndex:firstResponderItemIndex];
+    }
+    else if (activeResponder != nil)
     {
         if (self.activeItemIndex == NSNotFound || !activeResponder.isFirstResponder)
         {
@@ -229,9 +384,10 @@
         }
         else
         {
+            [self updateInputAccessoryViewIfNeighboursChangedFromPreviousItem:previousItem
+                                                                     nextItem:nextItem];
         }
     }
-    [self updateInputAccessoryView];
 }
 
 #pragma mark - Input Accessory View
@@ -311,6 +467,19 @@
     return result;
 }
 
+/**
+ Updates the input accessory view if the items preceding or following the active item are not the specified ones. Changes of items elsewhere in the sequence do not affect the state of the input accessory view.
+ */
+- (void)updateInputAccessoryViewIfNeighboursChangedFromPreviousItem:(opt_AKAKeyboardActivationSequenceItem)previousItem
+                                                           nextItem:(opt_AKAKeyboardActivationSequenceItem)nextItem
+{
+    if (self.activeItemIndex != NSNotFound &&
+        (self.previousItem != previousItem || self.nextItem != nextItem))
+    {
+        [self updateInputAccessoryView];
+    }
+}
+
 - (void)                        updateInputAccessoryView
 {
     if (self.activeResponder != nil)
@@ -30,6 +30,24 @@
  */
 @property(nonatomic) BOOL liveModelUpdates;
 
+/**
+ If greater than zero, live model updates are delayed until the view value did not change for the specified number of seconds.
+
+ Pending updates are committed immediately when the responder resigns (ends editing), f.e. when the keyboard activation sequence activates the next responder. If throttleInterval is also set, it limits the time an update is delayed while the value keeps changing.
+
+ @note this property corresponds to the binding attribute "debounce" of text and search bar bindings.
+ */
+@property(nonatomic) NSTimeInterval debounceInterval;
+
+/**
+ If greater than zero, live model updates are performed at most once per the specified number of seconds, intermediate changes are coalesced into the next update.
+
+ Like debounced updates, pending updates are committed immediately when the responder resigns.
+
+ @note this property corresponds to the binding attribute "throttle" of text and search bar bindings.
+ */
+@property(nonatomic) NSTimeInterval throttleInterval;
+
 // TODO: This is not really a binding parameter but a configuration property for AKACompositeControls owning a binding. Review this
 @property(nonatomic) BOOL autoActivate;
 
@@ -66,6 +84,27 @@
 
 - (void)                                     responderDidDeactivate:(req_UIResponder)responder;
 
+#pragma mark - Deferred Model Updates
+
+/**
+ Propagates the current view value to the binding source. Subclasses supporting debounced or throttled model updates implement this method, the default implementation does nothing.
+ */
+- (void)                                         viewValueDidChange;
+
+/**
+ Subclasses call this method from viewValueDidChange before propagating a change. If the change is debounced or throttled, the method schedules a deferred call to viewValueDidChange and returns YES, in which case the caller should not propagate the change. Otherwise (the responder is not active or no interval is set), pending deferred changes are discarded in favor of the immediate update.
+ */
+- (BOOL)                                       deferViewValueChange;
+
+/**
+ Determines whether a deferred change is pending.
+ */
+@property(nonatomic, readonly) BOOL                              hasDeferredViewValueChange;
+
+/**
+ Propagates a pending deferred change immediately, if there is one.
+ */
+- (void)                              commitDeferredViewValueChange;
 
 @end
 
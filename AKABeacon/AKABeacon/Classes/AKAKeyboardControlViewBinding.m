@@ -10,6 +10,7 @@
 
 #import "AKAKeyboardControlViewBinding.h"
 #import "AKAKeyboardControlViewBinding+DelegateSupport.h"
+#import "AKABinding+SubclassObservationEvents.h"
 
 #import "AKAKeyboardActivationSequenceItemProtocol_Internal.h"
 #import "AKAKeyboardActivationSequence.h"
@@ -22,6 +23,14 @@ NSString *const kDefaultKeyboardActivationSequenceIdentifier = @"DEFAULT";
 {
     __weak AKAKeyboardActivationSequence* _keyboardActivationSequence;
     UIView*                               _savedInputAccessoryView;
+
+    // Deferred model updates
+    BOOL                                  _hasDeferredViewValueChange;
+    BOOL                                  _isCommittingDeferredViewValueChange;
+    NSUInteger                            _deferredViewValueChangeGeneration;
+    NSTimeInterval                        _deferredViewValueChangeDeadline;
+    NSTimeInterval                        _firstDeferredViewValueChangeTime;
+    NSTimeInterval                        _lastViewValueChangePropagationTime;
 }
 @end
 
@@ -99,6 +108,128 @@ NSString *const kDefaultKeyboardActivationSequenceIdentifier = @"DEFAULT";
     }
 }
 
+#pragma mark - Deferred Model Updates
+
+- (void)                                   viewValueDidChange
+{
+}
+
+- (BOOL)                         hasDeferredViewValueChange
+{
+    return _hasDeferredViewValueChange;
+}
+
+- (BOOL)                               deferViewValueChange
+{
+    BOOL result = NO;
+
+    if (_isCommittingDeferredViewValueChange)
+    {
+        // The deferred change is being propagated
+    }
+    else if (self.liveModelUpdates &&
+             (self.debounceInterval > 0 || self.throttleInterval > 0) &&
+             self.isResponderActive)
+    {
+        NSTimeInterval now = [NSProcessInfo processInfo].systemUptime;
+        NSTimeInterval deadline;
+
+        if (!_hasDeferredViewValueChange)
+        {
+            _firstDeferredViewValueChangeTime = now;
+        }
+
+        if (self.debounceInterval > 0)
+        {
+            deadline = now + self.debounceInterval;
+
+            if (self.throttleInterval > 0)
+            {
+                // Continuous input must not delay updates indefinitely.
+                deadline = MIN(deadline, _firstDeferredViewValueChangeTime + self.throttleInterval);
+            }
+        }
+        else
+        {
+            deadline = _lastViewValueChangePropagationTime + self.throttleInterval;
+        }
+
+        result = deadline > now;
+
+        if (result)
+        {
+            if (!_hasDeferredViewValueChange || deadline != _deferredViewValueChangeDeadline)
+            {
+                [self scheduleDeferredViewValueChangeAt:deadline now:now];
+            }
+        }
+        else
+        {
+            [self discardDeferredViewValueChange];
+            _lastViewValueChangePropagationTime = now;
+        }
+    }
+    else
+    {
+        // The change is propagated immediately and supersedes a pending deferred change.
+        [self discardDeferredViewValueChange];
+    }
+
+    return result;
+}
+
+- (void)                  scheduleDeferredViewValueChangeAt:(NSTimeInterval)deadline
+                                                        now:(NSTimeInterval)now
+{
+    // Previously scheduled commits are ignored when they fire.
+    NSUInteger generation = ++_deferredViewValueChangeGeneration;
+    _hasDeferredViewValueChange = YES;
+    _deferredViewValueChangeDeadline = deadline;
+
+    __weak AKAKeyboardControlViewBinding* weakSelf = self;
+    dispatch_time_t time = dispatch_time(DISPATCH_TIME_NOW, (int64_t)((deadline - now) * NSEC_PER_SEC));
+    dispatch_after(time, dispatch_get_main_queue(), ^{
+        AKAKeyboardControlViewBinding* binding = weakSelf;
+
+        if (binding != nil && binding->_deferredViewValueChangeGeneration == generation)
+        {
+            [binding commitDeferredViewValueChange];
+        }
+    });
+}
+
+- (void)                     discardDeferredViewValueChange
+{
+    if (_hasDeferredViewValueChange)
+    {
+        _hasDeferredViewValueChange = NO;
+        ++_deferredViewValueChangeGeneration;
+    }
+}
+
+- (void)                      commitDeferredViewValueChange
+{
+    if (_hasDeferredViewValueChange)
+    {
+        [self discardDeferredViewValueChange];
+        _lastViewValueChangePropagationTime = [NSProcessInfo processInfo].systemUptime;
+
+        _isCommittingDeferredViewValueChange = YES;
+        [self viewValueDidChange];
+        _isCommittingDeferredViewValueChange = NO;
+    }
+}
+
+#pragma mark - Change Tracking
+
+- (void)                     willStopObservingBindingTarget
+{
+    // Changes must not get lost if the binding stops observing before a deferred update is due.
+    [self commitDeferredViewValueChange];
+
+    [super willStopObservingBindingTarget];
+}
+
 @end
 
 
@@ -0,0 +1,98 @@
+//
+//  AKALayoutConstraintDiff.h
+//  AKABeacon
+//
+//  Created by Michael Utech on 19.10.16.
+//  Copyright © 2016 Michael Utech & AKA Sarl. All rights reserved.
+//
+
+#import <UIKit/UIKit.h>
+
+/**
+ * The identifier assigned to constraints installed by themes. Constraints carrying this identifier are owned by the theme system and can be reused (adjusted in place) when a theme is (re)applied.
+ */
+FOUNDATION_EXPORT NSString* const AKALayoutConstraintDiffThemeConstraintIdentifier;
+
+/**
+ * Reconciles the constraints installed by a previous theme application with the constraints required by the theme that is being applied.
+ *
+ * Applying a theme used to remove all constraints affecting participating views and to recreate them from the theme's constraint specifications. Since adding and removing constraints invalidates the layout engine's state for all affected views, this was expensive, even if the constraints did not change at all (which is the common case when a theme is reapplied, for example after a content size category change).
+ *
+ * A diff collects installed constraints owned by the theme system as reusable candidates instead of removing them. Constraints required by a theme are matched against these candidates: a candidate with the same items, attributes, relation, multiplier and target is reused by adjusting its constant and priority in place. Only unmatched candidates are removed and only unmatched constraints are added when the diff is committed.
+ *
+ * Constraints not owned by the theme system (for example constraints defined in Interface Builder) are never reused, they are removed as before so that they can be recorded and restored by theme delegates.
+ */
+@interface AKALayoutConstraintDiff: NSObject
+
+#pragma mark - Theme Constraints
+
+/**
+ * Determines whether the specified constraint has been installed by a theme.
+ *
+ * @param constraint the constraint to test.
+ *
+ * @return YES if the constraint is owned by the theme system.
+ */
++ (BOOL)isThemeConstraint:(NSLayoutConstraint*)constraint;
+
+#pragma mark - Collecting Installed Constraints
+
+/**
+ * Defers the removal of those of the specified constraints, which are owned by the theme system and keeps them as candidates for reuse. Constraints which are not owned by the theme system have to be removed by the caller.
+ *
+ * @param constraints constraints which are scheduled for removal.
+ * @param view the view in which the constraints are installed.
+ *
+ * @return the constraints which are not owned by the theme system and which are not retained by the diff.
+ */
+- (NSArray*)deferRemovalOfConstraints:(NSArray*)constraints
+                      installedInView:(UIView*)view;
+
+#pragma mark - Installing Constraints
+
+/**
+ * Schedules the installation of the specified constraints in the specified target. Constraints matching a reusable candidate are replaced by the candidate, which is adjusted to the constant and priority of the replaced constraint. Other constraints are added to the target when the diff is committed.
+ *
+ * @param constraints the constraints to install.
+ * @param target the view in which the constraints should be installed.
+ *
+ * @return the constraints that will be installed when the diff is committed, where matching constraints have been replaced by reused constraints.
+ */
+- (NSArray*)installConstraints:(NSArray*)constraints
+                      inTarget:(UIView*)target;
+
+/**
+ * Removes all remaining candidates (which have not been reused) from their views and then adds all new constraints to their targets.
+ */
+- (void)commit;
+
+/**
+ * Removes all remaining candidates (which have not been reused) from their views. The removal handler (if specified) is called for each view after the candidates installed in the view have been removed.
+ *
+ * @param removalHandler called with the constraints removed from a view, only if constraints have been removed.
+ */
+- (void)commitRemovalsWithHandler:(void(^)(NSArray<NSLayoutConstraint*>* constraints, UIView* view))removalHandler;
+
+/**
+ * Adds all new constraints to their targets. Removals should be committed first.
+ */
+- (void)commitAdditions;
+
+#pragma mark - Statistics
+
+/**
+ * The number of installed constraints which have been reused.
+ */
+@property(nonatomic, readonly) NSUInteger reusedCount;
+
+/**
+ * The number of constraints which have been added when the diff was committed.
+ */
+@property(nonatomic, readonly) NSUInteger addedCount;
+
+/**
+ * The number of theme constraints which have been removed when the diff was committed.
+ */
+@property(nonatomic, readonly) NSUInteger removedCount;
+
+@end
@@ -0,0 +1,233 @@
+//
+//  AKALayoutConstraintDiff.m
+//  AKABeacon
+//
+//  Created by Michael Utech on 19.10.16.
+//  Copyright © 2016 Michael Utech & AKA Sarl. All rights reserved.
+//
+
+#import "AKALayoutConstraintDiff.h"
+
+NSString* const AKALayoutConstraintDiffThemeConstraintIdentifier = @"AKATheme";
+
+
+@interface AKALayoutConstraintDiff()
+
+/**
+ * Reusable candidates by their signature (see signatureForConstraint:inView:). Multiple candidates can share the same signature.
+ */
+@property(nonatomic, readonly) NSMutableDictionary<NSString*, NSMutableArray<NSLayoutConstraint*>*>* candidatesBySignature;
+
+/**
+ * Maps deferred candidates to the views in which they are installed. This is also used to prevent a candidate from being collected twice (constraints relating two participating views are found for both views).
+ */
+@property(nonatomic, readonly) NSMapTable<NSLayoutConstraint*, UIView*>* candidateViews;
+
+/**
+ * Constraints scheduled to be added, by target view.
+ */
+@property(nonatomic, readonly) NSMapTable<UIView*, NSMutableArray<NSLayoutConstraint*>*>* additionsByTarget;
+
+@end
+
+
+@implementation AKALayoutConstraintDiff
+
+#pragma mark - Initialization
+
+- (instancetype)init
+{
+    if (self = [super init])
+    {
+        _candidatesBySignature = [NSMutableDictionary new];
+        _candidateViews = [NSMapTable strongToStrongObjectsMapTable];
+        _additionsByTarget = [NSMapTable strongToStrongObjectsMapTable];
+    }
+    return self;
+}
+
+#pragma mark - Theme Constraints
+
++ (BOOL)isThemeConstraint:(NSLayoutConstraint*)constraint
+{
+    return [AKALayoutConstraintDiffThemeConstraintIdentifier isEqualToString:constraint.identifier];
+}
+
+#pragma mark - Collecting Installed Constraints
+
+- (NSArray*)deferRemovalOfConstraints:(NSArray*)constraints
+                      installedInView:(UIView*)view
+{
+    NSMutableArray* result = nil;
+
+    for (NSLayoutConstraint* constraint in constraints)
+    {
+        if ([AKALayoutConstraintDiff isThemeConstraint:constraint])
+        {
+            if ([self.candidateViews objectForKey:constraint] == nil)
+            {
+                [self.candidateViews setObject:view forKey:constraint];
+
+                NSString* signature = [self signatureForConstraint:constraint inView:view];
+                NSMutableArray* candidates = self.candidatesBySignature[signature];
+                if (candidates == nil)
+                {
+                    candidates = [NSMutableArray new];
+                    self.candidatesBySignature[signature] = candidates;
+                }
+                [candidates addObject:constraint];
+            }
+        }
+        else
+        {
+            if (result == nil)
+            {
+                result = [NSMutableArray arrayWithCapacity:constraints.count];
+            }
+            [result addObject:constraint];
+        }
+    }
+
+    return result ? result : @[];
+}
+
+#pragma mark - Installing Constraints
+
+- (NSArray*)installConstraints:(NSArray*)constraints
+                      inTarget:(UIView*)target
+{
+    NSMutableArray* result = [NSMutableArray arrayWithCapacity:constraints.count];
+    NSMutableArray* additions = nil;
+
+    for (NSLayoutConstraint* constraint in constraints)
+    {
+        NSLayoutConstraint* reused = [self dequeueCandidateMatchingConstraint:constraint
+                                                                       inView:target];
+        if (reused != nil)
+        {
+            if (reused.constant != constraint.constant)
+            {
+                reused.constant = constraint.constant;
+            }
+            if (reused.priority != constraint.priority)
+            {
+                reused.priority = constraint.priority;
+            }
+            ++_reusedCount;
+            [result addObject:reused];
+        }
+        else
+        {
+            if (constraint.identifier == nil)
+            {
+                constraint.identifier = AKALayoutConstraintDiffThemeConstraintIdentifier;
+            }
+            if (additions == nil)
+            {
+                additions = [self.additionsByTarget objectForKey:target];
+                if (additions == nil)
+                {
+                    additions = [NSMutableArray new];
+                    [self.additionsByTarget setObject:additions forKey:target];
+                }
+            }
+            [additions addObject:constraint];
+            [result addObject:constraint];
+        }
+    }
+
+    return result;
+}
+
+- (void)commit
+{
+    [self commitRemovalsWithHandler:nil];
+    [self commitAdditions];
+}
+
+- (void)commitRemovalsWithHandler:(void(^)(NSArray<NSLayoutConstraint*>* constraints, UIView* view))removalHandler
+{
+    // Remove stale constraints first, adding new constraints while stale ones are still installed could
+    // result in (temporarily) unsatisfiable constraints.
+    NSMapTable<UIView*, NSMutableArray<NSLayoutConstraint*>*>* removalsByView = [NSMapTable strongToStrongObjectsMapTable];
+    for (NSArray<NSLayoutConstraint*>* candidates in self.candidatesBySignature.objectEnumerator)
+    {
+        for (NSLayoutConstraint* constraint in candidates)
+        {
+            UIView* view = [self.candidateViews objectForKey:constraint];
+            NSMutableArray* removals = [removalsByView objectForKey:view];
+            if (removals == nil)
+            {
+                removals = [NSMutableArray new];
+                [removalsByView setObject:removals forKey:view];
+            }
+            [removals addObject:constraint];
+        }
+    }
+    for (UIView* view in removalsByView.keyEnumerator)
+    {
+        NSArray* removals = [removalsByView objectForKey:view];
+        [view removeConstraints:removals];
+        _removedCount += removals.count;
+        if (removalHandler != nil)
+        {
+            removalHandler(removals, view);
+        }
+    }
+    [self.candidatesBySignature removeAllObjects];
+    [self.candidateViews removeAllObjects];
+}
+
+- (void)commitAdditions
+{
+    for (UIView* target in self.additionsByTarget.keyEnumerator)
+    {
+        NSArray* additions = [self.additionsByTarget objectForKey:target];
+        [target addConstraints:additions];
+        _addedCount += additions.count;
+    }
+    [self.additionsByTarget removeAllObjects];
+}
+
+#pragma mark - Implementation
+
+- (NSLayoutConstraint*)dequeueCandidateMatchingConstraint:(NSLayoutConstraint*)constraint
+                                                   inView:(UIView*)view
+{
+    NSLayoutConstraint* result = nil;
+
+    if (self.candidateViews.count > 0)
+    {
+        NSString* signature = [self signatureForConstraint:constraint inView:view];
+        NSMutableArray* candidates = self.candidatesBySignature[signature];
+        result = candidates.lastObject;
+        if (result)
+        {
+            [candidates removeLastObject];
+            if (candidates.count == 0)
+            {
+                [self.candidatesBySignature removeObjectForKey:signature];
+            }
+            [self.candidateViews removeObjectForKey:result];
+        }
+    }
+
+    return result;
+}
+
+/**
+ * The signature of a constraint covers all immutable properties of the constraint and the view it is installed in. Since the priority of an installed constraint cannot be changed from required to optional (or vice versa), the signature also distinguishes required and optional constraints.
+ */
+- (NSString*)signatureForConstraint:(NSLayoutConstraint*)constraint
+                             inView:(UIView*)view
+{
+    return [NSString stringWithFormat:@"%p|%p.%ld|%ld|%p.%ld|%g|%d",
+            (__bridge void*)view,
+            (__bridge void*)constraint.firstItem, (long)constraint.firstAttribute,
+            (long)constraint.relation,
+            (__bridge void*)constraint.secondItem, (long)constraint.secondAttribute,
+            (double)constraint.multiplier,
+            constraint.priority >= UILayoutPriorityRequired];
+}
+
+@end
@@ -6,6 +6,7 @@
 #import <UIKit/UIKit.h>
 
 @class AKALayoutConstraintSpecification;
+@class AKALayoutConstraintDiff;
 
 /**
  * Delegate used by AKALayoutConstraintSpecificationDelegate in order
@@ -214,4 +215,24 @@
  */
 @property(nonatomic, weak) NSObject<AKALayoutConstraintSpecificationDelegate>* delegate;
 
+#pragma mark - Installing constraints
+///@name Installing constraints
+
+/**
+ * Creates and installs constraints implementing the specification for the views in the specified @c views dictionary. If a constraint diff is specified, constraints matching previously installed theme constraints are reused and the installation of other constraints is deferred until the diff is committed.
+ *
+ * @param views a dictionary mapping view names to UIView instances.
+ * @param metrics a dictionary mapping metric names to concrete values.
+ * @param defaultTarget the target to use if the @c target property is undefined.
+ * @param delegate a AKALayoutConstraintSpecificationDelegate used independent from a delegate possibly configured in the constraint specification.
+ * @param constraintDiff the diff used to reuse installed constraints or nil to install all constraints immediately.
+ *
+ * @return an array of NSLayoutConstraint's matching the specification.
+ */
+- (NSArray*)installConstraintsForViews:(NSDictionary*)views
+                               metrics:(NSDictionary*)metrics
+                         defaultTarget:(UIView*)defaultTarget
+                              delegate:(NSObject<AKALayoutConstraintSpecificationDelegate>*)delegate
+                        constraintDiff:(AKALayoutConstraintDiff*)constraintDiff;
+
 @end
@@ -8,6 +8,7 @@
 #import "AKAThemeLayout.h"
 #import "AKATheme.h"
 #import "AKALayoutConstraintSpecification.h"
+#import "AKALayoutConstraintDiff.h"
 #import "AKABeaconErrors_Internal.h"
 
 #pragma mark - Internal Class Cluster Interfaces
@@ -221,6 +222,19 @@
                                 metrics:(NSDictionary *)metrics
                           defaultTarget:(UIView *)defaultTarget
                                delegate:(NSObject<AKALayoutConstraintSpecificationDelegate>*)delegate
+{
+    return [self installConstraintsForViews:views
+                                    metrics:metrics
+                              defaultTarget:defaultTarget
+                                   delegate:delegate
+                             constraintDiff:nil];
+}
+
+- (NSArray *)installConstraintsForViews:(NSDictionary *)views
+                                metrics:(NSDictionary *)metrics
+                          defaultTarget:(UIView *)defaultTarget
+                               delegate:(NSObject<AKALayoutConstraintSpecificationDelegate>*)delegate
+                         constraintDiff:(AKALayoutConstraintDiff*)constraintDiff
 {
     NSArray* constraints = nil;
     UIView* effectiveTarget = nil;
@@ -249,8 +263,16 @@
                                 inTarget:effectiveTarget
                                 delegate:delegate];
 
-            [effectiveTarget addConstraints:constraints];
-            
+            if (constraintDiff)
+            {
+                constraints = [constraintDiff installConstraints:constraints
+                                                        inTarget:effectiveTarget];
+            }
+            else
+            {
+                [effectiveTarget addConstraints:constraints];
+            }
+
             [self didInstallConstraints:constraints
                                inTarget:effectiveTarget
                                delegate:delegate];
@@ -418,6 +440,33 @@
 
 @end
 
+#pragma mark - AKALayoutConstraintTemplate
+#pragma mark -
+
+/**
+ * Item name used by constraint templates to refer to the superview of the views referenced in a visual format.
+ */
+static NSString* const AKALayoutConstraintTemplateSuperview = @"|";
+
+/**
+ * A compiled constraint, referencing items by their names in a views dictionary.
+ */
+@interface AKALayoutConstraintTemplate: NSObject
+
+@property(nonatomic) NSString* firstItemName;
+@property(nonatomic) NSLayoutAttribute firstAttribute;
+@property(nonatomic) NSLayoutRelation relation;
+@property(nonatomic) NSString* secondItemName;
+@property(nonatomic) NSLayoutAttribute secondAttribute;
+@property(nonatomic) CGFloat multiplier;
+@property(nonatomic) CGFloat constant;
+@property(nonatomic) UILayoutPriority priority;
+
+@end
+
+@implementation AKALayoutConstraintTemplate
+@end
+
 #pragma mark - AKALayoutConstraintSpecificationVisualFormat
 #pragma mark -
 
@@ -433,6 +482,11 @@
  */
 @property(nonatomic) NSLayoutFormatOptions options;
 
+/**
+ * Constraint templates compiled from the visual format, keyed by the names of the views and the metrics used to compile them. NSNull is stored for combinations that cannot be compiled.
+ */
+@property(nonatomic, readonly) NSMutableDictionary<NSString*, id>* compiledTemplates;
+
 @end
 
 @implementation AKALayoutConstraintSpecificationVisualFormat
@@ -446,16 +500,184 @@
     {
         self.format = visualFormat;
         self.options = options;
+        _compiledTemplates = [NSMutableDictionary new];
     }
     return self;
 }
 
 - (NSArray *)constraintsForViews:(NSDictionary *)views metrics:(NSDictionary *)metrics
 {
-    return [NSLayoutConstraint constraintsWithVisualFormat:self.format
-                                                   options:self.options
-                                                   metrics:metrics
-                                                     views:views];
+    NSArray* result = nil;
+
+    // Parsing the visual format is by far the most expensive part of applying a theme. Themes are
+    // applied repeatedly to views with the same names, so the format is compiled once per set of
+    // view names and metrics and the resulting templates are instantiated for the actual views.
+    NSString* key = [self templateKeyForViews:views metrics:metrics];
+    id templates = self.compiledTemplates[key];
+    if (templates == nil)
+    {
+        templates = [self compileTemplatesForViews:views metrics:metrics];
+        self.compiledTemplates[key] = templates ? templates : [NSNull null];
+    }
+
+    if ([templates isKindOfClass:[NSArray class]])
+    {
+        result = [self constraintsWithTemplates:templates forViews:views];
+    }
+
+    if (result == nil)
+    {
+        result = [NSLayoutConstraint constraintsWithVisualFormat:self.format
+                                                         options:self.options
+                                                         metrics:metrics
+                                                           views:views];
+    }
+
+    return result;
+}
+
+#pragma mark - Compiled Templates
+
+- (NSString*)templateKeyForViews:(NSDictionary*)views
+                         metrics:(NSDictionary*)metrics
+{
+    NSMutableString* result = [NSMutableString new];
+    for (NSString* name in [views.allKeys sortedArrayUsingSelector:@selector(compare:)])
+    {
+        [result appendFormat:@"%@,", name];
+    }
+    for (NSString* name in [metrics.allKeys sortedArrayUsingSelector:@selector(compare:)])
+    {
+        [result appendFormat:@"|%@=%@", name, metrics[name]];
+    }
+    return result;
+}
+
+/**
+ * Compiles the visual format by creating constraints for placeholder views sharing a common superview and recording the resulting constraints as templates.
+ *
+ * @return the templates or nil if the format cannot be compiled. This is the case if one of the views is not a UIView or if the format uses standard spacing, which depends on the actual views.
+ */
+- (NSArray<AKALayoutConstraintTemplate*>*)compileTemplatesForViews:(NSDictionary*)views
+                                                           metrics:(NSDictionary*)metrics
+{
+    static NSRegularExpression* standardSpacingPattern;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        standardSpacingPattern = [NSRegularExpression regularExpressionWithPattern:@"[\\]|]-[\\[|]"
+                                                                          options:0
+                                                                            error:nil];
+    });
+
+    if ([standardSpacingPattern firstMatchInString:self.format
+                                           options:0
+                                             range:NSMakeRange(0, self.format.length)] != nil)
+    {
+        return nil;
+    }
+
+    UIView* superview = [UIView new];
+    NSMutableDictionary<NSString*, UIView*>* placeholders = [NSMutableDictionary dictionaryWithCapacity:views.count];
+    NSMapTable<UIView*, NSString*>* namesByPlaceholder = [NSMapTable strongToStrongObjectsMapTable];
+    for (NSString* name in views)
+    {
+        if (![views[name] isKindOfClass:[UIView class]])
+        {
+            return nil;
+        }
+        UIView* placeholder = [UIView new];
+        placeholder.translatesAutoresizingMaskIntoConstraints = NO;
+        [superview addSubview:placeholder];
+        placeholders[name] = placeholder;
+        [namesByPlaceholder setObject:name forKey:placeholder];
+    }
+    [namesByPlaceholder setObject:AKALayoutConstraintTemplateSuperview forKey:superview];
+
+    NSArray<NSLayoutConstraint*>* constraints =
+        [NSLayoutConstraint constraintsWithVisualFormat:self.format
+                                                options:self.options
+                                                metrics:metrics
+                                                  views:placeholders];
+
+    NSMutableArray<AKALayoutConstraintTemplate*>* result = [NSMutableArray arrayWithCapacity:constraints.count];
+    for (NSLayoutConstraint* constraint in constraints)
+    {
+        AKALayoutConstraintTemplate* template = [AKALayoutConstraintTemplate new];
+        template.firstItemName = [namesByPlaceholder objectForKey:constraint.firstItem];
+        template.secondItemName = constraint.secondItem ? [namesByPlaceholder objectForKey:constraint.secondItem] : nil;
+        if (template.firstItemName == nil || (constraint.secondItem != nil && template.secondItemName == nil))
+        {
+            return nil;
+        }
+        template.firstAttribute = constraint.firstAttribute;
+        template.relation = constraint.relation;
+        template.secondAttribute = constraint.secondAttribute;
+        template.multiplier = constraint.multiplier;
+        template.constant = constraint.constant;
+        template.priority = constraint.priority;
+        [result addObject:template];
+    }
+
+    return result;
+}
+
+/**
+ * Instantiates the specified templates for the specified views.
+ *
+ * @return the constraints or nil, if a template refers to the superview of a view which does not have a superview (in which case the visual format has to be evaluated to report the error).
+ */
+- (NSArray<NSLayoutConstraint*>*)constraintsWithTemplates:(NSArray<AKALayoutConstraintTemplate*>*)templates
+                                                 forViews:(NSDictionary*)views
+{
+    NSMutableArray<NSLayoutConstraint*>* result = [NSMutableArray arrayWithCapacity:templates.count];
+
+    for (AKALayoutConstraintTemplate* template in templates)
+    {
+        id firstItem = [self itemForName:template.firstItemName
+                              otherName:template.secondItemName
+                              withViews:views];
+        id secondItem = template.secondItemName ? [self itemForName:template.secondItemName
+                                                          otherName:template.firstItemName
+                                                          withViews:views] : nil;
+        if (firstItem == nil || (template.secondItemName != nil && secondItem == nil))
+        {
+            return nil;
+        }
+
+        NSLayoutConstraint* constraint =
+            [NSLayoutConstraint constraintWithItem:firstItem
+                                         attribute:template.firstAttribute
+                                         relatedBy:template.relation
+                                            toItem:secondItem
+                                         attribute:template.secondAttribute
+                                        multiplier:template.multiplier
+                                          constant:template.constant];
+        constraint.priority = template.priority;
+        [result addObject:constraint];
+    }
+
+    return result;
+}
+
+- (id)itemForName:(NSString*)name
+        otherName:(NSString*)otherName
+        withViews:(NSDictionary*)views
+{
+    id result = nil;
+
+    if (name == AKALayoutConstraintTemplateSuperview)
+    {
+        if (otherName != nil && otherName != AKALayoutConstraintTemplateSuperview)
+        {
+            result = ((UIView*)views[otherName]).superview;
+        }
+    }
+    else
+    {
+        result = views[name];
+    }
+
+    return result;
 }
 
 @end
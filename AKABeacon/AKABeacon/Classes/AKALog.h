@@ -8,54 +8,137 @@
 
 @import Foundation;
 
-#if 1
-
-// Removed the dependency on Lumberjack. Until modular pods support is there, we'll just use NSLog (incredibly slow)
-
-#if DEBUG
-#define AKALogError(format, ...)   NSLog(format, ##__VA_ARGS__)
-#define AKALogWarn(format, ...)    NSLog(format, ##__VA_ARGS__)
-#define AKALogInfo(format, ...)    NSLog(format, ##__VA_ARGS__)
-#define AKALogDebug(format, ...)   NSLog(format, ##__VA_ARGS__)
-#define AKALogVerbose(format, ...)
-#else
-#define AKALogError(format, ...)   NSLog(format, ##__VA_ARGS__)
-#define AKALogWarn(format, ...)
-#define AKALogInfo(format, ...)
-#define AKALogDebug(format, ...)
-#define AKALogVerbose(format, ...)
+
+#pragma mark - Log Levels
+#pragma mark -
+
+#define AKA_LOG_LEVEL_OFF       0
+#define AKA_LOG_LEVEL_ERROR     1
+#define AKA_LOG_LEVEL_WARN      2
+#define AKA_LOG_LEVEL_INFO      3
+#define AKA_LOG_LEVEL_DEBUG     4
+#define AKA_LOG_LEVEL_VERBOSE   5
+
+/**
+ The default maximum level of messages compiled into the framework. Defaults to debug for DEBUG builds and to error otherwise.
+ */
+#ifndef AKA_LOG_LEVEL
+#  if DEBUG
+#    define AKA_LOG_LEVEL AKA_LOG_LEVEL_DEBUG
+#  else
+#    define AKA_LOG_LEVEL AKA_LOG_LEVEL_ERROR
+#  endif
 #endif
 
-#else
 
-@import CocoaLumberjack;
+#pragma mark - Log Categories
+#pragma mark -
 
-#ifndef AKA_SUPPORT_DYNAMIC_LOG_LEVELS
-#  define AKA_SUPPORT_DYNAMIC_LOG_LEVELS 1
-#endif
+// Each category has its own compile time level gate, which defaults to AKA_LOG_LEVEL. Define
+// AKA_LOG_LEVEL_<Category> in the build settings to enable or disable messages of a category. Messages
+// above the level of their category are compiled out (including the evaluation of their arguments).
 
-#if AKA_SUPPORT_DYNAMIC_LOG_LEVELS
-#  define AKA_LOG_LEVEL_DEF ([AKALog sharedInstance].logLevel)
-#else
-#  define AKA_LOG_LEVEL_DEF DDLogLevelWarning
+#ifndef AKA_LOG_LEVEL_Default
+#  define AKA_LOG_LEVEL_Default AKA_LOG_LEVEL
 #endif
 
-#define AKALogError(format, ...)   LOG_MAYBE(NO,                AKA_LOG_LEVEL_DEF, DDLogFlagError,   0, nil, __PRETTY_FUNCTION__, format, ##__VA_ARGS__)
-#define AKALogWarn(format, ...)    LOG_MAYBE(LOG_ASYNC_ENABLED, AKA_LOG_LEVEL_DEF, DDLogFlagWarning, 0, nil, __PRETTY_FUNCTION__, format, ##__VA_ARGS__)
-#define AKALogInfo(format, ...)    LOG_MAYBE(LOG_ASYNC_ENABLED, AKA_LOG_LEVEL_DEF, DDLogFlagInfo,    0, nil, __PRETTY_FUNCTION__, format, ##__VA_ARGS__)
-#define AKALogDebug(format, ...)   LOG_MAYBE(LOG_ASYNC_ENABLED, AKA_LOG_LEVEL_DEF, DDLogFlagDebug,   0, nil, __PRETTY_FUNCTION__, format, ##__VA_ARGS__)
-#define AKALogVerbose(format, ...) LOG_MAYBE(LOG_ASYNC_ENABLED, AKA_LOG_LEVEL_DEF, DDLogFlagVerbose, 0, nil, __PRETTY_FUNCTION__, format, ##__VA_ARGS__)
+#ifndef AKA_LOG_LEVEL_Binding
+#  define AKA_LOG_LEVEL_Binding AKA_LOG_LEVEL
+#endif
 
-@interface AKALog : NSObject
+#ifndef AKA_LOG_LEVEL_Control
+#  define AKA_LOG_LEVEL_Control AKA_LOG_LEVEL
+#endif
 
-#if AKA_SUPPORT_DYNAMIC_LOG_LEVELS
+#ifndef AKA_LOG_LEVEL_Delegate
+#  define AKA_LOG_LEVEL_Delegate AKA_LOG_LEVEL
+#endif
 
-+ (AKALog*)sharedInstance;
+#ifndef AKA_LOG_LEVEL_TableView
+#  define AKA_LOG_LEVEL_TableView AKA_LOG_LEVEL
+#endif
 
-@property(nonatomic) DDLogLevel logLevel;
 
-#endif
+#pragma mark - Logging Macros
+#pragma mark -
+
+#define AKALogC(category, level, format, ...) \
+    do { \
+        if ((level) <= AKA_LOG_LEVEL_##category) \
+        { \
+            AKALogMessage((level), #category, __PRETTY_FUNCTION__, format, ##__VA_ARGS__); \
+        } \
+    } while (0)
+
+#define AKALogErrorC(category, format, ...)   AKALogC(category, AKA_LOG_LEVEL_ERROR, format, ##__VA_ARGS__)
+#define AKALogWarnC(category, format, ...)    AKALogC(category, AKA_LOG_LEVEL_WARN, format, ##__VA_ARGS__)
+#define AKALogInfoC(category, format, ...)    AKALogC(category, AKA_LOG_LEVEL_INFO, format, ##__VA_ARGS__)
+#define AKALogDebugC(category, format, ...)   AKALogC(category, AKA_LOG_LEVEL_DEBUG, format, ##__VA_ARGS__)
+#define AKALogVerboseC(category, format, ...) AKALogC(category, AKA_LOG_LEVEL_VERBOSE, format, ##__VA_ARGS__)
+
+#define AKALogError(format, ...)   AKALogErrorC(Default, format, ##__VA_ARGS__)
+#define AKALogWarn(format, ...)    AKALogWarnC(Default, format, ##__VA_ARGS__)
+#define AKALogInfo(format, ...)    AKALogInfoC(Default, format, ##__VA_ARGS__)
+#define AKALogDebug(format, ...)   AKALogDebugC(Default, format, ##__VA_ARGS__)
+#define AKALogVerbose(format, ...) AKALogVerboseC(Default, format, ##__VA_ARGS__)
+
+/**
+ Formats the message and enqueues it in the log's ring buffer. This is called by the logging macros for messages which passed their category's level gate, use the macros instead of calling this function directly.
+
+ Formatting the message is the only work done on the calling thread. It cannot be deferred, because the arguments (and the objects they refer to) are only guaranteed to be valid during the call; messages above their category's level are not formatted, since the macros compile them out. Time stamps, prefixes and output are handled by the log's background thread, which is woken up when messages are published. If the ring buffer is full, the message is dropped (see AKALog.droppedMessageCount).
+ */
+FOUNDATION_EXPORT void AKALogMessage(NSInteger level,
+                                     const char* _Nonnull category,
+                                     const char* _Nonnull function,
+                                     NSString* _Nonnull format, ...) NS_FORMAT_FUNCTION(4,5);
+
+
+#pragma mark - AKALog
+#pragma mark -
+
+/**
+ Manages the output of log messages.
+
+ Messages are enqueued in a fixed size lock-free ring buffer and written by a background thread to the log file (and to the standard error output, if enabled). The most recent messages are kept in memory and can be retrieved for crash or error reports.
+ */
+@interface AKALog: NSObject
+
+/**
+ The file receiving log messages. Defaults to AKABeacon.log in the application's caches directory. Setting the URL to nil disables file output.
+ */
++ (nullable NSURL*)logFileURL;
++ (void)setLogFileURL:(nullable NSURL*)logFileURL;
+
+/**
+ The size in bytes at which the log file is rotated. The rotated file is kept (replacing an older one) at the log file URL with the additional path extension "1". Defaults to 1 MB.
+ */
++ (unsigned long long)maximumLogFileSize;
++ (void)setMaximumLogFileSize:(unsigned long long)maximumLogFileSize;
+
+/**
+ Determines whether messages are also written to the standard error output (where NSLog writes to). Defaults to YES for DEBUG builds and to NO otherwise. If disabled, error messages are still written to the console using NSLog.
+ */
++ (BOOL)echoToStandardError;
++ (void)setEchoToStandardError:(BOOL)echoToStandardError;
+
+/**
+ The number of messages dropped because the ring buffer was full.
+ */
++ (NSUInteger)droppedMessageCount;
+
+/**
+ Blocks until all messages enqueued before the call have been written.
+ */
++ (void)flush;
+
+/**
+ Writes pending messages and returns the most recent messages (oldest first).
+ */
++ (nonnull NSArray<NSString*>*)recentMessages;
+
+/**
+ Writes pending messages and returns the most recent messages as text suitable for inclusion in crash or error reports.
+ */
++ (nonnull NSString*)dump;
 
 @end
-
-#endif
@@ -6,4 +6,444 @@
 //  Copyright (c) 2015 Michael Utech & AKA Sarl. All rights reserved.
 //
 
+#import <stdatomic.h>
+
 #import "AKALog.h"
+
+
+#pragma mark - Ring Buffer
+#pragma mark -
+
+// Capacity of the ring buffer, has to be a power of two.
+#define AKALogRingBufferCapacity        1024
+#define AKALogRingBufferMask            (AKALogRingBufferCapacity - 1)
+
+#define AKALogRecentMessagesCapacity    256
+
+// Size of the log file at which it is rotated.
+#define AKALogDefaultMaximumFileSize    (1024 * 1024)
+
+/**
+ A slot in the ring buffer. The ring buffer is a bounded multiple producer queue: producers claim positions by advancing the enqueue position and publish a slot by setting its sequence to the claimed position + 1. The consumer (serialized by the drain lock) releases slots by advancing their sequence by the capacity of the buffer.
+ */
+typedef struct
+{
+    _Atomic(uint_fast64_t)  sequence;
+    NSInteger               level;
+    const char*             category;
+    const char*             function;
+    CFAbsoluteTime          timestamp;
+    CFTypeRef               message;
+} AKALogRingBufferSlot;
+
+static AKALogRingBufferSlot     akaLogRingBuffer[AKALogRingBufferCapacity];
+static _Atomic(uint_fast64_t)   akaLogEnqueuePosition;
+static _Atomic(uint_fast64_t)   akaLogDroppedMessageCount;
+
+// Set by the first producer publishing a message after the drain thread started draining, only
+// this producer signals the drain thread.
+static atomic_bool              akaLogDrainPending;
+
+// Only accessed while holding the drain lock:
+static uint_fast64_t            akaLogDequeuePosition;
+
+
+#pragma mark - AKALog - Private Interface
+#pragma mark -
+
+@interface AKALog()
+
++ (void)initializeIfNeeded;
+
++ (void)signalDrainThread;
+
+@end
+
+
+#pragma mark - Logging Function
+#pragma mark -
+
+void AKALogMessage(NSInteger level,
+                   const char* _Nonnull category,
+                   const char* _Nonnull function,
+                   NSString* _Nonnull format, ...)
+{
+    [AKALog initializeIfNeeded];
+
+    va_list args;
+    va_start(args, format);
+    NSString* message = [[NSString alloc] initWithFormat:format arguments:args];
+    va_end(args);
+
+    AKALogRingBufferSlot* slot = NULL;
+    uint_fast64_t position = atomic_load_explicit(&akaLogEnqueuePosition, memory_order_relaxed);
+    for (;;)
+    {
+        slot = &akaLogRingBuffer[position & AKALogRingBufferMask];
+        uint_fast64_t sequence = atomic_load_explicit(&slot->sequence, memory_order_acquire);
+        int64_t difference = (int64_t)sequence - (int64_t)position;
+
+        if (difference == 0)
+        {
+            if (atomic_compare_exchange_weak_explicit(&akaLogEnqueuePosition,
+                                                      &position, position + 1,
+                                                      memory_order_relaxed,
+                                                      memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (difference < 0)
+        {
+            // Buffer is full, the message is dropped rather than blocking the caller
+            slot = NULL;
+            break;
+        }
+        else
+        {
+            position = atomic_load_explicit(&akaLogEnqueuePosition, memory_order_relaxed);
+        }
+    }
+
+    if (slot != NULL)
+    {
+        slot->level = level;
+        slot->category = category;
+        slot->function = function;
+        slot->timestamp = CFAbsoluteTimeGetCurrent();
+        slot->message = CFBridgingRetain(message);
+        atomic_store_explicit(&slot->sequence, position + 1, memory_order_release);
+
+        if (!atomic_exchange(&akaLogDrainPending, true))
+        {
+            [AKALog signalDrainThread];
+        }
+    }
+    else
+    {
+        atomic_fetch_add_explicit(&akaLogDroppedMessageCount, 1, memory_order_relaxed);
+    }
+}
+
+
+#pragma mark - AKALog - Implementation
+#pragma mark -
+
+@implementation AKALog
+
+static NSLock*                      akaLogDrainLock;
+static dispatch_semaphore_t         akaLogDrainSignal;
+static NSMutableArray<NSString*>*   akaLogRecentMessages;
+static NSDateFormatter*             akaLogDateFormatter;
+static NSURL*                       akaLogFileURL;
+static NSFileHandle*                akaLogFileHandle;
+static unsigned long long           akaLogFileSize;
+static unsigned long long           akaLogMaximumFileSize;
+static BOOL                         akaLogEchoToStandardError;
+
+#pragma mark - Initialization
+
++ (void)initializeIfNeeded
+{
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        for (uint_fast64_t i = 0; i < AKALogRingBufferCapacity; ++i)
+        {
+            atomic_init(&akaLogRingBuffer[i].sequence, i);
+        }
+        atomic_init(&akaLogEnqueuePosition, 0);
+        atomic_init(&akaLogDroppedMessageCount, 0);
+        atomic_init(&akaLogDrainPending, false);
+
+        akaLogDrainLock = [NSLock new];
+        akaLogDrainSignal = dispatch_semaphore_create(0);
+        akaLogRecentMessages = [NSMutableArray arrayWithCapacity:AKALogRecentMessagesCapacity];
+
+        akaLogDateFormatter = [NSDateFormatter new];
+        akaLogDateFormatter.locale = [NSLocale localeWithLocaleIdentifier:@"en_US_POSIX"];
+        akaLogDateFormatter.dateFormat = @"yyyy-MM-dd HH:mm:ss.SSS";
+
+        NSURL* cachesURL = [[NSFileManager defaultManager] URLsForDirectory:NSCachesDirectory
+                                                                  inDomains:NSUserDomainMask].firstObject;
+        akaLogFileURL = [cachesURL URLByAppendingPathComponent:@"AKABeacon.log"];
+        akaLogMaximumFileSize = AKALogDefaultMaximumFileSize;
+#if DEBUG
+        akaLogEchoToStandardError = YES;
+#endif
+
+        NSThread* drainThread = [[NSThread alloc] initWithTarget:self
+                                                        selector:@selector(drainThreadMain)
+                                                          object:nil];
+        drainThread.name = @"AKALog";
+        drainThread.qualityOfService = NSQualityOfServiceBackground;
+        [drainThread start];
+    });
+}
+
+#pragma mark - Configuration
+
++ (NSURL*)logFileURL
+{
+    [self initializeIfNeeded];
+
+    [akaLogDrainLock lock];
+    NSURL* result = akaLogFileURL;
+    [akaLogDrainLock unlock];
+
+    return result;
+}
+
++ (void)setLogFileURL:(NSURL*)logFileURL
+{
+    [self initializeIfNeeded];
+
+    [akaLogDrainLock lock];
+    if (logFileURL != akaLogFileURL && ![logFileURL isEqual:akaLogFileURL])
+    {
+        [akaLogFileHandle closeFile];
+        akaLogFileHandle = nil;
+        akaLogFileURL = logFileURL;
+    }
+    [akaLogDrainLock unlock];
+}
+
++ (unsigned long long)maximumLogFileSize
+{
+    [self initializeIfNeeded];
+
+    [akaLogDrainLock lock];
+    unsigned long long result = akaLogMaximumFileSize;
+    [akaLogDrainLock unlock];
+
+    return result;
+}
+
++ (void)setMaximumLogFileSize:(unsigned long long)maximumLogFileSize
+{
+    [self initializeIfNeeded];
+
+    [akaLogDrainLock lock];
+    akaLogMaximumFileSize = maximumLogFileSize;
+    [akaLogDrainLock unlock];
+}
+
++ (BOOL)echoToStandardError
+{
+    [self initializeIfNeeded];
+
+    [akaLogDrainLock lock];
+    BOOL result = akaLogEchoToStandardError;
+    [akaLogDrainLock unlock];
+
+    return result;
+}
+
++ (void)setEchoToStandardError:(BOOL)echoToStandardError
+{
+    [self initializeIfNeeded];
+
+    [akaLogDrainLock lock];
+    akaLogEchoToStandardError = echoToStandardError;
+    [akaLogDrainLock unlock];
+}
+
++ (NSUInteger)droppedMessageCount
+{
+    return (NSUInteger)atomic_load_explicit(&akaLogDroppedMessageCount, memory_order_relaxed);
+}
+
+#pragma mark - Output
+
++ (void)flush
+{
+    [self initializeIfNeeded];
+    [self drain];
+}
+
++ (NSArray<NSString*>*)recentMessages
+{
+    [self initializeIfNeeded];
+
+    [akaLogDrainLock lock];
+    [self drainLocked];
+    NSArray* result = [akaLogRecentMessages copy];
+    [akaLogDrainLock unlock];
+
+    return result;
+}
+
++ (NSString*)dump
+{
+    NSArray* messages = [self recentMessages];
+    NSMutableString* result = [NSMutableString new];
+
+    NSUInteger dropped = self.droppedMessageCount;
+    if (dropped > 0)
+    {
+        [result appendFormat:@"(%lu log messages dropped)\n", (unsigned long)dropped];
+    }
+    for (NSString* message in messages)
+    {
+        [result appendString:message];
+    }
+
+    return result;
+}
+
+#pragma mark - Implementation
+
++ (void)signalDrainThread
+{
+    dispatch_semaphore_signal(akaLogDrainSignal);
+}
+
++ (void)drainThreadMain
+{
+    for (;;)
+    {
+        @autoreleasepool
+        {
+            dispatch_semaphore_wait(akaLogDrainSignal, DISPATCH_TIME_FOREVER);
+
+            // Cleared before draining, so that messages published while draining signal again
+            atomic_store(&akaLogDrainPending, false);
+            [self drain];
+        }
+    }
+}
+
++ (void)drain
+{
+    [akaLogDrainLock lock];
+    [self drainLocked];
+    [akaLogDrainLock unlock];
+}
+
+/**
+ Dequeues all published messages, formats and writes them. Has to be called while holding the drain lock.
+ */
++ (void)drainLocked
+{
+    NSMutableString* output = nil;
+
+    for (;;)
+    {
+        uint_fast64_t position = akaLogDequeuePosition;
+        AKALogRingBufferSlot* slot = &akaLogRingBuffer[position & AKALogRingBufferMask];
+        uint_fast64_t sequence = atomic_load_explicit(&slot->sequence, memory_order_acquire);
+
+        if (sequence != position + 1)
+        {
+            // Slot not (yet) published
+            break;
+        }
+
+        NSString* message = CFBridgingRelease(slot->message);
+        slot->message = NULL;
+        NSString* line = [NSString stringWithFormat:@"%@ %@ [%s] %s: %@\n",
+                          [akaLogDateFormatter stringFromDate:[NSDate dateWithTimeIntervalSinceReferenceDate:slot->timestamp]],
+                          [self nameForLevel:slot->level],
+                          slot->category,
+                          slot->function,
+                          message];
+        atomic_store_explicit(&slot->sequence, position + AKALogRingBufferCapacity, memory_order_release);
+        akaLogDequeuePosition = position + 1;
+
+        if (slot->level <= AKA_LOG_LEVEL_ERROR && !akaLogEchoToStandardError)
+        {
+            // Errors always reach the console, as they did when logging used NSLog
+            NSLog(@"[%s] %s: %@", slot->category, slot->function, message);
+        }
+
+        if (akaLogRecentMessages.count >= AKALogRecentMessagesCapacity)
+        {
+            [akaLogRecentMessages removeObjectAtIndex:0];
+        }
+        [akaLogRecentMessages addObject:line];
+
+        if (output == nil)
+        {
+            output = [NSMutableString new];
+        }
+        [output appendString:line];
+    }
+
+    if (output.length > 0)
+    {
+        [self writeOutput:output];
+    }
+}
+
++ (void)writeOutput:(NSString*)output
+{
+    NSData* data = [output dataUsingEncoding:NSUTF8StringEncoding];
+
+    if (akaLogFileHandle == nil && akaLogFileURL != nil)
+    {
+        NSString* path = akaLogFileURL.path;
+        if (![[NSFileManager defaultManager] fileExistsAtPath:path])
+        {
+            [[NSFileManager defaultManager] createFileAtPath:path contents:nil attributes:nil];
+        }
+        akaLogFileHandle = [NSFileHandle fileHandleForWritingAtPath:path];
+        akaLogFileSize = [akaLogFileHandle seekToEndOfFile];
+    }
+    if (akaLogFileHandle != nil)
+    {
+        [akaLogFileHandle writeData:data];
+        akaLogFileSize += data.length;
+
+        if (akaLogFileSize >= akaLogMaximumFileSize)
+        {
+            [self rotateLogFile];
+        }
+    }
+
+    if (akaLogEchoToStandardError)
+    {
+        fwrite(data.bytes, 1, data.length, stderr);
+    }
+}
+
+/**
+ Closes the log file and moves it to the previous log file URL (replacing an older previous log file). The next output starts a new log file. Has to be called while holding the drain lock.
+ */
++ (void)rotateLogFile
+{
+    [akaLogFileHandle closeFile];
+    akaLogFileHandle = nil;
+    akaLogFileSize = 0;
+
+    NSFileManager* fileManager = [NSFileManager defaultManager];
+    NSURL* previousLogFileURL = [akaLogFileURL URLByAppendingPathExtension:@"1"];
+    [fileManager removeItemAtURL:previousLogFileURL error:nil];
+    [fileManager moveItemAtURL:(NSURL*_Nonnull)akaLogFileURL toURL:previousLogFileURL error:nil];
+}
+
++ (NSString*)nameForLevel:(NSInteger)level
+{
+    NSString* result = nil;
+
+    switch (level)
+    {
+        case AKA_LOG_LEVEL_ERROR:
+            result = @"ERROR";
+            break;
+        case AKA_LOG_LEVEL_WARN:
+            result = @"WARN ";
+            break;
+        case AKA_LOG_LEVEL_INFO:
+            result = @"INFO ";
+            break;
+        case AKA_LOG_LEVEL_DEBUG:
+            result = @"DEBUG";
+            break;
+        default:
+            result = @"TRACE";
+            break;
+    }
+
+    return result;
+}
+
+@end
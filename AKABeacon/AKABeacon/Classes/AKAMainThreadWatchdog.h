@@ -0,0 +1,125 @@
+//
+//  AKAMainThreadWatchdog.h
+//  AKABeacon
+//
+//  Created by Michael Utech on 19.10.16.
+//  Copyright © 2016 Michael Utech & AKA Sarl. All rights reserved.
+//
+
+@import Foundation;
+
+#import "AKANullability.h"
+
+@class AKAMainThreadWatchdog;
+#define req_AKAMainThreadWatchdog AKAMainThreadWatchdog*_Nonnull
+
+@class AKAMainThreadStall;
+#define req_AKAMainThreadStall AKAMainThreadStall*_Nonnull
+
+
+#pragma mark - AKAMainThreadStall - Interface
+#pragma mark -
+
+/**
+ Describes a span of work on the main thread which exceeded the budget of the main thread watchdog.
+ */
+@interface AKAMainThreadStall: NSObject
+
+/**
+ The name of the monitored operation, for example "-[AKABinding updateTargetValue]".
+ */
+@property(nonatomic, readonly, nonnull) NSString*     operation;
+
+/**
+ The type of the object performing the operation (typically a binding).
+ */
+@property(nonatomic, readonly, nullable) Class        objectType;
+
+/**
+ Identifies the object performing the operation (type and address).
+ */
+@property(nonatomic, readonly, nullable) NSString*    objectIdentity;
+
+/**
+ The text of the binding expression, if the operation has been performed by a binding.
+ */
+@property(nonatomic, readonly, nullable) NSString*    expressionText;
+
+@property(nonatomic, readonly) NSTimeInterval         duration;
+
+@property(nonatomic, readonly, nonnull) NSDate*       date;
+
+@end
+
+
+#pragma mark - AKAMainThreadWatchdogDelegate
+#pragma mark -
+
+@protocol AKAMainThreadWatchdogDelegate<NSObject>
+
+/**
+ Called on the main thread when a monitored span exceeded the budget, after the stall has been added to the report.
+ */
+- (void)        mainThreadWatchdog:(req_AKAMainThreadWatchdog)watchdog
+                    didRecordStall:(req_AKAMainThreadStall)stall;
+
+@end
+
+
+#pragma mark - AKAMainThreadWatchdog - Interface
+#pragma mark -
+
+/**
+ Monitors binding and table view update work performed on the main thread and records spans exceeding the configured budget.
+
+ The watchdog is disabled by default. While disabled, the monitored entry points only check a flag. While enabled, they record two timestamps per span. Descriptions of the work are only created for spans exceeding the budget.
+ */
+@interface AKAMainThreadWatchdog: NSObject
+
++ (req_AKAMainThreadWatchdog)sharedWatchdog;
+
+- (nonnull instancetype)init NS_UNAVAILABLE;
++ (nonnull instancetype)new NS_UNAVAILABLE;
+
+@property(nonatomic, getter=isEnabled) BOOL                             enabled;
+
+/**
+ The maximum duration of a monitored span which is not considered a stall. Defaults to 8ms (half a frame at 60Hz).
+ */
+@property(nonatomic) NSTimeInterval                                     budget;
+
+/**
+ The maximum number of stalls kept in the report, older stalls are discarded. Defaults to 100.
+ */
+@property(nonatomic) NSUInteger                                         reportCapacity;
+
+@property(nonatomic, weak, nullable) id<AKAMainThreadWatchdogDelegate>  delegate;
+
+/**
+ The recorded stalls, oldest first.
+ */
+@property(nonatomic, readonly, nonnull) NSArray<AKAMainThreadStall*>*   report;
+
+- (void)                                                    clearReport;
+
+@end
+
+
+#pragma mark - Monitoring Hooks
+#pragma mark -
+
+/**
+ Starts a monitored span. Returns 0 if the watchdog is disabled or if not called on the main thread.
+ */
+FOUNDATION_EXPORT uint64_t AKAMainThreadWatchdogBeginSpan(void);
+
+/**
+ Ends the span started with AKAMainThreadWatchdogBeginSpan() and records a stall if the span exceeded the budget.
+
+ @param start the value returned by AKAMainThreadWatchdogBeginSpan(). Nothing is recorded if start is 0.
+ @param operation the name of the monitored operation (typically __PRETTY_FUNCTION__).
+ @param object the object performing the operation.
+ */
+FOUNDATION_EXPORT void AKAMainThreadWatchdogEndSpan(uint64_t start,
+                                                    const char*_Nonnull operation,
+                                                    opt_id object);
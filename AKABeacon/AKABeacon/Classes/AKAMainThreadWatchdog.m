@@ -0,0 +1,189 @@
+//
+//  AKAMainThreadWatchdog.m
+//  AKABeacon
+//
+//  Created by Michael Utech on 19.10.16.
+//  Copyright © 2016 Michael Utech & AKA Sarl. All rights reserved.
+//
+
+#import <mach/mach_time.h>
+#import <pthread.h>
+
+#import "AKAMainThreadWatchdog.h"
+#import "AKABinding.h"
+
+
+// Read by the monitoring hooks without synchronization, a span starting or ending while the
+// watchdog is being (re)configured may be misjudged, which is acceptable.
+static volatile BOOL    akaWatchdogEnabled;
+static uint64_t         akaWatchdogBudgetMachTime;
+
+static mach_timebase_info_data_t akaWatchdogTimebase(void)
+{
+    static mach_timebase_info_data_t result;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        mach_timebase_info(&result);
+    });
+    return result;
+}
+
+
+#pragma mark - AKAMainThreadStall - Implementation
+#pragma mark -
+
+@implementation AKAMainThreadStall
+
+- (instancetype)initWithOperation:(req_NSString)operation
+                           object:(opt_id)object
+                         duration:(NSTimeInterval)duration
+{
+    if (self = [super init])
+    {
+        _operation = operation;
+        _duration = duration;
+        _date = [NSDate date];
+        if (object)
+        {
+            _objectType = [object class];
+            _objectIdentity = [NSString stringWithFormat:@"<%@: %p>", _objectType, object];
+            if ([object isKindOfClass:[AKABinding class]])
+            {
+                _expressionText = ((AKABinding*)object).bindingExpression.text;
+            }
+        }
+    }
+    return self;
+}
+
+- (NSString *)description
+{
+    return [NSString stringWithFormat:@"%.3fms %@ %@%@",
+            self.duration * 1000.0, self.operation, self.objectIdentity ?: @"",
+            self.expressionText ? [NSString stringWithFormat:@" \"%@\"", self.expressionText] : @""];
+}
+
+@end
+
+
+#pragma mark - AKAMainThreadWatchdog - Private Interface
+#pragma mark -
+
+@interface AKAMainThreadWatchdog()
+
+@property(nonatomic, readonly) NSLock* reportLock;
+@property(nonatomic, readonly) NSMutableArray<AKAMainThreadStall*>* mutableReport;
+
+@end
+
+
+#pragma mark - AKAMainThreadWatchdog - Implementation
+#pragma mark -
+
+@implementation AKAMainThreadWatchdog
+
+#pragma mark - Initialization
+
++ (req_AKAMainThreadWatchdog)sharedWatchdog
+{
+    static AKAMainThreadWatchdog* result;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        result = [[AKAMainThreadWatchdog alloc] initShared];
+    });
+    return result;
+}
+
+- (instancetype)initShared
+{
+    if (self = [super init])
+    {
+        _reportLock = [NSLock new];
+        _mutableReport = [NSMutableArray new];
+        _reportCapacity = 100;
+        self.budget = .008;
+    }
+    return self;
+}
+
+#pragma mark - Configuration
+
+- (BOOL)isEnabled
+{
+    return akaWatchdogEnabled;
+}
+
+- (void)setEnabled:(BOOL)enabled
+{
+    akaWatchdogEnabled = enabled;
+}
+
+- (void)setBudget:(NSTimeInterval)budget
+{
+    _budget = budget;
+
+    mach_timebase_info_data_t timebase = akaWatchdogTimebase();
+    akaWatchdogBudgetMachTime = (uint64_t)(budget * NSEC_PER_SEC * timebase.denom / timebase.numer);
+}
+
+#pragma mark - Report
+
+- (NSArray<AKAMainThreadStall*>*)report
+{
+    [self.reportLock lock];
+    NSArray* result = [self.mutableReport copy];
+    [self.reportLock unlock];
+
+    return result;
+}
+
+- (void)clearReport
+{
+    [self.reportLock lock];
+    [self.mutableReport removeAllObjects];
+    [self.reportLock unlock];
+}
+
+- (void)recordStall:(req_AKAMainThreadStall)stall
+{
+    [self.reportLock lock];
+    [self.mutableReport addObject:stall];
+    if (self.mutableReport.count > self.reportCapacity)
+    {
+        [self.mutableReport removeObjectsInRange:NSMakeRange(0, self.mutableReport.count - self.reportCapacity)];
+    }
+    [self.reportLock unlock];
+
+    [self.delegate mainThreadWatchdog:self didRecordStall:stall];
+}
+
+@end
+
+
+#pragma mark - Monitoring Hooks
+#pragma mark -
+
+uint64_t AKAMainThreadWatchdogBeginSpan(void)
+{
+    return (akaWatchdogEnabled && pthread_main_np()) ? mach_absolute_time() : 0;
+}
+
+void AKAMainThreadWatchdogEndSpan(uint64_t start,
+                                  const char* operation,
+                                  id object)
+{
+    if (start != 0)
+    {
+        uint64_t elapsed = mach_absolute_time() - start;
+        if (elapsed > akaWatchdogBudgetMachTime)
+        {
+            mach_timebase_info_data_t timebase = akaWatchdogTimebase();
+            NSTimeInterval duration = (NSTimeInterval)elapsed * timebase.numer / timebase.denom / NSEC_PER_SEC;
+
+            AKAMainThreadStall* stall = [[AKAMainThreadStall alloc] initWithOperation:@(operation)
+                                                                               object:object
+                                                                             duration:duration];
+            [[AKAMainThreadWatchdog sharedWatchdog] recordStall:stall];
+        }
+    }
+}
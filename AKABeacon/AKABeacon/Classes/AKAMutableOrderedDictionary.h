@@ -25,8 +25,16 @@
 
 #import <Foundation/Foundation.h>
 
+/**
+ A mutable dictionary preserving the order in which keys have been added (or inserted).
+
+ The key sequence is stored in an order statistics tree (see AKAOrderStatisticTree), lookups by key take constant time, positional access, insertion and removal take logarithmic time.
+ */
 @interface AKAMutableOrderedDictionary<K, V> : NSMutableDictionary<K, V>
 
+/**
+ Inserts the object at the specified position. If the dictionary already contains the key, the existing entry is removed first (and anIndex refers to the position in the dictionary without that entry). If the index is out of range, an NSRangeException is raised and the dictionary is not changed.
+ */
 - (void)insertObject:(id)anObject
               forKey:(id)aKey
              atIndex:(NSUInteger)anIndex;
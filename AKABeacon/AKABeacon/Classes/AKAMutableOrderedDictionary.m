@@ -24,25 +24,32 @@
 //
 
 #import "AKAMutableOrderedDictionary.h"
+#import "AKAOrderStatisticTree.h"
+
+
+#pragma mark - AKAMutableOrderedDictionary - Private Interface
+#pragma mark -
 
 @interface AKAMutableOrderedDictionary<K, V>()
+{
+    NSMutableDictionary*    _objects;
 
-@property(nonatomic, readonly) NSMutableArray* sequence;
-@property(nonatomic, readonly) NSMutableDictionary<K, V>* storage;
+    // The key sequence. Keys are identified by equality and copied on insertion (just as
+    // NSDictionary does), the tree maps them to their nodes.
+    AKAOrderStatisticTree*  _keys;
+}
 
 @end
 
+
+#pragma mark - AKAMutableOrderedDictionary - Implementation
+#pragma mark -
+
 @implementation AKAMutableOrderedDictionary
 
 - (instancetype)init
 {
-    self = [super init];
-    if (self != nil)
-    {
-        _sequence = [NSMutableArray new];
-        _storage = [NSMutableDictionary new];
-    }
-    return self;
+    return [self initWithCapacity:0];
 }
 
 - (instancetype)initWithCapacity:(NSUInteger)capacity
@@ -50,19 +57,24 @@
 	self = [super init];
 	if (self != nil)
 	{
-        _sequence = [NSMutableArray new];
-        _storage = [[NSMutableDictionary alloc] initWithCapacity:capacity];
+        _objects = [[NSMutableDictionary alloc] initWithCapacity:capacity];
+        _keys = [[AKAOrderStatisticTree alloc] initWithItems:nil
+                                                 itemOptions:(NSPointerFunctionsStrongMemory |
+                                                              NSPointerFunctionsObjectPersonality)];
 	}
 	return self;
 }
 
 - (instancetype)initWithCoder:(NSCoder *)aDecoder
 {
-    self = [super init];
+    self = [self initWithCapacity:0];
     if (self != nil)
     {
-        _storage = [[NSMutableDictionary alloc] initWithCoder:aDecoder];
-        _sequence = [NSMutableArray new];
+        NSDictionary* storage = [[NSDictionary alloc] initWithCoder:aDecoder];
+        for (id key in storage)
+        {
+            [self setObject:storage[key] forKey:key];
+        }
     }
     return self;
 }
@@ -72,54 +84,98 @@
 	return [self mutableCopy];
 }
 
-- (void)setObject:(id)anObject forKey:(id)aKey
+#pragma mark - NSDictionary
+
+- (NSUInteger)count
 {
-	if (!self.storage[aKey])
-	{
-		[self.sequence addObject:aKey];
-	}
-	self.storage[aKey] = anObject;
+	return _objects.count;
 }
 
-- (void)removeObjectForKey:(id)aKey
+- (id)objectForKey:(id)aKey
 {
-	[self.storage removeObjectForKey:aKey];
-	[self.sequence removeObject:aKey];
+	return [_objects objectForKey:aKey];
 }
 
-- (NSUInteger)count
+- (NSEnumerator *)keyEnumerator
 {
-	return [self.storage count];
+    return [_keys itemEnumerator];
 }
 
-- (id)objectForKey:(id)aKey
+- (NSEnumerator *)reverseKeyEnumerator
 {
-	return self.storage[aKey];
+    return [_keys reverseItemEnumerator];
 }
 
-- (NSEnumerator *)keyEnumerator
+- (NSUInteger)countByEnumeratingWithState:(NSFastEnumerationState *)state
+                                  objects:(id __unsafe_unretained [])buffer
+                                    count:(NSUInteger)len
 {
-	return [self.sequence objectEnumerator];
+    return [_keys countByEnumeratingWithState:state objects:buffer count:len];
 }
 
-- (NSEnumerator *)reverseKeyEnumerator
+- (id)keyAtIndex:(NSUInteger)anIndex
 {
-	return [self.sequence reverseObjectEnumerator];
+    if (anIndex >= self.count)
+    {
+        [NSException raise:NSRangeException
+                    format:@"Index %lu beyond bounds [0 .. %lu]",
+                           (unsigned long)anIndex, (unsigned long)self.count];
+    }
+	return [_keys itemAtIndex:anIndex];
 }
 
-- (void)insertObject:(id)anObject forKey:(id)aKey atIndex:(NSUInteger)anIndex
+#pragma mark - NSMutableDictionary
+
+- (void)setObject:(id)anObject forKey:(id)aKey
 {
-	if (self.storage[aKey])
+    NSParameterAssert(anObject != nil);
+    NSParameterAssert(aKey != nil);
+
+	if ([_objects objectForKey:aKey] == nil)
 	{
-		[self removeObjectForKey:aKey];
+        // Appending attaches the key to the last node of the key sequence
+        [_keys insertItem:[aKey copy] atIndex:_keys.count];
 	}
-	[self.sequence insertObject:aKey atIndex:anIndex];
-	self.storage[aKey] = anObject;
+    [_objects setObject:anObject forKey:aKey];
 }
 
-- (id)keyAtIndex:(NSUInteger)anIndex
+- (void)removeObjectForKey:(id)aKey
 {
-	return self.sequence[anIndex];
+    if (aKey != nil && [_objects objectForKey:aKey] != nil)
+    {
+        [_keys removeItem:aKey];
+        [_objects removeObjectForKey:aKey];
+    }
+}
+
+- (void)removeAllObjects
+{
+    [_keys removeAllItems];
+    [_objects removeAllObjects];
+}
+
+- (void)insertObject:(id)anObject forKey:(id)aKey atIndex:(NSUInteger)anIndex
+{
+    NSParameterAssert(anObject != nil);
+    NSParameterAssert(aKey != nil);
+
+    // Validate the index before removing an existing entry, so that the dictionary is left
+    // unchanged if the index is out of range.
+    BOOL isContained = [_objects objectForKey:aKey] != nil;
+    NSUInteger count = _keys.count - (isContained ? 1 : 0);
+    if (anIndex > count)
+    {
+        [NSException raise:NSRangeException
+                    format:@"Index %lu beyond bounds [0 .. %lu]",
+                           (unsigned long)anIndex, (unsigned long)count];
+    }
+
+    if (isContained)
+    {
+        [_keys removeItem:aKey];
+    }
+    [_keys insertItem:[aKey copy] atIndex:anIndex];
+    [_objects setObject:anObject forKey:aKey];
 }
 
 @end
@@ -64,15 +64,13 @@
     static dispatch_once_t onceToken;
     dispatch_once(&onceToken, ^{
 
-        [AKABindingExpressionSpecification registerEnumerationType:@"NSNumberFormatterStyle"
-                                                  withValuesByName:[AKANSEnumerations
-                                                                    numberStylesByName]];
-        [AKABindingExpressionSpecification registerEnumerationType:@"NSNumberFormatterRoundingMode"
-                                                  withValuesByName:[AKANSEnumerations
-                                                                    roundingModesByName]];
-        [AKABindingExpressionSpecification registerEnumerationType:@"NSNumberFormatterPadPosition"
-                                                  withValuesByName:[AKANSEnumerations
-                                                                    padPositionsByName]];
+        [AKABindingExpressionSpecification registerEnumerationTypes:@{ @"NSNumberFormatterStyle":
+                                                                           [AKANSEnumerations numberStylesByName],
+                                                                       @"NSNumberFormatterRoundingMode":
+                                                                           [AKANSEnumerations roundingModesByName],
+                                                                       @"NSNumberFormatterPadPosition":
+                                                                           [AKANSEnumerations padPositionsByName] }
+                                                       optionsTypes:nil];
     });
 }
 
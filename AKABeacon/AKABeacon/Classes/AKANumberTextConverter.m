@@ -8,10 +8,12 @@
 
 #import "AKANumberTextConverter.h"
 #import "AKABeaconErrors_Internal.h"
+#import "AKAConversionCache.h"
 
 @interface AKANumberTextConverter()
 
 @property(nonatomic, strong) NSNumberFormatter* numberFormatter;
+@property(nonatomic, readonly) AKAConversionCache* conversionCache;
 
 @end
 
@@ -25,6 +27,7 @@
         self.numberFormatter.numberStyle = NSNumberFormatterDecimalStyle;
         self.numberFormatter.usesGroupingSeparator = NO;
         self.numberFormatter.maximumFractionDigits = 100; // TODO: specify the value corresponding to the maximum possible number of fractional digits representable as NSNumber
+        _conversionCache = [AKAConversionCache new];
     }
     return self;
 }
@@ -39,7 +42,11 @@
     {
         if ([modelValue isKindOfClass:[NSNumber class]])
         {
-            viewValue = [self.numberFormatter stringFromNumber:modelValue];
+            if (![self.conversionCache lookupText:&viewValue forValue:modelValue context:self.numberFormatter])
+            {
+                viewValue = [self.numberFormatter stringFromNumber:modelValue];
+                [self.conversionCache recordText:viewValue forValue:modelValue context:self.numberFormatter];
+            }
         }
         else
         {
@@ -73,13 +80,20 @@
         {
             NSString* text = viewValue;
             NSString* description = nil;
-            result = [self.numberFormatter getObjectValue:&modelValue
-                                                forString:text
-                                         errorDescription:&description];
-            if (result && [text hasSuffix:self.numberFormatter.decimalSeparator])
+            if (![self.conversionCache lookupValue:&modelValue forText:text context:self.numberFormatter])
             {
-                result = NO;
-                description = @"Incomplete number (trailing decimal separator)";
+                result = [self.numberFormatter getObjectValue:&modelValue
+                                                    forString:text
+                                             errorDescription:&description];
+                if (result && [text hasSuffix:self.numberFormatter.decimalSeparator])
+                {
+                    result = NO;
+                    description = @"Incomplete number (trailing decimal separator)";
+                }
+                if (result)
+                {
+                    [self.conversionCache recordValue:modelValue forText:text context:self.numberFormatter];
+                }
             }
             if (!result && error != nil)
             {
@@ -0,0 +1,122 @@
+//
+//  AKAOrderStatisticTree.h
+//  AKABeacon
+//
+//  Created by Michael Utech on 19.10.16.
+//  Copyright © 2016 Michael Utech & AKA Sarl. All rights reserved.
+//
+
+@import Foundation;
+
+#import "AKANullability.h"
+
+
+#pragma mark - AKAOrderStatisticTree - Interface
+#pragma mark -
+
+/**
+ An ordered sequence of items supporting access by index and by item as well as insertion and removal of items in O(log n) (expected) time.
+
+ Items are stored in a randomized balanced binary search tree (treap) whose nodes know the size of their subtrees. An item can only be contained once. The order of items is defined by their insertion position, which is either specified explicitly, determined by a comparator or initially by the order of an array.
+
+ Items are referenced strongly or weakly and identified by equality or identity, as specified by the item options. Deallocated items of trees referencing their items weakly remain in the sequence as nil items until they are removed (see insertItem:usingComparator:).
+ */
+@interface AKAOrderStatisticTree: NSObject<NSFastEnumeration>
+
+#pragma mark - Initialization
+
+/**
+ Initializes an empty tree referencing items weakly and identifying them by identity.
+ */
+- (nonnull instancetype)                         init;
+
+/**
+ Initializes the tree with the specified items in O(n) time. Items are referenced weakly and identified by identity.
+
+ @param items items in the desired order, which must not contain duplicates.
+ */
+- (nonnull instancetype)                initWithItems:(nullable NSArray*)items;
+
+/**
+ Initializes the tree with the specified items in O(n) time.
+
+ @param items items in the desired order, which must not contain duplicates.
+ @param options NSPointerFunctionsStrongMemory or NSPointerFunctionsWeakMemory combined with NSPointerFunctionsObjectPersonality (items are identified by equality) or NSPointerFunctionsObjectPointerPersonality (items are identified by identity).
+ */
+- (nonnull instancetype)                initWithItems:(nullable NSArray*)items
+                                          itemOptions:(NSPointerFunctionsOptions)options NS_DESIGNATED_INITIALIZER;
+
+#pragma mark - Access
+
+@property(nonatomic, readonly) NSUInteger                           count;
+
+/**
+ Incremented whenever the sequence changes. Enumerators raise an NSGenericException if the sequence is changed while they are in use.
+ */
+@property(nonatomic, readonly) unsigned long                        mutations;
+
+/**
+ @return the item at the specified index or nil if the index is out of range or if the item has been deallocated.
+ */
+- (opt_id)                                itemAtIndex:(NSUInteger)index;
+
+/**
+ @return the index of the specified item or NSNotFound if the item is not contained in the tree.
+ */
+- (NSUInteger)                            indexOfItem:(req_id)item;
+
+/**
+ @return the contained item which is equal (or identical, depending on the item options) to the specified item, or nil if the tree does not contain such an item.
+ */
+- (opt_id)                                 memberItem:(req_id)item;
+
+/**
+ Enumerates the (not yet deallocated) items in order.
+ */
+- (void)                    enumerateItemsUsingBlock:(void(^_Nonnull)(req_id item, NSUInteger idx, outreq_BOOL stop))block;
+
+/**
+ @return an enumerator of the (not yet deallocated) items in order.
+ */
+- (nonnull NSEnumerator*)                itemEnumerator;
+
+/**
+ @return an enumerator of the (not yet deallocated) items in reverse order.
+ */
+- (nonnull NSEnumerator*)         reverseItemEnumerator;
+
+#pragma mark - Modification
+
+/**
+ Inserts the specified item before the first item which does not compare as ascending to the specified item.
+
+ Deallocated items which are encountered while locating the insert position are removed, indexes obtained before the insertion are therefore not necessarily shifted by one.
+
+ @param item the item to insert.
+ @param comparator compares items, or nil to append the item.
+
+ @return the index at which the item has been inserted or NSNotFound if the item is already contained in the tree.
+ */
+- (NSUInteger)                             insertItem:(req_id)item
+                                      usingComparator:(nullable NSComparator)comparator;
+
+/**
+ Inserts the specified item at the specified index. Appending items (inserting them at index count) does not need to locate the insert position.
+
+ @throws NSRangeException if the index is greater than count.
+
+ @return the index or NSNotFound if the item is already contained in the tree.
+ */
+- (NSUInteger)                             insertItem:(req_id)item
+                                              atIndex:(NSUInteger)index;
+
+/**
+ Removes the specified item.
+
+ @return the index of the removed item or NSNotFound if the item was not contained in the tree.
+ */
+- (NSUInteger)                             removeItem:(req_id)item;
+
+- (void)                               removeAllItems;
+
+@end
@@ -0,0 +1,681 @@
+//
+//  AKAOrderStatisticTree.m
+//  AKABeacon
+//
+//  Created by Michael Utech on 19.10.16.
+//  Copyright © 2016 Michael Utech & AKA Sarl. All rights reserved.
+//
+
+#import "AKAOrderStatisticTree.h"
+
+
+#pragma mark - AKAOrderStatisticTreeNode
+#pragma mark -
+
+// Nodes are accessed through their instance variables, the tree is also used for collections
+// (AKAMutableOrderedDictionary) where message sends for each visited node would dominate.
+
+@interface AKAOrderStatisticTreeNode: NSObject
+{
+    @package
+    AKAOrderStatisticTreeNode*                      _left;
+    AKAOrderStatisticTreeNode*                      _right;
+    // Parents own their children
+    __unsafe_unretained AKAOrderStatisticTreeNode*  _parent;
+    NSUInteger                                      _size;
+    uint32_t                                        _priority;
+    // Only one of the item references is used, depending on the tree's item options
+    id                                              _strongItem;
+    __weak id                                       _weakItem;
+}
+
+@end
+
+@implementation AKAOrderStatisticTreeNode
+@end
+
+static inline NSUInteger akaSizeOfNode(AKAOrderStatisticTreeNode* node)
+{
+    return node ? node->_size : 0;
+}
+
+static inline void akaUpdateSizeOfNode(AKAOrderStatisticTreeNode* node)
+{
+    node->_size = akaSizeOfNode(node->_left) + akaSizeOfNode(node->_right) + 1;
+}
+
+static inline id akaItemOfNode(AKAOrderStatisticTreeNode* node)
+{
+    return node->_strongItem ?: node->_weakItem;
+}
+
+static AKAOrderStatisticTreeNode* akaFirstNode(AKAOrderStatisticTreeNode* node)
+{
+    while (node && node->_left)
+    {
+        node = node->_left;
+    }
+    return node;
+}
+
+static AKAOrderStatisticTreeNode* akaLastNode(AKAOrderStatisticTreeNode* node)
+{
+    while (node && node->_right)
+    {
+        node = node->_right;
+    }
+    return node;
+}
+
+static AKAOrderStatisticTreeNode* akaSuccessorOfNode(AKAOrderStatisticTreeNode* node)
+{
+    AKAOrderStatisticTreeNode* result = nil;
+    if (node->_right)
+    {
+        result = akaFirstNode(node->_right);
+    }
+    else
+    {
+        while (node->_parent && node == node->_parent->_right)
+        {
+            node = node->_parent;
+        }
+        result = node->_parent;
+    }
+    return result;
+}
+
+static AKAOrderStatisticTreeNode* akaPredecessorOfNode(AKAOrderStatisticTreeNode* node)
+{
+    AKAOrderStatisticTreeNode* result = nil;
+    if (node->_left)
+    {
+        result = akaLastNode(node->_left);
+    }
+    else
+    {
+        while (node->_parent && node == node->_parent->_left)
+        {
+            node = node->_parent;
+        }
+        result = node->_parent;
+    }
+    return result;
+}
+
+
+#pragma mark - AKAOrderStatisticTree - Private Interface
+#pragma mark -
+
+@interface AKAOrderStatisticTree()
+{
+    AKAOrderStatisticTreeNode*                      _root;
+    // The last node in order, appended nodes are attached to it without locating the insert position.
+    __unsafe_unretained AKAOrderStatisticTreeNode*  _last;
+    BOOL                                            _weakItems;
+    unsigned long                                   _mutations;
+}
+
+/**
+ Nodes by item. Entries of deallocated items are discarded by the map table.
+ */
+@property(nonatomic, readonly) NSMapTable<id, AKAOrderStatisticTreeNode*>* nodesByItem;
+
+@end
+
+
+#pragma mark - AKAOrderStatisticTreeEnumerator
+#pragma mark -
+
+@interface AKAOrderStatisticTreeEnumerator: NSEnumerator
+
+- (instancetype)initWithTree:(AKAOrderStatisticTree*)tree
+                   firstNode:(AKAOrderStatisticTreeNode*)firstNode
+                     reverse:(BOOL)reverse;
+
+@end
+
+@implementation AKAOrderStatisticTreeEnumerator
+{
+    // Keeps the tree (and thereby the nodes) alive while enumerating.
+    AKAOrderStatisticTree* _tree;
+    AKAOrderStatisticTreeNode* _node;
+    BOOL _reverse;
+    unsigned long _mutations;
+}
+
+- (instancetype)initWithTree:(AKAOrderStatisticTree*)tree
+                   firstNode:(AKAOrderStatisticTreeNode*)firstNode
+                     reverse:(BOOL)reverse
+{
+    if (self = [super init])
+    {
+        _tree = tree;
+        _node = firstNode;
+        _reverse = reverse;
+        _mutations = tree.mutations;
+    }
+    return self;
+}
+
+- (id)nextObject
+{
+    id result = nil;
+
+    if (_mutations != _tree.mutations)
+    {
+        // The parent links of the current node may refer to released nodes
+        [NSException raise:NSGenericException
+                    format:@"Collection <%@: %p> was mutated while being enumerated.",
+                           _tree.class, (__bridge void*)_tree];
+    }
+
+    while (result == nil && _node != nil)
+    {
+        result = akaItemOfNode(_node);
+        _node = _reverse ? akaPredecessorOfNode(_node) : akaSuccessorOfNode(_node);
+    }
+
+    return result;
+}
+
+@end
+
+
+#pragma mark - AKAOrderStatisticTree - Implementation
+#pragma mark -
+
+@implementation AKAOrderStatisticTree
+
+#pragma mark - Initialization
+
+- (instancetype)init
+{
+    return [self initWithItems:nil];
+}
+
+- (instancetype)initWithItems:(NSArray*)items
+{
+    return [self initWithItems:items
+                   itemOptions:(NSPointerFunctionsWeakMemory |
+                                NSPointerFunctionsObjectPointerPersonality)];
+}
+
+- (instancetype)initWithItems:(NSArray*)items
+                  itemOptions:(NSPointerFunctionsOptions)options
+{
+    if (self = [super init])
+    {
+        _weakItems = (options & 0xFF) == NSPointerFunctionsWeakMemory;
+        _nodesByItem = [[NSMapTable alloc] initWithKeyOptions:options
+                                                 valueOptions:NSPointerFunctionsStrongMemory
+                                                     capacity:items.count];
+
+        // Priorities of built nodes are drawn from disjoint bands which decrease with the depth of
+        // nodes, this preserves the heap order of the treap without sorting priorities.
+        NSUInteger depth = 1;
+        for (NSUInteger count = items.count; count > 1; count /= 2)
+        {
+            ++depth;
+        }
+        _root = [self buildNodesWithItems:items
+                                    range:NSMakeRange(0, items.count)
+                                    depth:0
+                                 maxDepth:depth];
+        _last = akaLastNode(_root);
+    }
+    return self;
+}
+
+- (AKAOrderStatisticTreeNode*)buildNodesWithItems:(NSArray*)items
+                                            range:(NSRange)range
+                                            depth:(NSUInteger)depth
+                                         maxDepth:(NSUInteger)maxDepth
+{
+    AKAOrderStatisticTreeNode* result = nil;
+
+    if (range.length > 0)
+    {
+        NSUInteger mid = range.location + range.length / 2;
+        uint32_t band = (uint32_t)(UINT32_MAX / (maxDepth + 1));
+
+        result = [self createNodeWithItem:items[mid]];
+        result->_priority = (uint32_t)(maxDepth - depth) * band + arc4random_uniform(band);
+        result->_left = [self buildNodesWithItems:items
+                                            range:NSMakeRange(range.location, mid - range.location)
+                                            depth:depth + 1
+                                         maxDepth:maxDepth];
+        result->_right = [self buildNodesWithItems:items
+                                             range:NSMakeRange(mid + 1, NSMaxRange(range) - mid - 1)
+                                             depth:depth + 1
+                                          maxDepth:maxDepth];
+        if (result->_left)
+        {
+            result->_left->_parent = result;
+        }
+        if (result->_right)
+        {
+            result->_right->_parent = result;
+        }
+        akaUpdateSizeOfNode(result);
+    }
+
+    return result;
+}
+
+- (AKAOrderStatisticTreeNode*)createNodeWithItem:(id)item
+{
+    AKAOrderStatisticTreeNode* result = [AKAOrderStatisticTreeNode new];
+    if (_weakItems)
+    {
+        result->_weakItem = item;
+    }
+    else
+    {
+        result->_strongItem = item;
+    }
+    result->_priority = arc4random();
+    result->_size = 1;
+
+    [self.nodesByItem setObject:result forKey:item];
+
+    return result;
+}
+
+#pragma mark - Access
+
+- (NSUInteger)count
+{
+    return akaSizeOfNode(_root);
+}
+
+- (unsigned long)mutations
+{
+    return _mutations;
+}
+
+- (id)itemAtIndex:(NSUInteger)index
+{
+    AKAOrderStatisticTreeNode* node = _root;
+
+    while (node != nil)
+    {
+        NSUInteger leftSize = akaSizeOfNode(node->_left);
+        if (index < leftSize)
+        {
+            node = node->_left;
+        }
+        else if (index == leftSize)
+        {
+            break;
+        }
+        else
+        {
+            index -= leftSize + 1;
+            node = node->_right;
+        }
+    }
+
+    return node ? akaItemOfNode(node) : nil;
+}
+
+- (NSUInteger)indexOfItem:(id)item
+{
+    return [self indexOfNode:[self.nodesByItem objectForKey:item]];
+}
+
+- (NSUInteger)indexOfNode:(AKAOrderStatisticTreeNode*)node
+{
+    NSUInteger result = NSNotFound;
+
+    if (node != nil)
+    {
+        result = akaSizeOfNode(node->_left);
+        for (AKAOrderStatisticTreeNode* parent = node->_parent; parent != nil; parent = parent->_parent)
+        {
+            if (node == parent->_right)
+            {
+                result += akaSizeOfNode(parent->_left) + 1;
+            }
+            node = parent;
+        }
+    }
+
+    return result;
+}
+
+- (id)memberItem:(id)item
+{
+    AKAOrderStatisticTreeNode* node = [self.nodesByItem objectForKey:item];
+    return node ? akaItemOfNode(node) : nil;
+}
+
+- (void)enumerateItemsUsingBlock:(void (^)(req_id, NSUInteger, outreq_BOOL))block
+{
+    NSUInteger index = 0;
+    BOOL stop = NO;
+
+    for (AKAOrderStatisticTreeNode* node = akaFirstNode(_root);
+         !stop && node != nil;
+         node = akaSuccessorOfNode(node))
+    {
+        id item = akaItemOfNode(node);
+        if (item != nil)
+        {
+            block(item, index, &stop);
+        }
+        ++index;
+    }
+}
+
+- (NSEnumerator*)itemEnumerator
+{
+    return [[AKAOrderStatisticTreeEnumerator alloc] initWithTree:self
+                                                       firstNode:akaFirstNode(_root)
+                                                         reverse:NO];
+}
+
+- (NSEnumerator*)reverseItemEnumerator
+{
+    return [[AKAOrderStatisticTreeEnumerator alloc] initWithTree:self
+                                                       firstNode:_last
+                                                         reverse:YES];
+}
+
+- (NSUInteger)countByEnumeratingWithState:(NSFastEnumerationState *)state
+                                  objects:(id __unsafe_unretained [])buffer
+                                    count:(NSUInteger)len
+{
+    // state->extra[0] refers to the next node, fast enumeration checks mutationsPtr before
+    // requesting more items, so that released nodes are never accessed.
+    AKAOrderStatisticTreeNode* node = nil;
+    if (state->state == 0)
+    {
+        state->state = 1;
+        state->mutationsPtr = &_mutations;
+        node = akaFirstNode(_root);
+    }
+    else
+    {
+        node = (__bridge AKAOrderStatisticTreeNode*)(void*)state->extra[0];
+    }
+
+    NSUInteger result = 0;
+    for (; node && result < len; node = akaSuccessorOfNode(node))
+    {
+        // Deallocated items are skipped
+        __unsafe_unretained id item = akaItemOfNode(node);
+        if (item != nil)
+        {
+            buffer[result++] = item;
+        }
+    }
+    state->itemsPtr = buffer;
+    state->extra[0] = (unsigned long)(__bridge void*)node;
+
+    return result;
+}
+
+#pragma mark - Modification
+
+- (NSUInteger)insertItem:(id)item
+         usingComparator:(NSComparator)comparator
+{
+    NSUInteger result = NSNotFound;
+
+    if (comparator == nil)
+    {
+        result = [self insertItem:item atIndex:self.count];
+    }
+    else if ([self.nodesByItem objectForKey:item] == nil)
+    {
+        AKAOrderStatisticTreeNode* parent = nil;
+        BOOL isRightChild = NO;
+        result = 0;
+        for (AKAOrderStatisticTreeNode* current = _root; current != nil; )
+        {
+            id currentItem = akaItemOfNode(current);
+            if (currentItem == nil)
+            {
+                // Deallocated items cannot be compared, remove their nodes and start over
+                [self detachNode:current];
+                parent = nil;
+                isRightChild = NO;
+                result = 0;
+                current = _root;
+            }
+            else
+            {
+                parent = current;
+                isRightChild = comparator(currentItem, item) == NSOrderedAscending;
+                if (isRightChild)
+                {
+                    result += akaSizeOfNode(current->_left) + 1;
+                    current = current->_right;
+                }
+                else
+                {
+                    current = current->_left;
+                }
+            }
+        }
+
+        [self attachNode:[self createNodeWithItem:item]
+                toParent:parent
+            isRightChild:isRightChild];
+    }
+
+    return result;
+}
+
+- (NSUInteger)insertItem:(id)item
+                 atIndex:(NSUInteger)index
+{
+    if (index > self.count)
+    {
+        [NSException raise:NSRangeException
+                    format:@"Index %lu beyond bounds [0 .. %lu]",
+                           (unsigned long)index, (unsigned long)self.count];
+    }
+
+    NSUInteger result = NSNotFound;
+
+    if ([self.nodesByItem objectForKey:item] == nil)
+    {
+        AKAOrderStatisticTreeNode* parent = nil;
+        BOOL isRightChild = NO;
+
+        if (index == self.count)
+        {
+            parent = _last;
+            isRightChild = YES;
+        }
+        else
+        {
+            // Attach the node as right child of the node preceding the insert position or, if that
+            // node has a right subtree, as left child of the first node in that subtree.
+            AKAOrderStatisticTreeNode* current = _root;
+            NSUInteger remaining = index;
+            while (current != nil)
+            {
+                parent = current;
+                NSUInteger leftSize = akaSizeOfNode(current->_left);
+                isRightChild = remaining > leftSize;
+                if (isRightChild)
+                {
+                    remaining -= leftSize + 1;
+                    current = current->_right;
+                }
+                else
+                {
+                    current = current->_left;
+                }
+            }
+        }
+
+        [self attachNode:[self createNodeWithItem:item]
+                toParent:parent
+            isRightChild:isRightChild];
+        result = index;
+    }
+
+    return result;
+}
+
+- (NSUInteger)removeItem:(id)item
+{
+    AKAOrderStatisticTreeNode* node = [self.nodesByItem objectForKey:item];
+    NSUInteger result = [self indexOfNode:node];
+
+    if (node != nil)
+    {
+        [self.nodesByItem removeObjectForKey:item];
+        [self detachNode:node];
+    }
+
+    return result;
+}
+
+- (void)removeAllItems
+{
+    [self.nodesByItem removeAllObjects];
+    _root = nil;
+    _last = nil;
+    ++_mutations;
+}
+
+#pragma mark - Implementation
+
+/**
+ Attaches the specified leaf node to the specified parent (or as root if parent is nil) and restores the heap order of node priorities.
+ */
+- (void)attachNode:(AKAOrderStatisticTreeNode*)node
+          toParent:(AKAOrderStatisticTreeNode*)parent
+      isRightChild:(BOOL)isRightChild
+{
+    node->_parent = parent;
+    if (parent == nil)
+    {
+        _root = node;
+    }
+    else if (isRightChild)
+    {
+        parent->_right = node;
+    }
+    else
+    {
+        parent->_left = node;
+    }
+    if (isRightChild && parent == _last)
+    {
+        _last = node;
+    }
+    else if (_last == nil)
+    {
+        _last = node;
+    }
+
+    for (; parent != nil; parent = parent->_parent)
+    {
+        parent->_size += 1;
+    }
+
+    while (node->_parent != nil && node->_priority > node->_parent->_priority)
+    {
+        [self rotateUp:node];
+    }
+
+    ++_mutations;
+}
+
+/**
+ Removes the specified node from the tree, the caller is responsible for removing the map table entry of the node's item.
+ */
+- (void)detachNode:(AKAOrderStatisticTreeNode*)node
+{
+    if (node == _last)
+    {
+        _last = akaPredecessorOfNode(node);
+    }
+
+    // Rotate the node down until it is a leaf
+    while (node->_left != nil || node->_right != nil)
+    {
+        AKAOrderStatisticTreeNode* child = node->_left;
+        if (child == nil || (node->_right != nil && node->_right->_priority > child->_priority))
+        {
+            child = node->_right;
+        }
+        [self rotateUp:child];
+    }
+
+    AKAOrderStatisticTreeNode* parent = node->_parent;
+    if (parent == nil)
+    {
+        _root = nil;
+    }
+    else if (parent->_left == node)
+    {
+        parent->_left = nil;
+    }
+    else
+    {
+        parent->_right = nil;
+    }
+    for (; parent != nil; parent = parent->_parent)
+    {
+        parent->_size -= 1;
+    }
+    node->_parent = nil;
+
+    ++_mutations;
+}
+
+/**
+ Rotates the specified node up, replacing its parent which becomes a child of the node.
+ */
+- (void)rotateUp:(AKAOrderStatisticTreeNode*)node
+{
+    // Retained by the grand parent (or root) until the node replaces it
+    AKAOrderStatisticTreeNode* parent = node->_parent;
+    AKAOrderStatisticTreeNode* grandParent = parent->_parent;
+
+    if (parent->_left == node)
+    {
+        parent->_left = node->_right;
+        if (parent->_left)
+        {
+            parent->_left->_parent = parent;
+        }
+        node->_right = parent;
+    }
+    else
+    {
+        parent->_right = node->_left;
+        if (parent->_right)
+        {
+            parent->_right->_parent = parent;
+        }
+        node->_left = parent;
+    }
+    parent->_parent = node;
+
+    node->_parent = grandParent;
+    if (grandParent == nil)
+    {
+        _root = node;
+    }
+    else if (grandParent->_left == parent)
+    {
+        grandParent->_left = node;
+    }
+    else
+    {
+        grandParent->_right = node;
+    }
+
+    akaUpdateSizeOfNode(parent);
+    akaUpdateSizeOfNode(node);
+}
+
+@end
@@ -0,0 +1,58 @@
+//
+//  AKAStringPatternMatcher.h
+//  AKABeacon
+//
+//  Created by Michael Utech on 19.10.16.
+//  Copyright © 2016 Michael Utech & AKA Sarl. All rights reserved.
+//
+
+#import "AKANullability.h"
+
+/**
+ Finds all (non overlapping) occurrences of a fixed pattern in texts.
+
+ The matcher is designed to be created once for a pattern and then used to search many texts (for example to highlight search results in all visible table view cells). The pattern is folded (case, diacritics, width, depending on the specified options) and preprocessed for a Boyer-Moore-Horspool search at initialization time. Texts are folded in a single pass using a per code unit folding table that is shared by all matchers using the same options, and then searched in a second pass without any further string operations.
+
+ Options which are not supported by the fast path (NSRegularExpressionSearch, NSAnchoredSearch, NSBackwardsSearch) and texts or patterns containing characters which do not fold to exactly one UTF-16 code unit (or which could be canonically equivalent to a different sequence, such as combining marks in non-literal searches) are handled by falling back to -[NSString rangeOfString:options:range:]. Results are identical in both cases, the fallback is just slower.
+ */
+@interface AKAStringPatternMatcher: NSObject
+
+#pragma mark - Initialization
+
+- (req_instancetype)initWithPattern:(req_NSString)pattern
+                            options:(NSStringCompareOptions)options;
+
+#pragma mark - Configuration
+
+@property(nonatomic, readonly, nonnull) NSString* pattern;
+
+@property(nonatomic, readonly) NSStringCompareOptions options;
+
+/**
+ Determines whether the matcher is able to use the precomputed search for texts that consist of simple characters. If NO, all searches are performed using -[NSString rangeOfString:options:range:].
+ */
+@property(nonatomic, readonly) BOOL supportsFastSearch;
+
+#pragma mark - Searching
+
+/**
+ Calls the specified block for each occurrence of the pattern in the specified text in ascending order.
+
+ @param text  the text to search.
+ @param block a block called for each match. Setting *stop to YES terminates the enumeration.
+
+ @return the number of matches reported to the block.
+ */
+- (NSUInteger)enumerateRangesOfMatchesInString:(req_NSString)text
+                                    usingBlock:(void(^_Nonnull)(NSRange range, outreq_BOOL stop))block;
+
+/**
+ Determines the ranges of all occurrences of the pattern in the specified text.
+
+ @param text the text to search.
+
+ @return an array of NSValue instances wrapping NSRange values in ascending order.
+ */
+- (nonnull NSArray<NSValue*>*)rangesOfMatchesInString:(req_NSString)text;
+
+@end
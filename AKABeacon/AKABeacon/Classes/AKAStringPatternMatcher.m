@@ -0,0 +1,295 @@
+//
+//  AKAStringPatternMatcher.m
+//  AKABeacon
+//
+//  Created by Michael Utech on 19.10.16.
+//  Copyright © 2016 Michael Utech & AKA Sarl. All rights reserved.
+//
+
+#import "AKAStringPatternMatcher.h"
+
+
+#pragma mark - Folding Tables
+#pragma mark -
+
+// Folding table entries: 0 means "not yet computed", otherwise the entry has the known bit set
+// and either the complex bit (character does not fold to exactly one code unit or requires
+// normalization) or the folded code unit in the low 16 bits.
+static const uint32_t AKAFoldingTableEntryKnown = 0x80000000u;
+static const uint32_t AKAFoldingTableEntryComplex = 0x00010000u;
+
+// Folding tables are shared by all matchers using the same folding options and are never freed.
+// Entries are computed on demand. Concurrent writers will store the same value, which is why
+// the tables can be used without locking once they are allocated.
+static uint32_t* AKAFoldingTables[16];
+
+static NSStringCompareOptions const AKAFoldingOptionsMask =
+    NSCaseInsensitiveSearch | NSDiacriticInsensitiveSearch | NSWidthInsensitiveSearch;
+
+static NSStringCompareOptions const AKAUnsupportedOptionsMask =
+    NSRegularExpressionSearch | NSAnchoredSearch | NSBackwardsSearch;
+
+static NSUInteger const AKAStackBufferLength = 256;
+
+
+static uint32_t AKAFoldingTableComputeEntry(unichar c,
+                                            NSStringCompareOptions foldingOptions,
+                                            BOOL literal)
+{
+    if (CFStringIsSurrogateHighCharacter(c) || CFStringIsSurrogateLowCharacter(c))
+    {
+        // Surrogates are compared literally (folding is only applied to the BMP).
+        return AKAFoldingTableEntryKnown | c;
+    }
+
+    if (!literal && [[NSCharacterSet nonBaseCharacterSet] characterIsMember:c])
+    {
+        // Non literal searches have to consider canonical equivalence of (de)composed sequences
+        return AKAFoldingTableEntryKnown | AKAFoldingTableEntryComplex;
+    }
+
+    NSString* string = [NSString stringWithCharacters:&c length:1];
+    if (foldingOptions != 0)
+    {
+        string = [string stringByFoldingWithOptions:foldingOptions locale:nil];
+    }
+
+    if (string.length != 1)
+    {
+        return AKAFoldingTableEntryKnown | AKAFoldingTableEntryComplex;
+    }
+
+    return AKAFoldingTableEntryKnown | [string characterAtIndex:0];
+}
+
+static inline uint32_t AKAFoldingTableEntry(uint32_t* table,
+                                            unichar c,
+                                            NSStringCompareOptions foldingOptions,
+                                            BOOL literal)
+{
+    uint32_t result = table[c];
+    if (result == 0)
+    {
+        result = AKAFoldingTableComputeEntry(c, foldingOptions, literal);
+        table[c] = result;
+    }
+    return result;
+}
+
+
+#pragma mark - AKAStringPatternMatcher
+#pragma mark -
+
+@interface AKAStringPatternMatcher()
+{
+    // Folded pattern, NULL if the fast path is not supported
+    unichar*                _foldedPattern;
+    NSUInteger              _patternLength;
+    NSUInteger              _shift[256];
+
+    uint32_t*               _foldingTable;
+    NSStringCompareOptions  _foldingOptions;
+    BOOL                    _literal;
+}
+
+@end
+
+
+@implementation AKAStringPatternMatcher
+
+#pragma mark - Initialization
+
+- (instancetype)initWithPattern:(req_NSString)pattern
+                        options:(NSStringCompareOptions)options
+{
+    if (self = [super init])
+    {
+        _pattern = [pattern copy];
+        _options = options;
+        _foldingOptions = options & AKAFoldingOptionsMask;
+        _literal = (options & NSLiteralSearch) != 0;
+
+        if ((options & AKAUnsupportedOptionsMask) == 0 && pattern.length > 0)
+        {
+            [self compilePattern];
+        }
+    }
+    return self;
+}
+
+- (void)dealloc
+{
+    free(_foldedPattern);
+}
+
+- (void)compilePattern
+{
+    if (_foldingOptions != 0 || !_literal)
+    {
+        NSUInteger tableIndex = (_foldingOptions & NSCaseInsensitiveSearch ? 1 : 0)
+                                | (_foldingOptions & NSDiacriticInsensitiveSearch ? 2 : 0)
+                                | (_foldingOptions & NSWidthInsensitiveSearch ? 4 : 0)
+                                | (_literal ? 8 : 0);
+        @synchronized([AKAStringPatternMatcher class])
+        {
+            if (AKAFoldingTables[tableIndex] == NULL)
+            {
+                AKAFoldingTables[tableIndex] = calloc(0x10000, sizeof(uint32_t));
+            }
+        }
+        _foldingTable = AKAFoldingTables[tableIndex];
+    }
+
+    NSUInteger length = self.pattern.length;
+    unichar* folded = malloc(length * sizeof(unichar));
+    [self.pattern getCharacters:folded range:NSMakeRange(0, length)];
+
+    if (_foldingTable != NULL)
+    {
+        for (NSUInteger i = 0; i < length; ++i)
+        {
+            uint32_t entry = AKAFoldingTableEntry(_foldingTable, folded[i], _foldingOptions, _literal);
+            if (entry & AKAFoldingTableEntryComplex)
+            {
+                free(folded);
+                return;
+            }
+            folded[i] = (unichar)(entry & 0xffff);
+        }
+    }
+
+    // Horspool shift table, indexed by the low byte of code units. Code units sharing a low
+    // byte share the smallest shift, which keeps the table small and the search correct.
+    for (NSUInteger i = 0; i < 256; ++i)
+    {
+        _shift[i] = length;
+    }
+    for (NSUInteger i = 0; i + 1 < length; ++i)
+    {
+        _shift[folded[i] & 0xff] = length - 1 - i;
+    }
+
+    _foldedPattern = folded;
+    _patternLength = length;
+}
+
+#pragma mark - Configuration
+
+- (BOOL)supportsFastSearch
+{
+    return _foldedPattern != NULL;
+}
+
+#pragma mark - Searching
+
+- (NSArray<NSValue*>*)rangesOfMatchesInString:(req_NSString)text
+{
+    NSMutableArray<NSValue*>* result = [NSMutableArray new];
+    [self enumerateRangesOfMatchesInString:text
+                                usingBlock:
+     ^(NSRange range, outreq_BOOL stop)
+     {
+         (void)stop;
+         [result addObject:[NSValue valueWithRange:range]];
+     }];
+    return result;
+}
+
+- (NSUInteger)enumerateRangesOfMatchesInString:(req_NSString)text
+                                    usingBlock:(void(^)(NSRange range, outreq_BOOL stop))block
+{
+    NSUInteger result = 0;
+    NSUInteger length = text.length;
+
+    if (self.pattern.length == 0 || length < self.pattern.length)
+    {
+        return result;
+    }
+
+    if (_foldedPattern == NULL)
+    {
+        return [self enumerateRangesOfMatchesUsingStringSearchInString:text usingBlock:block];
+    }
+
+    unichar stackBuffer[AKAStackBufferLength];
+    unichar* buffer = length <= AKAStackBufferLength ? stackBuffer : malloc(length * sizeof(unichar));
+    [text getCharacters:buffer range:NSMakeRange(0, length)];
+
+    BOOL requiresFallback = NO;
+    if (_foldingTable != NULL)
+    {
+        for (NSUInteger i = 0; i < length && !requiresFallback; ++i)
+        {
+            uint32_t entry = AKAFoldingTableEntry(_foldingTable, buffer[i], _foldingOptions, _literal);
+            requiresFallback = (entry & AKAFoldingTableEntryComplex) != 0;
+            buffer[i] = (unichar)(entry & 0xffff);
+        }
+    }
+
+    if (!requiresFallback)
+    {
+        const unichar* pattern = _foldedPattern;
+        const NSUInteger last = _patternLength - 1;
+        BOOL stop = NO;
+
+        NSUInteger position = 0;
+        while (!stop && position + _patternLength <= length)
+        {
+            const unichar* window = buffer + position;
+            NSUInteger i = last;
+            while (window[i] == pattern[i] && i > 0)
+            {
+                --i;
+            }
+
+            if (i == 0 && window[0] == pattern[0])
+            {
+                ++result;
+                block(NSMakeRange(position, _patternLength), &stop);
+                position += _patternLength;
+            }
+            else
+            {
+                position += _shift[window[last] & 0xff];
+            }
+        }
+    }
+
+    if (buffer != stackBuffer)
+    {
+        free(buffer);
+    }
+
+    if (requiresFallback)
+    {
+        result = [self enumerateRangesOfMatchesUsingStringSearchInString:text usingBlock:block];
+    }
+
+    return result;
+}
+
+- (NSUInteger)enumerateRangesOfMatchesUsingStringSearchInString:(req_NSString)text
+                                                     usingBlock:(void(^)(NSRange range, outreq_BOOL stop))block
+{
+    NSUInteger result = 0;
+    NSRange scope = NSMakeRange(0, text.length);
+    BOOL stop = scope.length == 0;
+
+    while (!stop)
+    {
+        NSRange range = [text rangeOfString:self.pattern options:self.options range:scope];
+        stop = range.location == NSNotFound || range.length == 0;
+        if (!stop)
+        {
+            NSUInteger location = NSMaxRange(range);
+            scope = NSMakeRange(location, text.length - location);
+            ++result;
+            block(range, &stop);
+            stop = stop || scope.length == 0;
+        }
+    }
+
+    return result;
+}
+
+@end
@@ -16,6 +16,7 @@
 
 #import "AKAErrors.h"
 #import "AKALog.h"
+#import "AKAMainThreadWatchdog.h"
 
 #import <objc/runtime.h>
 
@@ -195,9 +196,11 @@ typedef enum
 
 - (void)endUpdates
 {
+    uint64_t watchdogStart = AKAMainThreadWatchdogBeginSpan();
     UITableView* tableView = self.tableView;
 
     [self.updateBatch endUpdatesForTableView:tableView];
+    AKAMainThreadWatchdogEndSpan(watchdogStart, __PRETTY_FUNCTION__, self);
 }
 
 #pragma mark - Adding and Removing Sections
@@ -941,6 +944,7 @@ typedef enum
 - (UITableViewCell*)            tableView:(UITableView*)tableView
                     cellForRowAtIndexPath:(NSIndexPath*)indexPath
 {
+    uint64_t watchdogStart = AKAMainThreadWatchdogBeginSpan();
     UITableViewCell* result = nil;
 
     id<UITableViewDataSource> dataSource = nil;
@@ -952,6 +956,8 @@ typedef enum
                   cellForRowAtIndexPath:resolvedIndexPath];
     }
 
+    AKAMainThreadWatchdogEndSpan(watchdogStart, __PRETTY_FUNCTION__, self);
+
     return result;
 }
 
@@ -1269,17 +1275,14 @@ typedef enum
             result = [delegate      tableView:[dataSource proxyForTableView:tableView]
                       heightForRowAtIndexPath:sourceIndexPath];
         }
-#if 0
-        AKALogDebug(@"row %ld-%ld height %lf from delegate %@ (%ld-%ld)",
-                    (long)indexPath.section, (long)indexPath.row, result,
-                    delegate, (long)sourceIndexPath.section, (long)sourceIndexPath.row);
+        AKALogVerboseC(TableView, @"row %ld-%ld height %lf from delegate %@ (%ld-%ld)",
+                       (long)indexPath.section, (long)indexPath.row, result,
+                       delegate, (long)sourceIndexPath.section, (long)sourceIndexPath.row);
     }
     else
     {
-        AKALogDebug(@"row %ld-%ld height %lf (default)",
-                    (long)indexPath.section, (long)indexPath.row, result);
-
-#endif
+        AKALogVerboseC(TableView, @"row %ld-%ld height %lf (default)",
+                       (long)indexPath.section, (long)indexPath.row, result);
     }
 
     return result;
@@ -1313,16 +1316,14 @@ typedef enum
             result = [delegate               tableView:[dataSource proxyForTableView:tableView]
                       estimatedHeightForRowAtIndexPath:sourceIndexPath];
         }
-#if 0
-        AKALogDebug(@"row %ld-%ld estimated height %lf from delegate %@ (%ld-%ld)",
-                    (long)indexPath.section, (long)indexPath.row, result,
-                    delegate, (long)sourceIndexPath.section, (long)sourceIndexPath.row);
+        AKALogVerboseC(TableView, @"row %ld-%ld estimated height %lf from delegate %@ (%ld-%ld)",
+                       (long)indexPath.section, (long)indexPath.row, result,
+                       delegate, (long)sourceIndexPath.section, (long)sourceIndexPath.row);
     }
     else
     {
-        AKALogDebug(@"row %ld-%ld estimated height %lf (default)",
-                    (long)indexPath.section, (long)indexPath.row, result);
-#endif
+        AKALogVerboseC(TableView, @"row %ld-%ld estimated height %lf (default)",
+                       (long)indexPath.section, (long)indexPath.row, result);
     }
 
     return result;
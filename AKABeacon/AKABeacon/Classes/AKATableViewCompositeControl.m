@@ -365,7 +365,7 @@
                      else
                      {
                          // TODO: We might want to delete rowInfos for cells which are no longer visible, even though that doesn't seem to be necessary, at least not in all cases -> investigate if and in which cases this happens.
-                         NSLog(@"Strange: rowInfo refers to a cell which is not visible: investigate this");
+                         AKALogDebugC(TableView, @"Strange: rowInfo refers to a cell which is not visible: investigate this");
                      }
                  }
              }];
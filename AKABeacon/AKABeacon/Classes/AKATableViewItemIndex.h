@@ -0,0 +1,70 @@
+//
+//  AKATableViewItemIndex.h
+//  AKABeacon
+//
+//  Created by Michael Utech on 19.10.16.
+//  Copyright © 2016 Michael Utech & AKA Sarl. All rights reserved.
+//
+
+@import UIKit;
+
+#import "AKANullability.h"
+
+
+/**
+ Identity based reverse index mapping the row items of table view section data source infos to their index paths and section data source infos to their section index.
+
+ Sections are indexed lazily when an item is looked up. Owners are expected to invalidate the rows of a section whenever its rows change and to invalidate the sections if the sections array has been changed or replaced. Invalidating the sections only rebuilds the section index, rows indexes of sections which are still present are preserved.
+
+ Items and section infos are compared by identity. If an item occurs in more than one row, the index path of one of its occurrences is returned.
+ */
+@interface AKATableViewItemIndex: NSObject
+
+/**
+ The section infos (instances of AKATableViewSectionDataSourceInfo or NSNull for empty sections) providing the indexed rows. Assigning a different array invalidates the sections.
+ */
+@property(nonatomic, nullable) NSArray*                     sections;
+
+#pragma mark - Lookup
+
+/**
+ Determines the index of the specified section info in sections.
+
+ @param sectionInfo the section info.
+
+ @return the section index or NSNotFound if sectionInfo is not an element of sections.
+ */
+- (NSUInteger)                                  indexOfSectionInfo:(opt_id)sectionInfo;
+
+/**
+ Determines the index path of the specified item, indexing sections which have not yet been indexed as needed.
+
+ @param item the row item.
+
+ @return the index path of the item or nil if the item is not an element of any section.
+ */
+- (opt_NSIndexPath)                               indexPathForItem:(opt_id)item;
+
+#pragma mark - Invalidation
+
+/**
+ Invalidates the index of section infos. Call this if sections have been inserted, removed or moved in the sections array.
+ */
+- (void)                                        invalidateSections;
+
+/**
+ Invalidates the rows index of the section at the specified index. Call this if rows have been inserted, removed, moved or replaced in the section.
+ */
+- (void)                                  invalidateRowsInSection:(NSUInteger)section;
+
+/**
+ Invalidates the rows index of the specified section info.
+ */
+- (void)                          invalidateRowsForSectionInfo:(opt_id)sectionInfo;
+
+/**
+ Discards all indexed information.
+ */
+- (void)                                        invalidateAll;
+
+@end
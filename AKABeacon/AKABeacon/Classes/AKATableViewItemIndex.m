@@ -0,0 +1,267 @@
+//
+//  AKATableViewItemIndex.m
+//  AKABeacon
+//
+//  Created by Michael Utech on 19.10.16.
+//  Copyright © 2016 Michael Utech & AKA Sarl. All rights reserved.
+//
+
+#import "AKATableViewItemIndex.h"
+#import "AKATableViewSectionDataSourceInfo.h"
+
+
+static NSMapTable* akaIdentityMapTable(void)
+{
+    return [NSMapTable mapTableWithKeyOptions:(NSPointerFunctionsStrongMemory |
+                                               NSPointerFunctionsObjectPointerPersonality)
+                                 valueOptions:NSPointerFunctionsStrongMemory];
+}
+
+
+#pragma mark - AKATableViewItemIndex - Private Interface
+#pragma mark -
+
+@interface AKATableViewItemIndex()
+
+/**
+ Maps section infos to their index in sections, nil if invalidated.
+ */
+@property(nonatomic) NSMapTable<id, NSNumber*>*             sectionIndexesBySectionInfo;
+
+/**
+ Maps section infos to a map of their row items to row indexes. Section infos without an entry have not yet been indexed.
+ */
+@property(nonatomic, readonly) NSMapTable<id, NSMapTable*>* rowIndexesBySectionInfo;
+
+/**
+ Maps row items to the section info containing them.
+ */
+@property(nonatomic, readonly) NSMapTable*                  sectionInfosByItem;
+
+@property(nonatomic) BOOL                                   hasPendingSections;
+
+@end
+
+
+#pragma mark - AKATableViewItemIndex - Implementation
+#pragma mark -
+
+@implementation AKATableViewItemIndex
+
+#pragma mark - Initialization
+
+- (instancetype)init
+{
+    if (self = [super init])
+    {
+        _rowIndexesBySectionInfo = akaIdentityMapTable();
+        _sectionInfosByItem = akaIdentityMapTable();
+    }
+    return self;
+}
+
+#pragma mark - Properties
+
+- (void)setSections:(NSArray *)sections
+{
+    if (_sections != sections)
+    {
+        _sections = sections;
+        [self invalidateSections];
+    }
+}
+
+#pragma mark - Lookup
+
+- (NSUInteger)indexOfSectionInfo:(opt_id)sectionInfo
+{
+    NSUInteger result = NSNotFound;
+
+    if (sectionInfo)
+    {
+        NSNumber* section = [self.sectionIndexesBySectionInfoBuildingIfNeeded objectForKey:sectionInfo];
+        if (section)
+        {
+            result = section.unsignedIntegerValue;
+        }
+    }
+
+    return result;
+}
+
+- (opt_NSIndexPath)indexPathForItem:(opt_id)item
+{
+    NSIndexPath* result = nil;
+
+    if (item)
+    {
+        [self indexPendingSections];
+
+        id sectionInfo = [self.sectionInfosByItem objectForKey:item];
+        NSUInteger section = [self indexOfSectionInfo:sectionInfo];
+        NSNumber* row = [[self.rowIndexesBySectionInfo objectForKey:sectionInfo] objectForKey:item];
+
+        if (section == NSNotFound || row == nil)
+        {
+            // The entry is missing or stale, which happens if the section containing the item
+            // has been invalidated while another section also contains it:
+            row = nil;
+            section = 0;
+            while (row == nil && section < self.sections.count)
+            {
+                sectionInfo = self.sections[section];
+                row = [[self.rowIndexesBySectionInfo objectForKey:sectionInfo] objectForKey:item];
+                if (row == nil)
+                {
+                    ++section;
+                }
+            }
+
+            if (row)
+            {
+                [self.sectionInfosByItem setObject:sectionInfo forKey:item];
+            }
+            else
+            {
+                [self.sectionInfosByItem removeObjectForKey:item];
+            }
+        }
+
+        if (row)
+        {
+            result = [NSIndexPath indexPathForRow:row.integerValue inSection:(NSInteger)section];
+        }
+    }
+
+    return result;
+}
+
+#pragma mark - Invalidation
+
+- (void)invalidateSections
+{
+    self.sectionIndexesBySectionInfo = nil;
+    self.hasPendingSections = YES;
+}
+
+- (void)invalidateRowsInSection:(NSUInteger)section
+{
+    if (section < self.sections.count)
+    {
+        [self invalidateRowsForSectionInfo:self.sections[section]];
+    }
+}
+
+- (void)invalidateRowsForSectionInfo:(opt_id)sectionInfo
+{
+    NSMapTable* rowIndexes = sectionInfo ? [self.rowIndexesBySectionInfo objectForKey:sectionInfo] : nil;
+
+    if (rowIndexes)
+    {
+        for (id item in rowIndexes)
+        {
+            if ([self.sectionInfosByItem objectForKey:item] == sectionInfo)
+            {
+                [self.sectionInfosByItem removeObjectForKey:item];
+            }
+        }
+        [self.rowIndexesBySectionInfo removeObjectForKey:sectionInfo];
+        self.hasPendingSections = YES;
+    }
+}
+
+- (void)invalidateAll
+{
+    self.sectionIndexesBySectionInfo = nil;
+    [self.rowIndexesBySectionInfo removeAllObjects];
+    [self.sectionInfosByItem removeAllObjects];
+    self.hasPendingSections = YES;
+}
+
+#pragma mark - Implementation
+
+- (NSMapTable<id, NSNumber*>*)sectionIndexesBySectionInfoBuildingIfNeeded
+{
+    NSMapTable* result = self.sectionIndexesBySectionInfo;
+
+    if (result == nil)
+    {
+        result = akaIdentityMapTable();
+        NSArray* sections = self.sections;
+        for (NSUInteger section = 0; section < sections.count; ++section)
+        {
+            if ([result objectForKey:sections[section]] == nil)
+            {
+                [result setObject:@(section) forKey:sections[section]];
+            }
+        }
+
+        // Discard rows indexes of section infos which have been removed:
+        NSMutableArray* removedSectionInfos = nil;
+        for (id sectionInfo in self.rowIndexesBySectionInfo)
+        {
+            if ([result objectForKey:sectionInfo] == nil)
+            {
+                if (removedSectionInfos == nil)
+                {
+                    removedSectionInfos = [NSMutableArray new];
+                }
+                [removedSectionInfos addObject:sectionInfo];
+            }
+        }
+        for (id sectionInfo in removedSectionInfos)
+        {
+            [self invalidateRowsForSectionInfo:sectionInfo];
+        }
+
+        self.sectionIndexesBySectionInfo = result;
+    }
+
+    return result;
+}
+
+- (void)indexPendingSections
+{
+    if (self.hasPendingSections)
+    {
+        [self sectionIndexesBySectionInfoBuildingIfNeeded];
+
+        for (id sectionInfo in self.sections)
+        {
+            if ([self.rowIndexesBySectionInfo objectForKey:sectionInfo] == nil)
+            {
+                [self indexRowsForSectionInfo:sectionInfo];
+            }
+        }
+        self.hasPendingSections = NO;
+    }
+}
+
+- (void)indexRowsForSectionInfo:(req_id)sectionInfo
+{
+    NSMapTable* rowIndexes = akaIdentityMapTable();
+
+    if ([sectionInfo isKindOfClass:[AKATableViewSectionDataSourceInfo class]])
+    {
+        NSArray* rows = ((AKATableViewSectionDataSourceInfo*)sectionInfo).rows;
+        for (NSUInteger row = 0; row < rows.count; ++row)
+        {
+            id item = rows[row];
+            if ([rowIndexes objectForKey:item] == nil)
+            {
+                [rowIndexes setObject:@(row) forKey:item];
+
+                id currentSectionInfo = [self.sectionInfosByItem objectForKey:item];
+                if (currentSectionInfo == nil ||
+                    [self.rowIndexesBySectionInfo objectForKey:currentSectionInfo] == nil)
+                {
+                    [self.sectionInfosByItem setObject:sectionInfo forKey:item];
+                }
+            }
+        }
+    }
+
+    [self.rowIndexesBySectionInfo setObject:rowIndexes forKey:sectionInfo];
+}
+
+@end
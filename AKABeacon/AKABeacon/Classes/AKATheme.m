@@ -10,6 +10,33 @@
 #import "AKATheme.h"
 #import "AKAViewCustomization.h"
 #import "AKAThemeLayout.h"
+#import "AKALayoutConstraintDiff.h"
+
+
+#pragma mark - AKAThemeApplicationPlan
+#pragma mark -
+
+/**
+ * The resolved application of a theme to views of a given set of types: the applicable view customizations of the theme and the layouts of the theme along with their applicability and applicable view customizations.
+ */
+@interface AKAThemeApplicationPlan: NSObject
+
+@property(nonatomic) NSArray<AKAViewCustomization*>* viewCustomizations;
+@property(nonatomic) NSArray<AKAThemeLayout*>* layouts;
+
+/**
+ * The applicable view customizations of the layout at the same index in layouts or NSNull if the layout is not applicable.
+ */
+@property(nonatomic) NSArray* layoutViewCustomizations;
+
+@end
+
+@implementation AKAThemeApplicationPlan
+@end
+
+
+#pragma mark - AKATheme
+#pragma mark -
 
 @interface AKATheme()<
         AKAViewCustomizationDelegate,
@@ -18,6 +45,17 @@
     NSMutableArray* _viewCustomizations;
     NSMutableArray* _layouts;
 }
+
+/**
+ * Application plans by target class and names and classes of participating views (see applicationPlanForTarget:withViews:).
+ */
+@property(nonatomic, readonly) NSMutableDictionary<NSString*, AKAThemeApplicationPlan*>* applicationPlans;
+
+/**
+ * The configuration generation (see configurationGeneration) for which applicationPlans have been created.
+ */
+@property(nonatomic) NSUInteger applicationPlansGeneration;
+
 @end
 
 @implementation AKATheme
@@ -35,6 +73,7 @@
     if (self)
     {
         _layouts = NSMutableArray.new;
+        _applicationPlans = NSMutableDictionary.new;
     }
     return self;
 }
@@ -141,6 +180,70 @@
     }
     [_layouts addObject:layout];
     layout.delegate = self;
+    [self configurationDidChange];
+}
+
+#pragma mark - Application Plans
+
+/**
+ * Returns the application plan for the specified target and views. Themes are typically applied to many containers of the same type (for example table view cells) whose participating views have the same types. Since the applicability of layouts and view customizations only depends on the presence and types of views, the result is cached by the class of the target and the names and classes of the participating views and applying the theme to another container of the same structure replays the plan.
+ *
+ * @note Plans are discarded when the configuration of the theme or one of its layouts changes (see configurationGeneration).
+ */
+- (AKAThemeApplicationPlan*)applicationPlanForTarget:(UIView*)target
+                                           withViews:(NSDictionary*)views
+{
+    NSUInteger generation = [self configurationGeneration];
+    if (generation != self.applicationPlansGeneration)
+    {
+        [self.applicationPlans removeAllObjects];
+        self.applicationPlansGeneration = generation;
+    }
+
+    NSMutableString* key = [NSMutableString stringWithString:NSStringFromClass(target.class)];
+    for (NSString* name in [views.allKeys sortedArrayUsingSelector:@selector(compare:)])
+    {
+        [key appendFormat:@"|%@:%@", name, NSStringFromClass([views[name] class])];
+    }
+
+    AKAThemeApplicationPlan* result = self.applicationPlans[key];
+    if (result == nil)
+    {
+        result = [AKAThemeApplicationPlan new];
+        result.viewCustomizations = [self viewCustomizationsApplicableToViews:views];
+        result.layouts = self.layouts;
+
+        NSMutableArray* layoutViewCustomizations = [NSMutableArray arrayWithCapacity:result.layouts.count];
+        for (AKAThemeLayout* layout in result.layouts)
+        {
+            if ([layout isApplicableToViews:views])
+            {
+                [layoutViewCustomizations addObject:[layout viewCustomizationsApplicableToViews:views]];
+            }
+            else
+            {
+                [layoutViewCustomizations addObject:[NSNull null]];
+            }
+        }
+        result.layoutViewCustomizations = layoutViewCustomizations;
+
+        self.applicationPlans[key] = result;
+    }
+
+    return result;
+}
+
+/**
+ * The sum of the generations of the theme and its layouts. Since generations only increase, the sum changes whenever the theme or one of its layouts is modified.
+ */
+- (NSUInteger)configurationGeneration
+{
+    NSUInteger result = self.generation;
+    for (AKAThemeLayout* layout in _layouts)
+    {
+        result += layout.generation;
+    }
+    return result;
 }
 
 #pragma mark - Application
@@ -149,16 +252,24 @@
             withViews:(NSDictionary*)views
              delegate:(NSObject<AKAThemeDelegate>*)delegate
 {
+    AKAThemeApplicationPlan* plan = [self applicationPlanForTarget:target
+                                                         withViews:views];
+
     if ([self shouldApplyViewCustomizations:self.viewCustomizations
                                     toViews:views
                                    delegate:delegate])
     {
-        [self applyViewCustomizationsToTarget:target
-                                    withViews:views
-                                     delegate:self.viewCustomizationDelegate];
+        [self applyViewCustomizations:plan.viewCustomizations
+                             toTarget:target
+                            withViews:views
+                             delegate:self.viewCustomizationDelegate];
     }
 
 
+    // Constraints installed by themes are not removed immediately, they are collected in the
+    // constraint diff and reused by layouts (if they match) or removed when the diff is committed.
+    AKALayoutConstraintDiff* constraintDiff = [AKALayoutConstraintDiff new];
+
     [self willRemoveConstraintsDelegate:delegate];
     for (NSString* viewName in views.keyEnumerator)
     {
@@ -172,6 +283,8 @@
                                fromTarget:target
                                  delegate:delegate])
         {
+            fromTarget = [constraintDiff deferRemovalOfConstraints:fromTarget
+                                                   installedInView:target];
             [target removeConstraints:fromTarget];
             [self didRemoveConstraints:fromTarget
                               fromView:target
@@ -186,6 +299,8 @@
                                   inViews:views
                                  delegate:delegate])
         {
+            fromView1 = [constraintDiff deferRemovalOfConstraints:fromView1
+                                                  installedInView:view];
             [view removeConstraints:fromView1];
             [self didRemoveConstraints:fromView1
                               fromView:view
@@ -199,6 +314,8 @@
                                                    inViews:views
                                                   delegate:delegate])
         {
+            fromView2 = [constraintDiff deferRemovalOfConstraints:fromView2
+                                                  installedInView:view];
             [view removeConstraints:fromView2];
             [self didRemoveConstraints:fromView2
                               fromView:view
@@ -207,13 +324,37 @@
     }
     [self didRemoveConstraintsDelegate:delegate];
 
-    for (AKAThemeLayout* layout in self.layouts)
-    {
+    [plan.layouts enumerateObjectsUsingBlock:^(AKAThemeLayout* layout, NSUInteger idx, BOOL *stop) {
+        (void)stop; // not needed
+        id viewCustomizations = plan.layoutViewCustomizations[idx];
+        BOOL applicable = viewCustomizations != [NSNull null];
         [layout applyToViews:views
           withDefaultMetrics:self.defaultMetrics
                defaultTarget:target
-                withDelegate:delegate];
+                withDelegate:delegate
+              constraintDiff:constraintDiff
+                  applicable:applicable
+          viewCustomizations:applicable ? viewCustomizations : nil];
+    }];
+
+    // Theme constraints which have not been reused by layouts are removed now and reported to
+    // delegates just like other removed constraints (f.e. to let change recorders restore them).
+    __block BOOL reportedRemovals = NO;
+    [constraintDiff commitRemovalsWithHandler:^(NSArray<NSLayoutConstraint*>* constraints, UIView* view) {
+        if (!reportedRemovals)
+        {
+            [self willRemoveConstraintsDelegate:delegate];
+            reportedRemovals = YES;
+        }
+        [self didRemoveConstraints:constraints
+                          fromView:view
+                          delegate:delegate];
+    }];
+    if (reportedRemovals)
+    {
+        [self didRemoveConstraintsDelegate:delegate];
     }
+    [constraintDiff commitAdditions];
 }
 
 - (BOOL)shouldApplyViewCustomizations:(NSArray*)customizations
@@ -337,6 +478,12 @@
                     fromView:(UIView*)view
                     delegate:(NSObject<AKAThemeDelegate>*)delegate
 {
+    if (constraints.count == 0)
+    {
+        // All constraints have been deferred for reuse by the constraint diff
+        return;
+    }
+
     if ([delegate respondsToSelector:@selector(theme:didRemoveConstraints:fromView:)])
     {
         [delegate theme:self
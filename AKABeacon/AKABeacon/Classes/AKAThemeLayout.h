@@ -79,6 +79,44 @@
        defaultTarget:(UIView*)target
         withDelegate:(NSObject<AKAThemeLayoutDelegate>*)delegate;
 
+/**
+ * Applies this layout to the specified default target using the specified constraint diff to reuse constraints installed by a previous theme application. Constraints which cannot be reused are installed when the diff is committed.
+ *
+ * @param views a dictionary mapping view names to views.
+ * @param defaultMetrics the default metrics, if the layout defines its own metrics, both will be merged with layout metrics overwriting default metrics.
+ * @param defaultTarget the default target used to install constraints, used if the layout does not specify its own target.
+ * @param delegate additional delegate monitoring and customizing the application process.
+ * @param constraintDiff the diff collecting reusable constraints or nil to install constraints immediately.
+ *
+ * @return if the layout was successfully applied.
+ */
+- (BOOL)applyToViews:(NSDictionary*)views
+  withDefaultMetrics:(NSDictionary*)defaultMetrics
+       defaultTarget:(UIView*)target
+        withDelegate:(NSObject<AKAThemeLayoutDelegate>*)delegate
+      constraintDiff:(AKALayoutConstraintDiff*)constraintDiff;
+
+/**
+ * Applies this layout using a previously determined applicability and the view customizations which have been found to be applicable to views of the same types (see AKAViewCustomizationContainer::viewCustomizationsApplicableToViews:). This is used by themes to replay cached application plans.
+ *
+ * @param views a dictionary mapping view names to views.
+ * @param defaultMetrics the default metrics.
+ * @param defaultTarget the default target used to install constraints, used if the layout does not specify its own target.
+ * @param delegate additional delegate monitoring and customizing the application process.
+ * @param constraintDiff the diff collecting reusable constraints or nil to install constraints immediately.
+ * @param applicable the result of isApplicableToViews: for views of the same types.
+ * @param viewCustomizations the applicable view customizations of this layout.
+ *
+ * @return applicable
+ */
+- (BOOL)applyToViews:(NSDictionary*)views
+  withDefaultMetrics:(NSDictionary*)defaultMetrics
+       defaultTarget:(UIView*)target
+        withDelegate:(NSObject<AKAThemeLayoutDelegate>*)delegate
+      constraintDiff:(AKALayoutConstraintDiff*)constraintDiff
+          applicable:(BOOL)applicable
+  viewCustomizations:(NSArray*)viewCustomizations;
+
 #pragma mark - Configuration
 
 @property(nonatomic, weak) NSObject<AKAThemeLayoutDelegate>* delegate;
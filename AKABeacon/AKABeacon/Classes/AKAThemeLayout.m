@@ -111,7 +111,39 @@
        defaultTarget:(UIView*)target
         withDelegate:(NSObject<AKAThemeLayoutDelegate>*)delegate
 {
-    BOOL result = [self isApplicableToViews:views];
+    return [self applyToViews:views
+           withDefaultMetrics:defaultMetrics
+                defaultTarget:target
+                 withDelegate:delegate
+               constraintDiff:nil];
+}
+
+- (BOOL)applyToViews:(NSDictionary*)views
+  withDefaultMetrics:(NSDictionary*)defaultMetrics
+       defaultTarget:(UIView*)target
+        withDelegate:(NSObject<AKAThemeLayoutDelegate>*)delegate
+      constraintDiff:(AKALayoutConstraintDiff*)constraintDiff
+{
+    BOOL applicable = [self isApplicableToViews:views];
+
+    return [self applyToViews:views
+           withDefaultMetrics:defaultMetrics
+                defaultTarget:target
+                 withDelegate:delegate
+               constraintDiff:constraintDiff
+                   applicable:applicable
+           viewCustomizations:applicable ? [self viewCustomizationsApplicableToViews:views] : nil];
+}
+
+- (BOOL)applyToViews:(NSDictionary*)views
+  withDefaultMetrics:(NSDictionary*)defaultMetrics
+       defaultTarget:(UIView*)target
+        withDelegate:(NSObject<AKAThemeLayoutDelegate>*)delegate
+      constraintDiff:(AKALayoutConstraintDiff*)constraintDiff
+          applicable:(BOOL)applicable
+  viewCustomizations:(NSArray*)viewCustomizations
+{
+    BOOL result = applicable;
 
     [self didCheckApplicabilityToViews:views
                             withResult:result
@@ -120,9 +152,10 @@
     if (result)
     {
         // View customizations first (no particular reason):
-        [self applyViewCustomizationsToTarget:target
-                                    withViews:views
-                                     delegate:self.viewCustomizationDelegate];
+        [self applyViewCustomizations:viewCustomizations
+                             toTarget:target
+                            withViews:views
+                             delegate:self.viewCustomizationDelegate];
 
         NSDictionary* metrics = nil; //self.metrics;
         if (metrics == nil)
@@ -148,7 +181,8 @@
             [constraintSpecification installConstraintsForViews:views
                                                         metrics:metrics
                                                   defaultTarget:target
-                                                       delegate:delegate];
+                                                       delegate:delegate
+                                                 constraintDiff:constraintDiff];
         }
         [self didApplyToViews:views
                       metrics:metrics
@@ -165,6 +199,7 @@
   withApplicability:(AKAThemeViewApplicability *)applicability
 {
     self.applicabilitiesByView[key] = applicability;
+    [self configurationDidChange];
 }
 
 - (void)requireView:(NSString *)key
@@ -190,6 +225,7 @@
     }
     [self.constraintSpecifications addObject:constraintSpecification];
     constraintSpecification.delegate = self;
+    [self configurationDidChange];
 }
 
 - (void)addConstraintSpecificationWithDictionary:(NSDictionary *)dictionary
@@ -15,6 +15,7 @@
 #import "AKANSEnumerations.h"
 #import "AKABindingErrors.h"
 #import "AKABindingExpressionParser.h"
+#import "AKAFontCache.h"
 
 
 #pragma mark - AKAUIFontConstantBindingExpression
@@ -25,6 +26,17 @@
 #pragma mark - Initialization
 
 + (UIFont*)fontForDescriptor:(UIFontDescriptor*)descriptor
+{
+    return [[AKAFontCache sharedCache] fontForBase:descriptor
+                                     customization:@""
+                                          resolver:
+            ^UIFont*
+            {
+                return [self resolveFontForDescriptor:descriptor];
+            }];
+}
+
++ (UIFont*)resolveFontForDescriptor:(UIFontDescriptor*)descriptor
 {
     UIFont* result = nil;
     NSString* fontName = nil;
@@ -96,6 +96,13 @@
                                                    withContext:(id)context
                                                       delegate:(id<AKAViewCustomizationDelegate>)delegate;
 
+/**
+ * Applies the customization to the specified view without testing whether the customization is applicable to the view. This is used to replay theme application plans, for which applicability has been determined before.
+ */
+- (void)                                 applyToApplicableView:(id)view
+                                                   withContext:(id)context
+                                                      delegate:(id<AKAViewCustomizationDelegate>)delegate;
+
 @end
 
 
@@ -105,6 +112,16 @@
 
 @property(nonatomic, readonly) NSArray*                        viewCustomizations;
 
+/**
+ * Incremented whenever the configuration of the container changes in a way that may affect the applicability of the container or its view customizations. Clients caching such results (f.e. theme application plans) compare generations to detect stale results.
+ */
+@property(nonatomic, readonly) NSUInteger                       generation;
+
+/**
+ * Increments the generation. Subclasses call this whenever they change their configuration.
+ */
+- (void)                                 configurationDidChange;
+
 #pragma mark - Adding View Customizations
 
 - (NSUInteger)    addViewCustomizationsWithArrayOfDictionaries:(NSArray*)specifications;
@@ -120,4 +137,17 @@
                                                      withViews:(NSDictionary*)views
                                                       delegate:(NSObject<AKAViewCustomizationDelegate>*)delegate;
 
+/**
+ * Determines the view customizations which are applicable to the views they refer to in the specified views dictionary. Since applicability only depends on the presence and types of views, the result can be reused for other view dictionaries containing views of the same types under the same names.
+ */
+- (NSArray*)               viewCustomizationsApplicableToViews:(NSDictionary*)views;
+
+/**
+ * Applies the specified view customizations, which have to be applicable to the specified views (see viewCustomizationsApplicableToViews:).
+ */
+- (void)                               applyViewCustomizations:(NSArray*)customizations
+                                                      toTarget:(UIView*)target
+                                                     withViews:(NSDictionary*)views
+                                                      delegate:(NSObject<AKAViewCustomizationDelegate>*)delegate;
+
 @end
@@ -107,35 +107,42 @@ static NSString* const kSpecificationTagProperties = @"properties";
 
     if (result)
     {
-        [self willApplyToView:view delegate:delegate];
-        [self.propertyValuesByName enumerateKeysAndObjectsUsingBlock:
-         ^(id key, id obj, BOOL* stop)
-         {
-             (void)stop;
-
-             id oldValue = [view valueForKey:key];
-             id newValue = [self resolvePropertyValue:obj
-                                          withContext:context];
-
-             if ([self shouldSetProperty:key
-                                   value:oldValue
-                                      to:newValue
-                                delegate:delegate])
-             {
-                 [view setValue:newValue
-                         forKey:key];
-                 [self didSetProperty:key
-                                value:oldValue
-                                   to:obj
-                             delegate:delegate];
-             }
-         }];
-        [self didApplyToView:view delegate:delegate];
+        [self applyToApplicableView:view withContext:context delegate:delegate];
     }
 
     return result;
 }
 
+- (void)                                 applyToApplicableView:(id)view
+                                                   withContext:(id)context
+                                                      delegate:(id<AKAViewCustomizationDelegate>)delegate
+{
+    [self willApplyToView:view delegate:delegate];
+    [self.propertyValuesByName enumerateKeysAndObjectsUsingBlock:
+     ^(id key, id obj, BOOL* stop)
+     {
+         (void)stop;
+
+         id oldValue = [view valueForKey:key];
+         id newValue = [self resolvePropertyValue:obj
+                                      withContext:context];
+
+         if ([self shouldSetProperty:key
+                               value:oldValue
+                                  to:newValue
+                            delegate:delegate])
+         {
+             [view setValue:newValue
+                     forKey:key];
+             [self didSetProperty:key
+                            value:oldValue
+                               to:obj
+                         delegate:delegate];
+         }
+     }];
+    [self didApplyToView:view delegate:delegate];
+}
+
 - (id)                                    resolvePropertyValue:(id)obj
                                                    withContext:(id)context
 {
@@ -302,6 +309,34 @@ static NSString* const kSpecificationTagProperties = @"properties";
     }
 }
 
+- (NSArray*)               viewCustomizationsApplicableToViews:(NSDictionary*)views
+{
+    NSMutableArray* result = [NSMutableArray arrayWithCapacity:_viewCustomizations.count];
+
+    for (AKAViewCustomization* customization in _viewCustomizations)
+    {
+        if ([customization isApplicableToView:views[customization.viewKey]])
+        {
+            [result addObject:customization];
+        }
+    }
+
+    return result;
+}
+
+- (void)                               applyViewCustomizations:(NSArray*)customizations
+                                                      toTarget:(UIView*)target
+                                                     withViews:(NSDictionary*)views
+                                                      delegate:(NSObject<AKAViewCustomizationDelegate>*)delegate
+{
+    for (AKAViewCustomization* customization in customizations)
+    {
+        [customization applyToApplicableView:views[customization.viewKey]
+                                 withContext:target
+                                    delegate:delegate];
+    }
+}
+
 #pragma mark - Adding View Customizations
 
 - (NSArray*)                               viewCustomizations
@@ -353,6 +388,12 @@ static NSString* const kSpecificationTagProperties = @"properties";
 {
     [_viewCustomizations addObject:viewCustomization];
     viewCustomization.delegate = self;
+    [self configurationDidChange];
+}
+
+- (void)                                 configurationDidChange
+{
+    ++_generation;
 }
 
 #pragma mark - AKAViewCustomizationDelegate methods
@@ -7,10 +7,30 @@
 
 #import <Foundation/Foundation.h>
 
+/**
+ Associates values with arbitrary objects. Values are kept in an AKAAssociatedStorage attached to the object. Prefer the static key variants, string keys are interned and require a lookup in a global (locked) table.
+
+ Reading values from objects which have no associated values does not allocate storage.
+
+ @note Associated values are not thread safe, access them from the main thread.
+ */
 @interface NSObject (AKAAssociatedStorage)
 
 @property (nonatomic, readonly) BOOL aka_hasAssociatesValues;
 
+#pragma mark - Static Keys
+
+/**
+ Returns the value associated with the specified key, which is either a selector or the address of a static variable.
+ */
+- (id)aka_associatedValueForStaticKey:(const void*)key;
+
+- (void)aka_setAssociatedValue:(id)value forStaticKey:(const void*)key;
+
+- (void)aka_removeValueAssociatedWithStaticKey:(const void*)key;
+
+#pragma mark - String Keys
+
 - (void)aka_setAssociatedValues:(NSDictionary*)values;
 
 - (id)aka_associatedValueForKey:(id)key;
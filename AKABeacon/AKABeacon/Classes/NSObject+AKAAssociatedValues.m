@@ -6,56 +6,100 @@
 //
 
 #import "NSObject+AKAAssociatedValues.h"
-#import <objc/runtime.h>
+#import "AKAAssociatedStorage.h"
 
-@interface NSObject()
+@implementation NSObject (AKAAssociatedValues)
 
-@property (atomic, readonly) NSMutableDictionary* aka_associatedValues;
+static char associationKey;
 
-@end
+#pragma mark - Storage
 
-@implementation NSObject (AKAAssociatedValues)
+- (AKAAssociatedStorage*)aka_associatedStorageCreateIfMissing:(BOOL)createIfMissing
+{
+    return [AKAAssociatedStorage storageForObject:self
+                                   associationKey:&associationKey
+                                  createIfMissing:createIfMissing];
+}
 
-static char associationKey;
+/**
+ Returns the unique instance of an equal string used as storage key for string keys. Returns NULL if the string has not been interned and createIfMissing is NO (in which case no value can be associated with the key).
+ */
++ (const void*)aka_internedStorageKeyForKey:(NSString*)key
+                            createIfMissing:(BOOL)createIfMissing
+{
+    static NSMutableDictionary<NSString*, NSString*>* internedKeys;
+    static NSLock* lock;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        internedKeys = [NSMutableDictionary new];
+        lock = [NSLock new];
+    });
+
+    [lock lock];
+    NSString* result = internedKeys[key];
+    if (result == nil && createIfMissing)
+    {
+        result = [key copy];
+        internedKeys[result] = result;
+    }
+    [lock unlock];
+
+    return (__bridge const void*)result;
+}
 
 - (BOOL)aka_hasAssociatesValues
 {
-    return [self aka_associatedValues] != nil;
+    return [self aka_associatedStorageCreateIfMissing:NO].count > 0;
 }
 
-- (NSMutableDictionary*)aka_associatedValues
+#pragma mark - Static Keys
+
+- (id)aka_associatedValueForStaticKey:(const void*)key
 {
-    return [self aka_associatedValuesCreateIfMissing:NO];
+    return [[self aka_associatedStorageCreateIfMissing:NO] valueForStorageKey:key];
 }
 
-- (NSMutableDictionary*)aka_associatedValuesCreateIfMissing:(BOOL)createIfMissing
+- (void)aka_setAssociatedValue:(id)value forStaticKey:(const void*)key
 {
-    id result = objc_getAssociatedObject(self, &associationKey);
-    if (result == nil)
+    if (value == nil)
     {
-        if (createIfMissing)
-        {
-            result = [[NSMutableDictionary alloc] init];
-            objc_setAssociatedObject(self, &associationKey, result, OBJC_ASSOCIATION_RETAIN);
-        }
+        [self aka_removeValueAssociatedWithStaticKey:key];
+    }
+    else
+    {
+        [[self aka_associatedStorageCreateIfMissing:YES] setValue:value forStorageKey:key];
     }
-    return result;
 }
 
+- (void)aka_removeValueAssociatedWithStaticKey:(const void*)key
+{
+    [[self aka_associatedStorageCreateIfMissing:NO] removeValueForStorageKey:key];
+}
+
+#pragma mark - String Keys
+
 - (void)aka_setAssociatedValues:(NSDictionary*)values
 {
-    NSMutableDictionary* storage = [NSMutableDictionary dictionaryWithDictionary:values];
-    objc_setAssociatedObject(self, &associationKey, storage, OBJC_ASSOCIATION_RETAIN);
+    [self aka_removeAllAssociatedValues];
+    [values enumerateKeysAndObjectsUsingBlock:^(NSString* key, id value, BOOL * _Nonnull stop __unused) {
+        [self aka_setAssociatedValue:value forKey:key];
+    }];
 }
 
 - (id)aka_associatedValueForKey:(id)key
 {
     id result = nil;
-    id associatedValues = [self aka_associatedValues];
-    if ([associatedValues isKindOfClass:[NSDictionary class]])
+
+    AKAAssociatedStorage* storage = [self aka_associatedStorageCreateIfMissing:NO];
+    if (storage.count > 0)
     {
-        result = ((NSDictionary *) associatedValues)[key];
+        const void* storageKey = [NSObject aka_internedStorageKeyForKey:key createIfMissing:NO];
+        if (storageKey)
+        {
+            result = [storage valueForStorageKey:storageKey];
+        }
     }
+
     return result;
 }
 
@@ -67,29 +111,30 @@ static char associationKey;
     }
     else
     {
-        id associatedValues = [self aka_associatedValuesCreateIfMissing:YES];
-        if ([associatedValues isKindOfClass:[NSMutableDictionary class]])
-        {
-            ((NSMutableDictionary *) associatedValues)[key] = value;
-        }
+        [self aka_setAssociatedValue:value
+                        forStaticKey:[NSObject aka_internedStorageKeyForKey:key createIfMissing:YES]];
     }
 }
 
 - (void)aka_removeValueAssociatedWithKey:(NSString*)key
 {
-    id associatedValues = [self aka_associatedValuesCreateIfMissing:YES];
-    if ([associatedValues isKindOfClass:[NSMutableDictionary class]])
+    AKAAssociatedStorage* storage = [self aka_associatedStorageCreateIfMissing:NO];
+    if (storage.count > 0)
     {
-        [((NSMutableDictionary*)associatedValues) removeObjectForKey:key];
+        const void* storageKey = [NSObject aka_internedStorageKeyForKey:key createIfMissing:NO];
+        if (storageKey)
+        {
+            [storage removeValueForStorageKey:storageKey];
+        }
     }
-    return;
 }
 
 - (void)aka_removeAllAssociatedValues
 {
-    [self aka_setAssociatedValues:nil];
+    [AKAAssociatedStorage removeStorageForObject:self associationKey:&associationKey];
 }
 
+#pragma mark - Saving Property Values
 
 - (void)aka_savePropertyValues:(NSArray*)propertyNames
 {
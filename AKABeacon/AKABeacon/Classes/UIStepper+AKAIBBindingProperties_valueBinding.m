@@ -44,15 +44,14 @@
  */
 - (AKAMutableControlConfiguration*)aka_controlConfiguration
 {
-    NSString* key = NSStringFromSelector(@selector(aka_controlConfiguration));
-    AKAMutableControlConfiguration* result = [self aka_associatedValueForKey:key];
+    AKAMutableControlConfiguration* result = [self aka_associatedValueForStaticKey:@selector(aka_controlConfiguration)];
 
     if (result == nil)
     {
         result = [AKAMutableControlConfiguration new];
         result[kAKAControlTypeKey] = [AKAScalarControl class];
         result[kAKAControlViewBinding] = NSStringFromSelector(@selector(valueBinding_aka));
-        [self aka_setAssociatedValue:result forKey:key];
+        [self aka_setAssociatedValue:result forStaticKey:@selector(aka_controlConfiguration)];
     }
 
     return result;
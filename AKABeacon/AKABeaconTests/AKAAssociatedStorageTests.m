@@ -0,0 +1,90 @@
+//
+//  AKAAssociatedStorageTests.m
+//  AKABeacon
+//
+//  Created by Michael Utech on 19.10.16.
+//  Copyright © 2016 Michael Utech & AKA Sarl. All rights reserved.
+//
+
+@import Foundation;
+
+#import <XCTest/XCTest.h>
+
+#import "AKAAssociatedStorage.h"
+#import "NSObject+AKAAssociatedValues.h"
+
+static char kTestAssociationKey;
+static char kTestKeys[20];
+
+@interface AKAAssociatedStorageTests : XCTestCase
+
+@end
+
+@implementation AKAAssociatedStorageTests
+
+- (void)testReadOnlyAccessDoesNotCreateStorage
+{
+    NSObject* object = [NSObject new];
+
+    XCTAssertNil([object aka_associatedValueForStaticKey:&kTestKeys[0]]);
+    XCTAssertNil([object aka_associatedValueForKey:@"test"]);
+    [object aka_removeValueAssociatedWithKey:@"test"];
+
+    XCTAssertNil([AKAAssociatedStorage storageForObject:object
+                                         associationKey:&kTestAssociationKey
+                                        createIfMissing:NO]);
+    XCTAssertFalse(object.aka_hasAssociatesValues);
+}
+
+- (void)testInlineAndPromotedStorage
+{
+    NSObject* object = [NSObject new];
+    AKAAssociatedStorage* storage = [AKAAssociatedStorage storageForObject:object
+                                                            associationKey:&kTestAssociationKey
+                                                           createIfMissing:YES];
+
+    for (NSUInteger i = 0; i < 20; ++i)
+    {
+        [storage setValue:@(i) forStorageKey:&kTestKeys[i]];
+
+        if (i == 5)
+        {
+            // Inline storage preserves insertion order, also after removals
+            [storage removeValueForStorageKey:&kTestKeys[2]];
+            NSMutableArray* values = [NSMutableArray new];
+            [storage enumerateValuesUsingBlock:^(const void * _Nonnull key __unused, id value, BOOL * stop __unused) {
+                [values addObject:value];
+            }];
+            XCTAssertEqualObjects((@[ @0, @1, @3, @4, @5 ]), values);
+            [storage setValue:@(2) forStorageKey:&kTestKeys[2]];
+        }
+    }
+
+    XCTAssertEqual((NSUInteger)20, storage.count);
+    for (NSUInteger i = 0; i < 20; ++i)
+    {
+        XCTAssertEqualObjects(@(i), [storage valueForStorageKey:&kTestKeys[i]]);
+    }
+
+    [storage setValue:nil forStorageKey:&kTestKeys[7]];
+    XCTAssertNil([storage valueForStorageKey:&kTestKeys[7]]);
+    XCTAssertEqual((NSUInteger)19, storage.count);
+
+    XCTAssertEqual(storage, [AKAAssociatedStorage storageForObject:object
+                                                    associationKey:&kTestAssociationKey
+                                                   createIfMissing:NO]);
+}
+
+- (void)testStringKeys
+{
+    NSObject* object = [NSObject new];
+    NSString* key = [NSMutableString stringWithString:@"key"];
+
+    [object aka_setAssociatedValue:@(1) forKey:key];
+    XCTAssertEqualObjects(@(1), [object aka_associatedValueForKey:@"key"]);
+
+    [object aka_removeValueAssociatedWithKey:@"key"];
+    XCTAssertNil([object aka_associatedValueForKey:key]);
+}
+
+@end
@@ -0,0 +1,533 @@
+//
+//  AKABenchmarkTests.m
+//  AKABeacon
+//
+//  Created by Michael Utech on 19.10.16.
+//  Copyright © 2016 Michael Utech & AKA Sarl. All rights reserved.
+//
+
+@import Foundation;
+
+#import <XCTest/XCTest.h>
+
+#import "AKABindingExpressionParser.h"
+#import "AKAProperty.h"
+#import "AKAArrayComparer.h"
+#import "AKAMutableOrderedDictionary.h"
+#import "AKAOperationQueue.h"
+#import "AKAGroupOperation.h"
+#import "AKABlockOperation.h"
+#import "AKADelegateDispatcher.h"
+
+
+// Benchmarks for the Foundation-only subsystems of the framework.
+//
+// Each benchmark runs a number of warm up rounds followed by the samples measured by XCTest, which
+// reports them (and compares them to baselines) as performance metrics. Results (mean, standard
+// deviation, min, max in seconds per sample) are also collected for all benchmarks and written
+// as JSON to the file specified by the AKA_BENCHMARK_RESULTS environment variable (or to
+// AKABeaconBenchmarks.json in the temporary directory) after the test case finished, so that
+// results can be compared from one commit to the next.
+//
+// Since XCTest measures only once per test method, each test runs exactly one benchmark. Measured
+// blocks do not make assertions, results are verified after measuring.
+
+static const NSUInteger AKABenchmarkWarmUpRounds = 2;
+static const NSUInteger AKABenchmarkChurnCount = 5000;
+
+
+#pragma mark - Fixtures
+#pragma mark -
+
+@interface AKABenchmarkNode: NSObject
+
+@property(nonatomic) AKABenchmarkNode* child;
+@property(nonatomic) NSInteger value;
+
+@end
+
+@implementation AKABenchmarkNode
+@end
+
+
+@protocol AKABenchmarkDelegate<NSObject>
+
+@optional
+- (NSInteger)benchmarkValue;
+- (NSInteger)benchmarkValueForIndex:(NSInteger)index;
+
+@end
+
+@interface AKABenchmarkPrimaryDelegate: NSObject<AKABenchmarkDelegate>
+@end
+
+@implementation AKABenchmarkPrimaryDelegate
+
+- (NSInteger)benchmarkValue
+{
+    return 1;
+}
+
+@end
+
+@interface AKABenchmarkFallbackDelegate: NSObject<AKABenchmarkDelegate>
+@end
+
+@implementation AKABenchmarkFallbackDelegate
+
+- (NSInteger)benchmarkValueForIndex:(NSInteger)index
+{
+    return index;
+}
+
+@end
+
+
+/**
+ Baseline for AKAMutableOrderedDictionary benchmarks: the former implementation using an array to record the key sequence.
+ */
+@interface AKABenchmarkArrayOrderedDictionary: NSObject
+
+- (void)setObject:(id)anObject forKey:(id)aKey;
+- (void)removeObjectForKey:(id)aKey;
+- (void)insertObject:(id)anObject forKey:(id)aKey atIndex:(NSUInteger)anIndex;
+- (id)keyAtIndex:(NSUInteger)anIndex;
+
+@property(nonatomic, readonly) NSMutableArray* sequence;
+@property(nonatomic, readonly) NSMutableDictionary* storage;
+
+@end
+
+@implementation AKABenchmarkArrayOrderedDictionary
+
+- (instancetype)init
+{
+    if (self = [super init])
+    {
+        _sequence = [NSMutableArray new];
+        _storage = [NSMutableDictionary new];
+    }
+    return self;
+}
+
+- (void)setObject:(id)anObject forKey:(id)aKey
+{
+    if (!self.storage[aKey])
+    {
+        [self.sequence addObject:aKey];
+    }
+    self.storage[aKey] = anObject;
+}
+
+- (void)removeObjectForKey:(id)aKey
+{
+    [self.storage removeObjectForKey:aKey];
+    [self.sequence removeObject:aKey];
+}
+
+- (void)insertObject:(id)anObject forKey:(id)aKey atIndex:(NSUInteger)anIndex
+{
+    if (self.storage[aKey])
+    {
+        [self removeObjectForKey:aKey];
+    }
+    [self.sequence insertObject:aKey atIndex:anIndex];
+    self.storage[aKey] = anObject;
+}
+
+- (id)keyAtIndex:(NSUInteger)anIndex
+{
+    return self.sequence[anIndex];
+}
+
+@end
+
+
+#pragma mark - AKABenchmarkTests
+#pragma mark -
+
+@interface AKABenchmarkTests : XCTestCase
+
+@end
+
+@implementation AKABenchmarkTests
+
+#pragma mark - Results
+
++ (NSMutableDictionary<NSString*, NSDictionary*>*)results
+{
+    static NSMutableDictionary* result;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        result = [NSMutableDictionary new];
+    });
+    return result;
+}
+
+/**
+ Writes the results recorded so far (by this and preceding tests) to the file specified by the environment variable AKA_BENCHMARK_RESULTS (defaulting to AKABeaconBenchmarks.json in the temporary directory). Results are written after each test, so that failures to write them are reported as test failures.
+ */
+- (void)tearDown
+{
+    NSString* path = [NSProcessInfo processInfo].environment[@"AKA_BENCHMARK_RESULTS"];
+    if (path.length == 0)
+    {
+        path = [NSTemporaryDirectory() stringByAppendingPathComponent:@"AKABeaconBenchmarks.json"];
+    }
+
+    NSError* error = nil;
+    NSData* data = [NSJSONSerialization dataWithJSONObject:[AKABenchmarkTests results]
+                                                   options:NSJSONWritingPrettyPrinted
+                                                     error:&error];
+    BOOL written = data != nil && [data writeToFile:path options:NSDataWritingAtomic error:&error];
+    XCTAssertTrue(written, @"Failed to write benchmark results to %@: %@", path, error.localizedDescription);
+
+    [super tearDown];
+}
+
+/**
+ Runs the block AKABenchmarkWarmUpRounds times without measuring, then measures it using XCTest's performance metrics and records the statistics of the samples under the specified name. Has to be called at most once per test method.
+ */
+- (void)benchmark:(NSString*)name
+       operations:(NSUInteger)operations
+            block:(void(^)(void))block
+{
+    for (NSUInteger i = 0; i < AKABenchmarkWarmUpRounds; ++i)
+    {
+        @autoreleasepool
+        {
+            block();
+        }
+    }
+
+    NSMutableArray<NSNumber*>* samples = [NSMutableArray new];
+    [self measureMetrics:[self.class defaultPerformanceMetrics]
+    automaticallyStartMeasuring:NO
+                forBlock:
+     ^{
+         @autoreleasepool
+         {
+             [self startMeasuring];
+             CFAbsoluteTime start = CFAbsoluteTimeGetCurrent();
+             block();
+             CFAbsoluteTime duration = CFAbsoluteTimeGetCurrent() - start;
+             [self stopMeasuring];
+             [samples addObject:@(duration)];
+         }
+     }];
+
+    double sum = 0.0;
+    double min = DBL_MAX;
+    double max = 0.0;
+    for (NSNumber* sample in samples)
+    {
+        sum += sample.doubleValue;
+        min = MIN(min, sample.doubleValue);
+        max = MAX(max, sample.doubleValue);
+    }
+
+    double mean = sum / samples.count;
+    double variance = 0.0;
+    for (NSNumber* sample in samples)
+    {
+        variance += (sample.doubleValue - mean) * (sample.doubleValue - mean);
+    }
+    variance /= samples.count > 1 ? samples.count - 1 : 1;
+
+    self.class.results[name] = @{ @"operations": @(operations),
+                                  @"samples": @(samples.count),
+                                  @"mean": @(mean),
+                                  @"stddev": @(sqrt(variance)),
+                                  @"min": @(min),
+                                  @"max": @(max) };
+}
+
+#pragma mark - Binding Expression Parser
+
+- (void)testBenchmarkBindingExpressionParser
+{
+    NSString* text = (@"$when(isEnabled) textValue { format: $enum.Decimal, locale: \"en_US\", "
+                      @"textColor: $color { r:255, g:127, b:63 }, frame: $rect { x:0, y:0, w:100, h:44 } } "
+                      @"$else [ a.b.c, $root.d, $data.e.f, 42, 3.1415, $true ]");
+
+    __block NSUInteger failures = 0;
+    [self benchmark:@"parser.conditionalExpression"
+         operations:500
+              block:
+     ^{
+         for (NSUInteger i = 0; i < 500; ++i)
+         {
+             AKABindingExpression* expression = nil;
+             if (![[AKABindingExpressionParser parserWithString:text] parseBindingExpression:&expression
+                                                                           withSpecification:nil
+                                                                                       error:nil])
+             {
+                 ++failures;
+             }
+         }
+     }];
+
+    XCTAssertEqual((NSUInteger)0, failures);
+}
+
+#pragma mark - Properties
+
+- (void)testBenchmarkPropertyKeyPathObservation
+{
+    AKABenchmarkNode* root = [AKABenchmarkNode new];
+    root.child = [AKABenchmarkNode new];
+    root.child.child = [AKABenchmarkNode new];
+
+    __block NSUInteger notifications = 0;
+    AKAProperty* property = [AKAProperty propertyOfWeakKeyValueTarget:root
+                                                              keyPath:@"child.child.value"
+                                                       changeObserver:
+                             ^(opt_id oldValue __unused, opt_id newValue __unused)
+                             {
+                                 ++notifications;
+                             }];
+    [property startObservingChanges];
+
+    [self benchmark:@"property.keyPathObservation"
+         operations:2000
+              block:
+     ^{
+         for (NSInteger i = 0; i < 1000; ++i)
+         {
+             // Leaf change:
+             root.child.child.value = i;
+
+             // Intermediate change (requires observations to be moved to the new object):
+             AKABenchmarkNode* child = [AKABenchmarkNode new];
+             child.value = -i;
+             root.child.child = child;
+         }
+     }];
+
+    [property stopObservingChanges];
+    XCTAssertGreaterThan(notifications, (NSUInteger)0);
+}
+
+#pragma mark - Array Comparer
+
+- (void)testBenchmarkArrayComparer
+{
+    NSMutableArray* oldArray = [NSMutableArray new];
+    for (NSUInteger i = 0; i < 2000; ++i)
+    {
+        [oldArray addObject:@(i)];
+    }
+
+    // Delete every 7th, move every 13th to the end and insert new items every 11th position:
+    NSMutableArray* newArray = [NSMutableArray new];
+    NSMutableArray* moved = [NSMutableArray new];
+    for (NSUInteger i = 0; i < oldArray.count; ++i)
+    {
+        if (i % 11 == 0)
+        {
+            [newArray addObject:@(10000 + i)];
+        }
+        if (i % 13 == 0)
+        {
+            [moved addObject:oldArray[i]];
+        }
+        else if (i % 7 != 0)
+        {
+            [newArray addObject:oldArray[i]];
+        }
+    }
+    [newArray addObjectsFromArray:moved];
+
+    __block AKAArrayComparer* comparer = nil;
+    [self benchmark:@"arrayComparer.mixedChanges"
+         operations:10
+              block:
+     ^{
+         for (NSUInteger i = 0; i < 10; ++i)
+         {
+             comparer = [[AKAArrayComparer alloc] initWithOldArray:oldArray
+                                                          newArray:newArray];
+             // Movements are computed on demand and are part of the measured work
+             (void)comparer.movementsForTableViews;
+         }
+     }];
+
+    XCTAssertGreaterThan(comparer.deletedItemIndexes.count, (NSUInteger)0);
+    XCTAssertGreaterThan(comparer.insertedItemIndexes.count, (NSUInteger)0);
+    XCTAssertGreaterThan(comparer.movementsForTableViews.count, (NSUInteger)0);
+}
+
+#pragma mark - Ordered Dictionary
+
+- (void)testBenchmarkMutableOrderedDictionary
+{
+    __block NSUInteger mismatches = 0;
+    __block NSUInteger count = 0;
+    [self benchmark:@"orderedDictionary.insertLookupRemove"
+         operations:4000
+              block:
+     ^{
+         AKAMutableOrderedDictionary* dictionary = [AKAMutableOrderedDictionary new];
+         for (NSUInteger i = 0; i < 1000; ++i)
+         {
+             dictionary[@(i)] = @(i);
+         }
+         for (NSUInteger i = 0; i < 1000; ++i)
+         {
+             if (![dictionary[[dictionary keyAtIndex:i]] isEqual:@(i)])
+             {
+                 ++mismatches;
+             }
+         }
+         for (NSUInteger i = 0; i < 1000; i += 2)
+         {
+             [dictionary removeObjectForKey:@(i)];
+         }
+         for (NSUInteger i = 0; i < 500; ++i)
+         {
+             [dictionary insertObject:@(i) forKey:@(i * 2) atIndex:i];
+         }
+         count = 0;
+         for (id key in dictionary)
+         {
+             (void)key;
+             ++count;
+         }
+     }];
+
+    XCTAssertEqual((NSUInteger)0, mismatches);
+    XCTAssertEqual((NSUInteger)1000, count);
+}
+
+/**
+ Performs the same sequence of appends, positional inserts, moves (re-insertions) and removals on the specified dictionary (which is either an AKAMutableOrderedDictionary or an AKABenchmarkArrayOrderedDictionary).
+ */
+- (void)churnOrderedDictionary:(id)dictionary
+                         count:(NSUInteger)count
+{
+    for (NSUInteger i = 0; i < count; ++i)
+    {
+        [dictionary setObject:@(i) forKey:@(i)];
+    }
+    for (NSUInteger i = 0; i < count; ++i)
+    {
+        NSUInteger key = (i * 7919) % count;
+        [dictionary insertObject:@(key) forKey:@(key) atIndex:(i * 31) % count];
+        [dictionary insertObject:@(count + i) forKey:@(count + i) atIndex:(i * 17) % count];
+        [dictionary removeObjectForKey:@(count + i)];
+    }
+    for (NSUInteger i = 0; i < count; i += 3)
+    {
+        [dictionary removeObjectForKey:[dictionary keyAtIndex:i / 3]];
+    }
+}
+
+- (void)testBenchmarkMutableOrderedDictionaryChurn
+{
+    NSUInteger count = AKABenchmarkChurnCount;
+
+    __block AKAMutableOrderedDictionary* dictionary = nil;
+    [self benchmark:@"orderedDictionary.churn"
+         operations:count * 4 + count / 3
+              block:
+     ^{
+         dictionary = [AKAMutableOrderedDictionary new];
+         [self churnOrderedDictionary:dictionary count:count];
+     }];
+
+    // Both implementations have to produce the same key sequence:
+    AKABenchmarkArrayOrderedDictionary* baseline = [AKABenchmarkArrayOrderedDictionary new];
+    [self churnOrderedDictionary:baseline count:count];
+    XCTAssertEqualObjects(dictionary.keyEnumerator.allObjects, baseline.sequence);
+    XCTAssertEqualObjects(dictionary.reverseKeyEnumerator.allObjects,
+                          baseline.sequence.reverseObjectEnumerator.allObjects);
+}
+
+- (void)testBenchmarkMutableOrderedDictionaryChurnArrayBaseline
+{
+    NSUInteger count = AKABenchmarkChurnCount;
+
+    [self benchmark:@"orderedDictionary.churn.arrayBaseline"
+         operations:count * 4 + count / 3
+              block:
+     ^{
+         [self churnOrderedDictionary:[AKABenchmarkArrayOrderedDictionary new] count:count];
+     }];
+}
+
+#pragma mark - Operations
+
+- (void)testBenchmarkGroupOperation
+{
+    AKAOperationQueue* queue = [AKAOperationQueue new];
+    __block NSUInteger timeouts = 0;
+
+    [self benchmark:@"operations.groupOperation"
+         operations:100
+              block:
+     ^{
+         dispatch_semaphore_t finished = dispatch_semaphore_create(0);
+
+         NSMutableArray* operations = [NSMutableArray new];
+         for (NSUInteger i = 0; i < 100; ++i)
+         {
+             [operations addObject:[[AKABlockOperation alloc] initWithBlock:
+                                    ^(void (^ _Nonnull finish)(void))
+                                    {
+                                        finish();
+                                    }]];
+         }
+         AKAGroupOperation* group = [[AKAGroupOperation alloc] initWithOperations:operations];
+         [group addDidFinishObserverWithBlock:^(AKAOperation * _Nonnull operation __unused,
+                                                NSArray<NSError *> * _Nullable errors __unused)
+          {
+              dispatch_semaphore_signal(finished);
+          }];
+         [group addToOperationQueue:queue];
+
+         if (dispatch_semaphore_wait(finished, dispatch_time(DISPATCH_TIME_NOW, (int64_t)(10 * NSEC_PER_SEC))) != 0)
+         {
+             ++timeouts;
+         }
+     }];
+
+    XCTAssertEqual((NSUInteger)0, timeouts);
+}
+
+#pragma mark - Delegate Dispatcher
+
+- (void)testBenchmarkDelegateDispatcher
+{
+    AKABenchmarkPrimaryDelegate* primary = [AKABenchmarkPrimaryDelegate new];
+    AKABenchmarkFallbackDelegate* fallback = [AKABenchmarkFallbackDelegate new];
+    __block NSInteger sum = 0;
+
+    [self benchmark:@"delegateDispatcher.createAndDispatch"
+         operations:10100
+              block:
+     ^{
+         // Creating dispatchers (protocol analysis) ...
+         AKADelegateDispatcher* dispatcher = nil;
+         for (NSUInteger i = 0; i < 100; ++i)
+         {
+             dispatcher = [[AKADelegateDispatcher alloc] initWithProtocols:@[ @protocol(AKABenchmarkDelegate) ]
+                                                                 delegates:@[ primary, fallback ]];
+         }
+
+         // ... and forwarding messages:
+         id<AKABenchmarkDelegate> delegate = (id<AKABenchmarkDelegate>)dispatcher;
+         sum = 0;
+         for (NSInteger i = 0; i < 5000; ++i)
+         {
+             if ([delegate respondsToSelector:@selector(benchmarkValue)])
+             {
+                 sum += [delegate benchmarkValue];
+             }
+             sum += [delegate benchmarkValueForIndex:i];
+         }
+     }];
+
+    XCTAssertGreaterThan(sum, 0);
+}
+
+@end
@@ -0,0 +1,65 @@
+//
+//  AKABindingAttributeTableTests.m
+//  AKABeacon
+//
+//  Created by Michael Utech on 19.10.16.
+//  Copyright © 2016 Michael Utech & AKA Sarl. All rights reserved.
+//
+
+@import UIKit;
+
+#import <XCTest/XCTest.h>
+
+#import "AKABindingAttributeTable.h"
+#import "AKAPropertyBinding.h"
+#import "AKABinding_UISegmentedControl_valueBinding.h"
+
+@interface AKABindingAttributeTableTests : XCTestCase
+
+@end
+
+@implementation AKABindingAttributeTableTests
+
+- (void)testTablesAreSharedPerBindingType
+{
+    Class bindingType = [AKABinding_UISegmentedControl_valueBinding class];
+
+    XCTAssertEqual([AKABindingAttributeTable tableForBindingType:bindingType],
+                   [AKABindingAttributeTable tableForBindingType:bindingType]);
+    XCTAssertNotEqual([AKABindingAttributeTable tableForBindingType:bindingType],
+                      [AKABindingAttributeTable tableForBindingType:[AKAPropertyBinding class]]);
+}
+
+- (void)testEntriesResolveSpecifications
+{
+    Class bindingType = [AKABinding_UISegmentedControl_valueBinding class];
+    AKABindingAttributeTable* table = [AKABindingAttributeTable tableForBindingType:bindingType];
+
+    AKABindingAttributeTableEntry* title = [table entryForAttributeNamed:@"title"];
+    XCTAssertEqualObjects(@"titleBindingExpression", title.bindingPropertyName);
+    XCTAssertEqual(AKABindingAttributeUseAssignExpressionToBindingProperty, title.attributeUse);
+    XCTAssertEqual([bindingType specificationForAttributeNamed:@"title"], title.specification);
+
+    AKABindingAttributeTableEntry* choices = [table entryForAttributeNamed:@"choices"];
+    XCTAssertEqualObjects(@"choices", choices.bindingPropertyName);
+    XCTAssertEqual([AKAPropertyBinding class], choices.bindingType);
+
+    XCTAssertNil([table entryForAttributeNamed:@"undefined"]);
+}
+
+- (void)testAssignValueToBindingProperty
+{
+    Class bindingType = [AKABinding_UISegmentedControl_valueBinding class];
+    AKABindingAttributeTable* table = [AKABindingAttributeTable tableForBindingType:bindingType];
+    AKABinding_UISegmentedControl_valueBinding* binding = [AKABinding_UISegmentedControl_valueBinding new];
+
+    NSArray* choices = @[ @"one", @"two" ];
+    [table assignValue:choices toBindingProperty:@"choices" ofBinding:binding];
+    XCTAssertEqual(choices, [binding valueForKey:@"choices"]);
+
+    // Scalar properties are assigned using key value coding
+    [table assignValue:@NO toBindingProperty:@"shouldUpdateSegments" ofBinding:binding];
+    XCTAssertEqualObjects(@NO, [binding valueForKey:@"shouldUpdateSegments"]);
+}
+
+@end
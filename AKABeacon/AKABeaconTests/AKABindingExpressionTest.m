@@ -723,6 +723,35 @@
     [texts enumerateObjectsUsingBlock:performTest];
 }
 
+- (void)testEnumerationRegistryFromBackgroundThreads
+{
+    [AKABindingExpressionSpecification registerEnumerationTypes:@{ @"BatchEnumType": @{ @"One": @(1) } }
+                                                   optionsTypes:@{ @"BatchOptionsType": @{ @"Two": @(2) } }];
+    // Already registered types are not replaced
+    [AKABindingExpressionSpecification registerEnumerationType:@"BatchEnumType"
+                                              withValuesByName:@{ @"One": @(-1) }];
+
+    XCTAssertTrue([AKABindingExpressionSpecification isEnumerationTypeDefined:@"BatchOptionsType"]);
+
+    dispatch_apply(100, dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0), ^(size_t iteration) {
+        NSString* enumerationType = [NSString stringWithFormat:@"BackgroundEnumType%zu", iteration];
+        [AKABindingExpressionSpecification registerEnumerationType:enumerationType
+                                                  withValuesByName:@{ @"Value": @(iteration) }];
+
+        NSError* error = nil;
+        XCTAssertEqualObjects(@(iteration), [AKABindingExpressionSpecification resolveEnumeratedValue:@"Value"
+                                                                                              forType:enumerationType
+                                                                                                error:&error]);
+        XCTAssertEqualObjects(@(1), [AKABindingExpressionSpecification resolveEnumeratedValue:@"One"
+                                                                                      forType:@"BatchEnumType"
+                                                                                        error:&error]);
+        XCTAssertEqualObjects(@"1", [AKABindingExpressionSpecification resolveEnumeratedValue:@"One.stringValue"
+                                                                                      forType:@"BatchEnumType"
+                                                                                        error:&error]);
+        XCTAssertNil(error);
+    });
+}
+
 - (void)testValidColors
 {
     CGFloat component = 127 / 255.0f; // Test fails for 127/255.0 (no f) because of different precision and exact floating point comparison in [UIColor isEqual]
@@ -0,0 +1,99 @@
+//
+//  AKABindingInitializationPlanTests.m
+//  AKABeacon
+//
+//  Created by Michael Utech on 19.10.16.
+//  Copyright © 2016 Michael Utech & AKA Sarl. All rights reserved.
+//
+
+@import UIKit;
+
+#import <XCTest/XCTest.h>
+
+#import "AKABindingInitializationPlan.h"
+#import "AKABindingExpression.h"
+#import "AKAPropertyBinding.h"
+#import "AKABinding_UISegmentedControl_valueBinding.h"
+
+@interface AKABindingInitializationPlanTests : XCTestCase
+
+@end
+
+@implementation AKABindingInitializationPlanTests
+
+- (AKABindingExpression*)segmentedControlBindingExpression
+{
+    NSError* error = nil;
+    AKABindingExpression* result =
+        [AKABindingExpression bindingExpressionWithString:@"value { choices: [ \"one\", \"two\" ], updateSegments: $false, title: description }"
+                                              bindingType:[AKABinding_UISegmentedControl_valueBinding class]
+                                                    error:&error];
+    XCTAssertNotNil(result);
+    XCTAssertNil(error);
+
+    return result;
+}
+
+- (void)testPlansAreSharedPerExpressionAndBindingType
+{
+    AKABindingExpression* expression = [self segmentedControlBindingExpression];
+    Class bindingType = [AKABinding_UISegmentedControl_valueBinding class];
+
+    AKABindingInitializationPlan* plan = [AKABindingInitializationPlan planForExpression:expression
+                                                                            bindingType:bindingType];
+    XCTAssertEqual(plan, [AKABindingInitializationPlan planForExpression:expression
+                                                             bindingType:bindingType]);
+    XCTAssertEqual(bindingType, plan.bindingType);
+    XCTAssertEqual([AKABindingAttributeTable tableForBindingType:bindingType], plan.attributeTable);
+
+    AKABindingInitializationPlan* otherPlan = [AKABindingInitializationPlan planForExpression:expression
+                                                                                 bindingType:[AKAPropertyBinding class]];
+    XCTAssertNotEqual(plan, otherPlan);
+    XCTAssertEqual([AKAPropertyBinding class], otherPlan.bindingType);
+}
+
+- (void)testStepsResolveAttributes
+{
+    AKABindingExpression* expression = [self segmentedControlBindingExpression];
+    AKABindingInitializationPlan* plan =
+        [AKABindingInitializationPlan planForExpression:expression
+                                            bindingType:[AKABinding_UISegmentedControl_valueBinding class]];
+
+    XCTAssertEqual((NSUInteger)3, plan.steps.count);
+
+    NSMutableDictionary<NSString*, AKABindingInitializationStep*>* steps = [NSMutableDictionary new];
+    for (AKABindingInitializationStep* step in plan.steps)
+    {
+        steps[step.attributeName] = step;
+        XCTAssertEqual(expression.attributes[step.attributeName], step.attributeExpression);
+    }
+
+    // Sub bindings are created for each binding
+    XCTAssertEqual(AKABindingInitializationStepKindAttribute, steps[@"choices"].kind);
+
+    // Constant values are evaluated when the plan is compiled
+    XCTAssertEqual(AKABindingInitializationStepKindAssignValue, steps[@"updateSegments"].kind);
+    XCTAssertEqualObjects(@NO, steps[@"updateSegments"].value);
+    XCTAssertEqualObjects(@"shouldUpdateSegments", steps[@"updateSegments"].entry.bindingPropertyName);
+
+    XCTAssertEqual(AKABindingInitializationStepKindAssignValue, steps[@"title"].kind);
+    XCTAssertEqual(expression.attributes[@"title"], steps[@"title"].value);
+}
+
+- (void)testStepsOfUnspecifiedAttributes
+{
+    // AKAPropertyBinding does not specify any attributes
+    AKABindingInitializationPlan* plan =
+        [AKABindingInitializationPlan planForExpression:[self segmentedControlBindingExpression]
+                                            bindingType:[AKAPropertyBinding class]];
+
+    XCTAssertEqual((NSUInteger)3, plan.steps.count);
+    for (AKABindingInitializationStep* step in plan.steps)
+    {
+        XCTAssertEqual(AKABindingInitializationStepKindUnspecifiedAttribute, step.kind);
+        XCTAssertNil(step.entry);
+        XCTAssertNil(step.value);
+    }
+}
+
+@end
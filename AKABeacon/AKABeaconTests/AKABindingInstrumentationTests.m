@@ -0,0 +1,112 @@
+//
+//  AKABindingInstrumentationTests.m
+//  AKABeacon
+//
+//  Created by Michael Utech on 19.10.16.
+//  Copyright © 2016 Michael Utech & AKA Sarl. All rights reserved.
+//
+
+@import UIKit;
+
+#import <XCTest/XCTest.h>
+
+#import "AKABindingInstrumentation.h"
+#import "AKABindingController+ChildBindingControllers.h"
+#import "UILabel+AKAIBBindingProperties_textBinding.h"
+
+// Instrumentation is enabled for Debug builds of the framework and its tests.
+#if AKA_BINDING_INSTRUMENTATION
+
+@interface AKABindingInstrumentationTests : XCTestCase
+
+@property(nonatomic) UIViewController* viewController;
+@property(nonatomic) AKABindingController* controller;
+
+@end
+
+@implementation AKABindingInstrumentationTests
+
+- (void)setUp
+{
+    [super setUp];
+
+    [AKABindingInstrumentation resetAggregatedStatistics];
+
+    self.viewController = [UIViewController new];
+    self.controller = [AKABindingController bindingControllerForViewController:self.viewController
+                                                               withDataContext:[NSMutableDictionary new]
+                                                                      delegate:nil
+                                                                         error:nil];
+    XCTAssertNotNil(self.controller);
+    [self.controller startObservingChanges];
+}
+
+- (void)tearDown
+{
+    [self.controller stopObservingChanges];
+    self.controller = nil;
+    [super tearDown];
+}
+
+- (void)testBindingUpdatesAreCounted
+{
+    UIView* view = [UIView new];
+    UILabel* label = [UILabel new];
+    label.textBinding_aka = @"name";
+    [view addSubview:label];
+
+    NSMutableDictionary* item = [NSMutableDictionary dictionaryWithDictionary:@{ @"name": @"A" }];
+    AKABindingController* child =
+        [self.controller createOrReuseBindingControllerForTargetObjectHierarchy:view
+                                                                withDataContext:item
+                                                                          error:nil];
+    XCTAssertNotNil(child);
+    XCTAssertEqualObjects(@"A", label.text);
+
+    __block AKABinding* binding = nil;
+    [child enumerateBindingsUsingBlock:^(req_AKABinding childBinding, outreq_BOOL stop) {
+        binding = childBinding;
+        *stop = YES;
+    }];
+    AKABindingStatistics* statistics = binding.statistics;
+    XCTAssertNotNil(statistics);
+    XCTAssertEqualObjects(@"name", statistics.expressionText);
+
+    NSUInteger sourceChangeCount = statistics.sourceChangeCount;
+    NSUInteger targetUpdateCount = statistics.targetUpdateCount;
+    NSUInteger conversionCount = statistics.conversionCount;
+    XCTAssertGreaterThan(targetUpdateCount, (NSUInteger)0);
+
+    for (NSString* name in @[ @"B", @"C", @"D" ])
+    {
+        [item setValue:name forKey:@"name"];
+    }
+    XCTAssertEqualObjects(@"D", label.text);
+
+    XCTAssertEqual(sourceChangeCount + 3, statistics.sourceChangeCount);
+    XCTAssertEqual(targetUpdateCount + 3, statistics.targetUpdateCount);
+    XCTAssertEqual(conversionCount + 3, statistics.conversionCount);
+    XCTAssertEqual((NSUInteger)0, statistics.validationFailureCount);
+    XCTAssertGreaterThan(statistics.targetUpdateTime, 0.0);
+    XCTAssertGreaterThanOrEqual(statistics.targetUpdateTime, statistics.conversionTime);
+
+    // Events are also recorded in the statistics aggregated by binding type and expression
+    AKABindingStatistics* aggregate = nil;
+    for (AKABindingStatistics* candidate in [AKABindingInstrumentation aggregatedStatistics])
+    {
+        if (candidate.bindingType == binding.class && [candidate.expressionText isEqualToString:@"name"])
+        {
+            aggregate = candidate;
+        }
+    }
+    XCTAssertNotNil(aggregate);
+    XCTAssertEqual(statistics.targetUpdateCount, aggregate.targetUpdateCount);
+
+    NSArray<AKABindingStatistics*>* mostExpensive = [self.controller mostExpensiveBindingStatisticsWithLimit:1];
+    XCTAssertEqual((NSUInteger)1, mostExpensive.count);
+    XCTAssertEqual(statistics, mostExpensive.firstObject);
+}
+
+@end
+
+#endif
@@ -0,0 +1,152 @@
+//
+//  AKABindingPlanTests.m
+//  AKABeacon
+//
+//  Created by Michael Utech on 19.10.16.
+//  Copyright © 2016 Michael Utech & AKA Sarl. All rights reserved.
+//
+
+@import UIKit;
+
+#import <XCTest/XCTest.h>
+
+#import "AKABindingPlan.h"
+#import "UILabel+AKAIBBindingProperties_textBinding.h"
+
+@interface AKABindingPlanTests : XCTestCase
+
+@end
+
+@implementation AKABindingPlanTests
+
+- (void)setUp
+{
+    [super setUp];
+    [AKABindingPlan removeAllPlans];
+}
+
+/**
+ Creates a cell with two labels of which only the one at the specified index is bound.
+ */
+- (UITableViewCell*)cellInTableView:(UITableView*)tableView
+               withBoundLabelAtIndex:(NSUInteger)boundIndex
+{
+    UITableViewCell* result = [[UITableViewCell alloc] initWithStyle:UITableViewCellStyleDefault
+                                                     reuseIdentifier:@"cell"];
+    for (NSUInteger i = 0; i < 2; ++i)
+    {
+        UILabel* label = [UILabel new];
+        if (i == boundIndex)
+        {
+            label.textBinding_aka = @"text";
+        }
+        [result.contentView addSubview:label];
+    }
+    [tableView addSubview:result];
+
+    return result;
+}
+
+- (void)testPlanResolvesBindingTargetsOfOtherInstances
+{
+    UITableView* tableView = [UITableView new];
+    UITableViewCell* cell = [self cellInTableView:tableView withBoundLabelAtIndex:1];
+    UITableViewCell* otherCell = [self cellInTableView:tableView withBoundLabelAtIndex:1];
+
+    AKABindingPlan* plan = [AKABindingPlan planForTargetObjectHierarchy:cell];
+    XCTAssertNotNil(plan);
+    XCTAssertEqual((NSUInteger)1, plan.count);
+    XCTAssertEqual(plan, [AKABindingPlan planForTargetObjectHierarchy:otherCell]);
+
+    NSArray* targets = [plan bindingTargetsInTargetObjectHierarchy:otherCell];
+    XCTAssertEqual((NSUInteger)1, targets.count);
+    XCTAssertEqual(otherCell.contentView.subviews[1], targets.firstObject);
+}
+
+- (void)testPlanOnlyFollowsPathsToBoundTargets
+{
+    UITableView* tableView = [UITableView new];
+    NSMutableArray<UITableViewCell*>* cells = [NSMutableArray new];
+    for (NSUInteger i = 0; i < 2; ++i)
+    {
+        UITableViewCell* cell = [[UITableViewCell alloc] initWithStyle:UITableViewCellStyleDefault
+                                                       reuseIdentifier:@"cell"];
+        UIView* container = [UIView new];
+        UILabel* label = [UILabel new];
+        label.textBinding_aka = @"text";
+        [container addSubview:label];
+
+        // An unbound subtree
+        UIView* subtree = [UIView new];
+        [subtree addSubview:[UIView new]];
+        [subtree.subviews[0] addSubview:[UIView new]];
+
+        [cell.contentView addSubview:subtree];
+        [cell.contentView addSubview:container];
+        [tableView addSubview:cell];
+        [cells addObject:cell];
+    }
+
+    AKABindingPlan* plan = [AKABindingPlan planForTargetObjectHierarchy:cells[0]];
+    XCTAssertEqual((NSUInteger)1, plan.count);
+
+    // Views below the children of containers on recorded paths are not visited
+    UITableViewCell* otherCell = cells[1];
+    [otherCell.contentView.subviews[0].subviews[0] addSubview:[UIView new]];
+    XCTAssertEqualObjects(@[ otherCell.contentView.subviews[1].subviews[0] ],
+                          [plan bindingTargetsInTargetObjectHierarchy:otherCell]);
+
+    // Replacing a view on a recorded path is detected
+    [otherCell.contentView.subviews[1].subviews[0] removeFromSuperview];
+    [otherCell.contentView.subviews[1] addSubview:[UIView new]];
+    XCTAssertNil([plan bindingTargetsInTargetObjectHierarchy:otherCell]);
+}
+
+- (void)testPlansAreScopedToOwningTableView
+{
+    // Same cell class and reuse identifier, but different prototypes
+    UITableViewCell* cell = [self cellInTableView:[UITableView new] withBoundLabelAtIndex:0];
+    UITableViewCell* otherCell = [self cellInTableView:[UITableView new] withBoundLabelAtIndex:1];
+
+    AKABindingPlan* plan = [AKABindingPlan planForTargetObjectHierarchy:cell];
+    AKABindingPlan* otherPlan = [AKABindingPlan planForTargetObjectHierarchy:otherCell];
+    XCTAssertNotEqual(plan, otherPlan);
+    XCTAssertEqualObjects(plan.prototypeKey, otherPlan.prototypeKey);
+
+    XCTAssertEqualObjects(@[ cell.contentView.subviews[0] ],
+                          [plan bindingTargetsInTargetObjectHierarchy:cell]);
+    XCTAssertEqualObjects(@[ otherCell.contentView.subviews[1] ],
+                          [otherPlan bindingTargetsInTargetObjectHierarchy:otherCell]);
+}
+
+- (void)testCellsOutsideOfTableViewsHaveNoPlan
+{
+    UITableViewCell* cell = [self cellInTableView:[UITableView new] withBoundLabelAtIndex:0];
+    [cell removeFromSuperview];
+
+    XCTAssertNil([AKABindingPlan planForTargetObjectHierarchy:cell]);
+}
+
+- (void)testHierarchiesWithExtraViewsAreNotResolved
+{
+    UITableView* tableView = [UITableView new];
+    UITableViewCell* cell = [self cellInTableView:tableView withBoundLabelAtIndex:0];
+    AKABindingPlan* plan = [AKABindingPlan planForTargetObjectHierarchy:cell];
+
+    // Bindings of the extra label would be lost if the plan was used
+    UITableViewCell* otherCell = [self cellInTableView:tableView withBoundLabelAtIndex:0];
+    UILabel* extraLabel = [UILabel new];
+    extraLabel.textBinding_aka = @"text";
+    [otherCell.contentView.subviews[1] addSubview:extraLabel];
+
+    XCTAssertEqual(plan, [AKABindingPlan planForTargetObjectHierarchy:otherCell]);
+    XCTAssertNil([plan bindingTargetsInTargetObjectHierarchy:otherCell]);
+
+    // Missing views are detected as well
+    [otherCell.contentView.subviews[1] removeFromSuperview];
+    XCTAssertNil([plan bindingTargetsInTargetObjectHierarchy:otherCell]);
+
+    XCTAssertNotNil([plan bindingTargetsInTargetObjectHierarchy:cell]);
+}
+
+@end
@@ -0,0 +1,118 @@
+//
+//  AKAChildBindingControllerTests.m
+//  AKABeacon
+//
+//  Created by Michael Utech on 19.10.16.
+//  Copyright © 2016 Michael Utech & AKA Sarl. All rights reserved.
+//
+
+@import UIKit;
+
+#import <XCTest/XCTest.h>
+
+#import "AKABindingController.h"
+#import "AKABindingController+ChildBindingControllers.h"
+#import "UILabel+AKAIBBindingProperties_textBinding.h"
+
+@interface AKAChildBindingControllerTests : XCTestCase
+
+@property(nonatomic) UIViewController* viewController;
+@property(nonatomic) AKABindingController* controller;
+
+@end
+
+@implementation AKAChildBindingControllerTests
+
+- (void)setUp
+{
+    [super setUp];
+
+    self.viewController = [UIViewController new];
+    self.controller = [AKABindingController bindingControllerForViewController:self.viewController
+                                                               withDataContext:[NSMutableDictionary new]
+                                                                      delegate:nil
+                                                                         error:nil];
+    XCTAssertNotNil(self.controller);
+    [self.controller startObservingChanges];
+}
+
+- (void)tearDown
+{
+    [self.controller stopObservingChanges];
+    self.controller = nil;
+    [super tearDown];
+}
+
+- (NSSet<AKABinding*>*)bindingsOfController:(AKABindingController*)controller
+{
+    NSMutableSet* result = [NSMutableSet new];
+    [controller enumerateBindingsUsingBlock:^(req_AKABinding binding, outreq_BOOL stop) {
+        (void)stop;
+        [result addObject:binding];
+    }];
+    return result;
+}
+
+- (void)testRecycledChildControllerIsReboundToNewDataContext
+{
+    // A reusable view hierarchy, like a table view cell
+    UIView* cellView = [UIView new];
+    UILabel* label = [UILabel new];
+    label.textBinding_aka = @"name";
+    [cellView addSubview:label];
+
+    NSMutableDictionary* item = [NSMutableDictionary dictionaryWithDictionary:@{ @"name": @"A" }];
+    NSMutableDictionary* otherItem = [NSMutableDictionary dictionaryWithDictionary:@{ @"name": @"B" }];
+
+    AKABindingController* child =
+        [self.controller createOrReuseBindingControllerForTargetObjectHierarchy:cellView
+                                                                withDataContext:item
+                                                                          error:nil];
+    XCTAssertNotNil(child);
+    XCTAssertTrue(child.isObservingChanges);
+    XCTAssertEqualObjects(@"A", label.text);
+    XCTAssertEqual((NSUInteger)1, self.controller.childBindingControllerCreationCount);
+    XCTAssertEqual((NSUInteger)0, self.controller.childBindingControllerReuseCount);
+
+    NSSet* bindings = [self bindingsOfController:child];
+    XCTAssertEqual((NSUInteger)1, bindings.count);
+
+    // Recycle the hierarchy (f.e. didEndDisplayingCell) and reuse it for another data context
+    XCTAssertTrue([self.controller removeBindingControllerForTargetObjectHierarchy:cellView
+                                                                     enqueForReuse:YES]);
+    XCTAssertFalse(child.isObservingChanges);
+
+    AKABindingController* reused =
+        [self.controller createOrReuseBindingControllerForTargetObjectHierarchy:cellView
+                                                                withDataContext:otherItem
+                                                                          error:nil];
+
+    // Same controller and bindings, only the data context changed
+    XCTAssertEqual(child, reused);
+    XCTAssertEqual(otherItem, reused.dataContext);
+    XCTAssertTrue(reused.isObservingChanges);
+    XCTAssertEqualObjects(bindings, [self bindingsOfController:reused]);
+    XCTAssertEqualObjects(@"B", label.text);
+    XCTAssertEqual((NSUInteger)1, self.controller.childBindingControllerCreationCount);
+    XCTAssertEqual((NSUInteger)1, self.controller.childBindingControllerReuseCount);
+
+    // Rebound bindings observe the new data context
+    [otherItem setValue:@"C" forKey:@"name"];
+    XCTAssertEqualObjects(@"C", label.text);
+    [item setValue:@"D" forKey:@"name"];
+    XCTAssertEqualObjects(@"C", label.text);
+
+    // Removing without enqueuing for reuse discards the controller, the next one is created
+    XCTAssertTrue([self.controller removeBindingControllerForTargetObjectHierarchy:cellView
+                                                                     enqueForReuse:NO]);
+    AKABindingController* created =
+        [self.controller createOrReuseBindingControllerForTargetObjectHierarchy:cellView
+                                                                withDataContext:item
+                                                                          error:nil];
+    XCTAssertNotEqual(child, created);
+    XCTAssertEqualObjects(@"D", label.text);
+    XCTAssertEqual((NSUInteger)2, self.controller.childBindingControllerCreationCount);
+    XCTAssertEqual((NSUInteger)1, self.controller.childBindingControllerReuseCount);
+}
+
+@end
@@ -0,0 +1,102 @@
+//
+//  AKAChoiceListTests.m
+//  AKABeacon
+//
+//  Created by Michael Utech on 19.10.16.
+//  Copyright © 2016 Michael Utech & AKA Sarl. All rights reserved.
+//
+
+@import Foundation;
+
+#import <XCTest/XCTest.h>
+
+#import "AKAChoiceList.h"
+
+@interface AKAChoiceListTests : XCTestCase
+
+@end
+
+@implementation AKAChoiceListTests
+
+- (NSArray*)applyChangesFromItems:(NSArray*)oldItems
+                          toItems:(NSArray*)newItems
+{
+    NSMutableArray* result = [NSMutableArray arrayWithArray:oldItems];
+    AKAChoiceList* choiceList = [[AKAChoiceList alloc] initWithItems:oldItems];
+
+    [choiceList updateItems:newItems usingBlock:
+     ^(AKAChoiceListChangeType type, id item, NSUInteger fromIndex, NSUInteger toIndex)
+     {
+         switch (type)
+         {
+             case AKAChoiceListChangeTypeDelete:
+                 XCTAssertEqualObjects(item, result[fromIndex]);
+                 [result removeObjectAtIndex:fromIndex];
+                 break;
+
+             case AKAChoiceListChangeTypeInsert:
+                 [result insertObject:item atIndex:toIndex];
+                 break;
+
+             case AKAChoiceListChangeTypeMove:
+                 XCTAssertEqualObjects(item, result[fromIndex]);
+                 [result removeObjectAtIndex:fromIndex];
+                 [result insertObject:item atIndex:toIndex];
+                 break;
+         }
+     }];
+    XCTAssertEqualObjects(newItems, choiceList.items);
+
+    return result;
+}
+
+- (void)testIndexOfItem
+{
+    AKAChoiceList* choiceList = [[AKAChoiceList alloc] initWithItems:@[ @"CHF", @"EUR", [NSNull null], @"EUR" ]];
+
+    XCTAssertEqual((NSUInteger)1, [choiceList indexOfItem:[@"EU" stringByAppendingString:@"R"]]);
+    XCTAssertEqual((NSUInteger)2, [choiceList indexOfItem:nil]);
+    XCTAssertEqual((NSUInteger)NSNotFound, [choiceList indexOfItem:@"USD"]);
+}
+
+- (void)testChangesReproduceNewItems
+{
+    NSArray* oldItems = @[ @1, @2, @3, @4, @5, @6 ];
+
+    NSArray* newItems = @[ @6, @1, @7, @3, @2 ];
+    XCTAssertEqualObjects(newItems, [self applyChangesFromItems:oldItems toItems:newItems]);
+
+    newItems = @[ @6, @5, @4, @3, @2, @1 ];
+    XCTAssertEqualObjects(newItems, [self applyChangesFromItems:oldItems toItems:newItems]);
+
+    newItems = @[];
+    XCTAssertEqualObjects(newItems, [self applyChangesFromItems:oldItems toItems:newItems]);
+
+    newItems = @[ @1, @1, @2 ];
+    XCTAssertEqualObjects(newItems, [self applyChangesFromItems:oldItems toItems:newItems]);
+}
+
+- (void)testTitlesAreComputedLazilyAndPreserved
+{
+    __block NSUInteger computed = 0;
+    AKAChoiceList* choiceList = [[AKAChoiceList alloc] initWithItems:@[ @1, @2, @3 ]];
+    choiceList.titleProvider = ^NSString*(id item)
+    {
+        ++computed;
+        return [NSString stringWithFormat:@"#%@", item];
+    };
+    XCTAssertEqual((NSUInteger)0, computed);
+
+    XCTAssertEqualObjects(@"#2", [choiceList titleForItemAtIndex:1]);
+    XCTAssertEqualObjects(@"#2", [choiceList titleForItemAtIndex:1]);
+    XCTAssertEqual((NSUInteger)1, computed);
+
+    XCTAssertFalse([choiceList updateItems:@[ @1, @2, @3 ] usingBlock:nil]);
+    XCTAssertTrue([choiceList updateItems:@[ @2, @4 ] usingBlock:nil]);
+    XCTAssertEqualObjects(@"#2", [choiceList titleForItemAtIndex:0]);
+    XCTAssertEqual((NSUInteger)1, computed);
+    XCTAssertEqualObjects(@"#4", [choiceList titleForItemAtIndex:1]);
+    XCTAssertEqual((NSUInteger)2, computed);
+}
+
+@end
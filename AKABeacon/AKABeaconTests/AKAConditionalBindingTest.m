@@ -12,6 +12,7 @@
 #import "UILabel+AKAIBBindingProperties_textBinding.h"
 #import "AKABindingExpression+Accessors.h"
 #import "AKAViewBinding.h"
+#import "AKAConditionalBinding.h"
 
 #import "AKABindingTestBase.h"
 
@@ -113,4 +114,59 @@
     [binding stopObservingChanges];
 }
 
+- (void)testConditionalBindingObservesPredicatesLazily
+{
+    self.dataContext[@"key"] = @1;
+    self.dataContext[@"a"] = @"A";
+    self.dataContext[@"b"] = @"B";
+    self.dataContext[@"c"] = @"C";
+
+    UILabel* label = [UILabel new];
+    label.textBinding_aka = (@"$when(\"$key = 1\" { key: key }) a "
+                             @"$when(\"$key = 2\" { key: key }) b "
+                             @"$else c");
+
+    AKABindingExpression* expression =
+        [AKABindingExpression bindingExpressionForTarget:label property:@selector(textBinding_aka)];
+
+    AKAConditionalBinding* binding = (id)[expression.specification.bindingType bindingToTarget:label
+                                                                                withExpression:expression
+                                                                                       context:self
+                                                                                         owner:nil
+                                                                                      delegate:nil
+                                                                                         error:nil];
+    XCTAssertTrue([binding isKindOfClass:[AKAConditionalBinding class]]);
+    XCTAssertEqual((NSUInteger)3, binding.clauses.count);
+
+    [binding startObservingChanges];
+
+    // Clauses following the active clause are not observed
+    XCTAssertEqualObjects(label.text, @"A");
+    XCTAssertEqual(binding.clauses[0], binding.activeClause);
+    XCTAssertTrue(binding.clauses[0].isObservingPredicate);
+    XCTAssertFalse(binding.clauses[1].isObservingPredicate);
+    XCTAssertFalse(binding.clauses[2].isObservingPredicate);
+
+    // Observation is re-armed when the selection moves past a clause
+    self.dataContext[@"key"] = @3;
+    XCTAssertEqualObjects(label.text, @"C");
+    XCTAssertEqual(binding.clauses[2], binding.activeClause);
+    XCTAssertTrue(binding.clauses[1].isObservingPredicate);
+    XCTAssertTrue(binding.clauses[2].isObservingPredicate);
+
+    self.dataContext[@"key"] = @2;
+    XCTAssertEqualObjects(label.text, @"B");
+    XCTAssertTrue(binding.clauses[1].isObservingPredicate);
+    XCTAssertFalse(binding.clauses[2].isObservingPredicate);
+
+    self.dataContext[@"key"] = @1;
+    XCTAssertEqualObjects(label.text, @"A");
+    XCTAssertFalse(binding.clauses[1].isObservingPredicate);
+
+    [binding stopObservingChanges];
+
+    XCTAssertNil(binding.activeClause);
+    XCTAssertFalse(binding.clauses[0].isObservingPredicate);
+}
+
 @end
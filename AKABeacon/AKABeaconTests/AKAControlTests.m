@@ -226,4 +226,41 @@
     XCTAssertThrows([control setOwner:owner], @"Expected exception for invalid attempt to change owner of a control which is already owned");
 }
 
+/**
+ * Measures the time needed to scan a view hierarchy of 2000 views (mostly without control views
+ * or binding expressions, as found in large static forms), with one excluded child controller view.
+ */
+- (void)testCompositeControl_insertControlsPerformance
+{
+    UIView* rootView = [[UIView alloc] initWithFrame:CGRectMake(0, 0, 320, 480)];
+    UIView* excludedView = [UIView new];
+    [rootView addSubview:excludedView];
+
+    NSUInteger viewCount = 2;
+    while (viewCount < 2000)
+    {
+        UIView* row = [UIView new];
+        [row addSubview:[UILabel new]];
+        [row addSubview:[UITextField new]];
+        [row addSubview:[UISwitch new]];
+        UIView* group = [UIView new];
+        [group addSubview:[UIImageView new]];
+        [group addSubview:[UIButton buttonWithType:UIButtonTypeSystem]];
+        [row addSubview:group];
+        [rootView addSubview:row];
+        viewCount += 7;
+    }
+    for (NSUInteger i = 0; i < 100; ++i)
+    {
+        [excludedView addSubview:[UILabel new]];
+    }
+
+    [self measureBlock:^{
+        AKACompositeControl* control = [[AKACompositeControl alloc] initWithConfiguration:nil];
+        NSUInteger count = [control addControlsForControlViewsInViewHierarchy:rootView
+                                                                 excludeViews:@[ excludedView ]];
+        XCTAssertEqual((NSUInteger)0, count);
+    }];
+}
+
 @end
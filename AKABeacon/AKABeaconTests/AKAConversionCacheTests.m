@@ -0,0 +1,141 @@
+//
+//  AKAConversionCacheTests.m
+//  AKABeacon
+//
+//  Created by Michael Utech on 19.10.16.
+//  Copyright © 2016 Michael Utech & AKA Sarl. All rights reserved.
+//
+
+@import Foundation;
+
+#import <XCTest/XCTest.h>
+
+#import "AKAConversionCache.h"
+#import "AKANumberTextConverter.h"
+
+@interface AKAConversionCacheTests : XCTestCase
+
+@end
+
+@implementation AKAConversionCacheTests
+
+- (void)testLookupMatchesValueAndContext
+{
+    AKAConversionCache* cache = [[AKAConversionCache alloc] initWithCapacity:4];
+    NSNumberFormatter* formatter = [NSNumberFormatter new];
+    NSNumberFormatter* otherFormatter = [NSNumberFormatter new];
+
+    [cache recordText:@"42" forValue:@(42) context:formatter];
+
+    id text = nil;
+    XCTAssertTrue([cache lookupText:&text forValue:@(42) context:formatter]);
+    XCTAssertEqualObjects(@"42", text);
+    XCTAssertFalse([cache lookupText:&text forValue:@(42) context:otherFormatter]);
+    XCTAssertFalse([cache lookupText:&text forValue:@(YES) context:formatter]);
+    XCTAssertFalse([cache lookupText:&text forValue:@(43) context:formatter]);
+
+    // Booleans are equal to 0 and 1, but are converted differently
+    [cache recordText:@"1" forValue:@(1) context:formatter];
+    XCTAssertFalse([cache lookupText:&text forValue:@(YES) context:formatter]);
+    [cache recordText:@"YES" forValue:@(YES) context:formatter];
+    XCTAssertTrue([cache lookupText:&text forValue:(__bridge NSNumber*)kCFBooleanTrue context:formatter]);
+    XCTAssertEqualObjects(@"YES", text);
+    XCTAssertTrue([cache lookupText:&text forValue:@(1) context:formatter]);
+    XCTAssertEqualObjects(@"1", text);
+}
+
+- (void)testLookupMatchesEqualValuesOfDifferentClasses
+{
+    AKAConversionCache* cache = [AKAConversionCache new];
+
+    // Constant, tagged pointer or heap allocated strings and numbers are represented by different classes
+    NSString* text = [NSString stringWithFormat:@"%d", 42];
+    NSString* otherText = [[NSMutableString stringWithString:@"42"] copy];
+    [cache recordValue:@(42) forText:@"42" context:nil];
+
+    id value = nil;
+    XCTAssertTrue([cache lookupValue:&value forText:text context:nil]);
+    XCTAssertEqualObjects(@(42), value);
+    XCTAssertTrue([cache lookupValue:&value forText:otherText context:nil]);
+
+    [cache recordText:@"42" forValue:@(42) context:nil];
+    XCTAssertTrue([cache lookupText:nil forValue:[NSNumber numberWithDouble:42.0] context:nil]);
+    XCTAssertTrue([cache lookupText:nil forValue:[NSDecimalNumber decimalNumberWithString:@"42"] context:nil]);
+
+    NSDate* date = [NSDate dateWithTimeIntervalSinceReferenceDate:0];
+    [cache recordText:@"2001" forValue:date context:nil];
+    XCTAssertTrue([cache lookupText:nil forValue:[date copy] context:nil]);
+
+    // Values of different class families do not match
+    XCTAssertFalse([cache lookupValue:nil forText:(id)@(42) context:nil]);
+}
+
+- (void)testLeastRecentlyUsedEntriesAreEvicted
+{
+    AKAConversionCache* cache = [[AKAConversionCache alloc] initWithCapacity:2];
+
+    [cache recordText:@"1" forValue:@(1) context:nil];
+    [cache recordText:@"2" forValue:@(2) context:nil];
+    XCTAssertTrue([cache lookupText:nil forValue:@(1) context:nil]);
+    [cache recordText:@"3" forValue:@(3) context:nil];
+
+    XCTAssertTrue([cache lookupText:nil forValue:@(1) context:nil]);
+    XCTAssertFalse([cache lookupText:nil forValue:@(2) context:nil]);
+    XCTAssertTrue([cache lookupText:nil forValue:@(3) context:nil]);
+}
+
+- (void)testInvalidation
+{
+    AKAConversionCache* cache = [AKAConversionCache new];
+
+    [cache recordValue:@(1.5) forText:@"1.5" context:nil];
+    XCTAssertTrue([cache lookupValue:nil forText:@"1.5" context:nil]);
+
+    [cache invalidate];
+    XCTAssertEqual(1, cache.generation);
+    XCTAssertFalse([cache lookupValue:nil forText:@"1.5" context:nil]);
+}
+
+- (void)testMutableStringsAreNotShared
+{
+    AKAConversionCache* cache = [AKAConversionCache new];
+    NSMutableString* text = [NSMutableString stringWithString:@"12"];
+
+    [cache recordValue:@(12) forText:text context:nil];
+    [text appendString:@"3"];
+
+    XCTAssertTrue([cache lookupValue:nil forText:@"12" context:nil]);
+    XCTAssertFalse([cache lookupValue:nil forText:@"123" context:nil]);
+}
+
+- (void)testNumberTextConverterRoundTrip
+{
+    AKANumberTextConverter* converter = [AKANumberTextConverter new];
+
+    for (int i = 0; i < 2; ++i)
+    {
+        id text = nil;
+        XCTAssertTrue([converter convertModelValue:@(1234.5) toViewValue:&text error:nil]);
+        id value = nil;
+        XCTAssertTrue([converter convertViewValue:text toModelValue:&value error:nil]);
+        XCTAssertEqualObjects(@(1234.5), value);
+    }
+}
+
+#pragma mark - Performance
+
+- (void)testNumberTextConverterPerformance
+{
+    AKANumberTextConverter* converter = [AKANumberTextConverter new];
+    NSArray* values = @[ @(1.25), @(42), @(-7.5), @(1000000) ];
+
+    [self measureBlock:^{
+        for (int i = 0; i < 10000; ++i)
+        {
+            id text = nil;
+            [converter convertModelValue:values[i % values.count] toViewValue:&text error:nil];
+        }
+    }];
+}
+
+@end
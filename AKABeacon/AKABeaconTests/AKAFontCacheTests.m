@@ -0,0 +1,89 @@
+//
+//  AKAFontCacheTests.m
+//  AKABeacon
+//
+//  Created by Michael Utech on 19.10.16.
+//  Copyright © 2016 Michael Utech & AKA Sarl. All rights reserved.
+//
+
+@import UIKit;
+
+#import <XCTest/XCTest.h>
+
+#import "AKAFontCache.h"
+
+@interface AKAFontCacheTests : XCTestCase
+
+@end
+
+@implementation AKAFontCacheTests
+
+- (void)setUp
+{
+    [super setUp];
+
+    [[AKAFontCache sharedCache] updateForContentSizeCategory:UIContentSizeCategoryLarge];
+}
+
+- (void)tearDown
+{
+    [[AKAFontCache sharedCache] removeAllFonts];
+
+    [super tearDown];
+}
+
+- (void)testFontsAreResolvedOncePerKey
+{
+    AKAFontCache* cache = [AKAFontCache sharedCache];
+    UIFontDescriptor* base = [UIFontDescriptor fontDescriptorWithName:@"Helvetica" size:12.0];
+    __block NSUInteger resolved = 0;
+    UIFont*(^resolver)(void) = ^UIFont*
+    {
+        ++resolved;
+        return [UIFont fontWithDescriptor:base size:0.0];
+    };
+
+    UIFont* font = [cache fontForBase:base customization:@"" resolver:resolver];
+    XCTAssertNotNil(font);
+    XCTAssertEqual(font, [cache fontForBase:[base copy] customization:@"" resolver:resolver]);
+    XCTAssertEqual((NSUInteger)1, resolved);
+
+    [cache fontForBase:base customization:@"size=14;" resolver:resolver];
+    XCTAssertEqual((NSUInteger)2, resolved);
+}
+
+- (void)testNilFontsAreCached
+{
+    AKAFontCache* cache = [AKAFontCache sharedCache];
+    __block NSUInteger resolved = 0;
+    UIFont*(^resolver)(void) = ^UIFont*
+    {
+        ++resolved;
+        return nil;
+    };
+
+    XCTAssertNil([cache fontForBase:nil customization:@"" resolver:resolver]);
+    XCTAssertNil([cache fontForBase:nil customization:@"" resolver:resolver]);
+    XCTAssertEqual((NSUInteger)1, resolved);
+}
+
+- (void)testContentSizeCategoryChangeInvalidatesCache
+{
+    AKAFontCache* cache = [AKAFontCache sharedCache];
+    UIFont*(^resolver)(void) = ^UIFont*
+    {
+        return [UIFont systemFontOfSize:12.0];
+    };
+
+    [cache fontForBase:nil customization:@"" resolver:resolver];
+    XCTAssertEqual((NSUInteger)1, cache.count);
+
+    [cache updateForContentSizeCategory:UIContentSizeCategoryLarge];
+    XCTAssertEqual((NSUInteger)1, cache.count);
+
+    [cache updateForContentSizeCategory:UIContentSizeCategoryExtraLarge];
+    XCTAssertEqual((NSUInteger)0, cache.count);
+    XCTAssertEqualObjects(UIContentSizeCategoryExtraLarge, cache.contentSizeCategory);
+}
+
+@end
@@ -0,0 +1,134 @@
+//
+//  AKAFormatterPoolTests.m
+//  AKABeacon
+//
+//  Created by Michael Utech on 19.10.16.
+//  Copyright © 2016 Michael Utech & AKA Sarl. All rights reserved.
+//
+
+@import UIKit;
+
+#import <XCTest/XCTest.h>
+
+#import "AKAFormatterPool.h"
+
+@interface AKAFormatterPoolTests : XCTestCase
+
+@property(nonatomic) AKAFormatterPool* pool;
+@property(nonatomic) NSUInteger factoryCalls;
+
+@end
+
+@implementation AKAFormatterPoolTests
+
+- (void)setUp
+{
+    [super setUp];
+    self.pool = [AKAFormatterPool new];
+    self.factoryCalls = 0;
+}
+
+- (NSFormatter*)formatterWithAttributes:(NSDictionary*)attributes
+{
+    return [self.pool formatterOfType:[NSNumberFormatter class]
+                       withAttributes:attributes
+                              factory:^NSFormatter*(NSError* __autoreleasing* error) {
+                                  (void)error;
+                                  self.factoryCalls += 1;
+                                  return [NSNumberFormatter new];
+                              }
+                                error:nil];
+}
+
+- (void)testHitsAndMisses
+{
+    NSFormatter* first = [self formatterWithAttributes:@{ @"maximumFractionDigits": @2 }];
+    NSFormatter* second = [self formatterWithAttributes:@{ @"maximumFractionDigits": @2 }];
+    NSFormatter* other = [self formatterWithAttributes:@{ @"maximumFractionDigits": @3 }];
+
+    XCTAssertEqual(first, second);
+    XCTAssertNotEqual(first, other);
+    XCTAssertEqual((NSUInteger)2, self.factoryCalls);
+    XCTAssertEqual((NSUInteger)2, self.pool.count);
+    XCTAssertEqual((NSUInteger)1, self.pool.hitCount);
+    XCTAssertEqual((NSUInteger)2, self.pool.missCount);
+    XCTAssertEqualWithAccuracy(1.0 / 3.0, self.pool.hitRate, 0.0001);
+
+    [self.pool resetStatistics];
+    XCTAssertEqual((NSUInteger)0, self.pool.hitCount);
+    XCTAssertEqual((NSUInteger)0, self.pool.missCount);
+}
+
+- (void)testEqualAttributeValuesAreShared
+{
+    // Distinct, but equal instances whose descriptions contain their addresses.
+    NSMutableParagraphStyle* style1 = [NSMutableParagraphStyle new];
+    style1.alignment = NSTextAlignmentCenter;
+    NSMutableParagraphStyle* style2 = [NSMutableParagraphStyle new];
+    style2.alignment = NSTextAlignmentCenter;
+    XCTAssertNotEqual(style1, style2);
+
+    NSFormatter* first = [self formatterWithAttributes:@{ @"font": [UIFont systemFontOfSize:12],
+                                                          @"color": [UIColor colorWithRed:1 green:0 blue:0 alpha:1],
+                                                          @"paragraphStyle": [style1 copy] }];
+    NSFormatter* second = [self formatterWithAttributes:@{ @"font": [UIFont systemFontOfSize:12],
+                                                           @"color": [UIColor colorWithRed:1 green:0 blue:0 alpha:1],
+                                                           @"paragraphStyle": [style2 copy] }];
+
+    XCTAssertEqual(first, second);
+    XCTAssertEqual((NSUInteger)1, self.factoryCalls);
+
+    NSFormatter* other = [self formatterWithAttributes:@{ @"font": [UIFont systemFontOfSize:14],
+                                                          @"color": [UIColor colorWithRed:1 green:0 blue:0 alpha:1],
+                                                          @"paragraphStyle": [style1 copy] }];
+    XCTAssertNotEqual(first, other);
+}
+
+- (void)testTypesAreNotShared
+{
+    NSFormatter* numberFormatter = [self formatterWithAttributes:@{}];
+    NSFormatter* dateFormatter = [self.pool formatterOfType:[NSDateFormatter class]
+                                             withAttributes:@{}
+                                                    factory:^NSFormatter*(NSError* __autoreleasing* error) {
+                                                        (void)error;
+                                                        return [NSDateFormatter new];
+                                                    }
+                                                      error:nil];
+
+    XCTAssertNotEqual(numberFormatter, dateFormatter);
+    XCTAssertEqual((NSUInteger)2, self.pool.count);
+}
+
+- (void)testCountLimitEvictsLeastRecentlyUsedFormatters
+{
+    self.pool.countLimit = 2;
+
+    NSFormatter* first = [self formatterWithAttributes:@{ @"index": @1 }];
+    [self formatterWithAttributes:@{ @"index": @2 }];
+
+    // Use the first formatter, so that the second is evicted next
+    XCTAssertEqual(first, [self formatterWithAttributes:@{ @"index": @1 }]);
+
+    [self formatterWithAttributes:@{ @"index": @3 }];
+    XCTAssertEqual((NSUInteger)2, self.pool.count);
+
+    self.factoryCalls = 0;
+    XCTAssertEqual(first, [self formatterWithAttributes:@{ @"index": @1 }]);
+    XCTAssertEqual((NSUInteger)0, self.factoryCalls);
+
+    [self formatterWithAttributes:@{ @"index": @2 }];
+    XCTAssertEqual((NSUInteger)1, self.factoryCalls);
+    XCTAssertEqual((NSUInteger)2, self.pool.count);
+}
+
+- (void)testMemoryWarningEmptiesPool
+{
+    [self formatterWithAttributes:@{ @"index": @1 }];
+    XCTAssertEqual((NSUInteger)1, self.pool.count);
+
+    [[NSNotificationCenter defaultCenter] postNotificationName:UIApplicationDidReceiveMemoryWarningNotification
+                                                        object:nil];
+    XCTAssertEqual((NSUInteger)0, self.pool.count);
+}
+
+@end
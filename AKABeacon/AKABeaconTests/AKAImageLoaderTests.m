@@ -0,0 +1,141 @@
+//
+//  AKAImageLoaderTests.m
+//  AKABeacon
+//
+//  Created by Michael Utech on 19.10.16.
+//  Copyright © 2016 Michael Utech & AKA Sarl. All rights reserved.
+//
+
+@import UIKit;
+
+#import <XCTest/XCTest.h>
+
+#import "AKAImageLoader.h"
+
+@interface AKAImageLoaderTests : XCTestCase
+
+@property(nonatomic) NSURL* imageURL;
+
+@end
+
+@implementation AKAImageLoaderTests
+
+- (void)setUp
+{
+    [super setUp];
+
+    UIGraphicsBeginImageContextWithOptions(CGSizeMake(400, 200), YES, 1.0);
+    [[UIColor redColor] setFill];
+    UIRectFill(CGRectMake(0, 0, 400, 200));
+    UIImage* image = UIGraphicsGetImageFromCurrentImageContext();
+    UIGraphicsEndImageContext();
+
+    self.imageURL = [NSURL fileURLWithPath:[NSTemporaryDirectory() stringByAppendingPathComponent:@"AKAImageLoaderTests.png"]];
+    [UIImagePNGRepresentation(image) writeToURL:self.imageURL atomically:YES];
+
+    [[AKAImageLoader sharedLoader] removeAllCachedImages];
+}
+
+- (void)tearDown
+{
+    [[AKAImageLoader sharedLoader] removeAllCachedImages];
+    [[NSFileManager defaultManager] removeItemAtURL:self.imageURL error:nil];
+
+    [super tearDown];
+}
+
+- (UIImage*)loadImageWithFillSize:(CGSize)fillSize
+                          maxSize:(CGSize)maxSize
+{
+    __block UIImage* result = nil;
+    XCTestExpectation* loadedExpectation = [self expectationWithDescription:@"Loaded"];
+
+    [[AKAImageLoader sharedLoader] loadImageForSource:self.imageURL
+                                             fillSize:fillSize
+                                              maxSize:maxSize
+                                                scale:2.0
+                                           completion:
+     ^(AKAImageLoadRequest * _Nonnull request __unused, UIImage * _Nullable image)
+     {
+         XCTAssertTrue([NSThread isMainThread]);
+         result = image;
+         [loadedExpectation fulfill];
+     }];
+    [self waitForExpectationsWithTimeout:5.0 handler:nil];
+
+    return result;
+}
+
+- (void)testDownsamplingAndCaching
+{
+    AKAImageLoader* loader = [AKAImageLoader sharedLoader];
+
+    // Covering 50x50 points at scale 2 requires 100x50 points (200x100 pixels)
+    UIImage* image = [self loadImageWithFillSize:CGSizeMake(50, 50) maxSize:CGSizeZero];
+    XCTAssertEqualWithAccuracy(100.0, image.size.width, 0.5);
+    XCTAssertEqualWithAccuracy(50.0, image.size.height, 0.5);
+    XCTAssertEqualWithAccuracy(2.0, image.scale, 0.01);
+
+    XCTAssertEqual(image, [loader cachedImageForSource:self.imageURL
+                                              fillSize:CGSizeMake(50, 50)
+                                               maxSize:CGSizeZero
+                                                 scale:2.0]);
+    XCTAssertNil([loader cachedImageForSource:self.imageURL
+                                     fillSize:CGSizeMake(60, 60)
+                                      maxSize:CGSizeZero
+                                        scale:2.0]);
+
+    // Images are not enlarged, the source provides only 400 pixels for 300 points
+    image = [self loadImageWithFillSize:CGSizeMake(1000, 1000) maxSize:CGSizeMake(300, 0)];
+    XCTAssertEqualWithAccuracy(300.0, image.size.width, 0.5);
+    XCTAssertEqualWithAccuracy(400.0 / 300.0, image.scale, 0.01);
+}
+
+- (void)testLeastRecentlyUsedImagesAreEvicted
+{
+    AKAImageLoader* loader = [AKAImageLoader sharedLoader];
+    NSUInteger costLimit = loader.cacheCostLimit;
+
+    UIImage* first = [self loadImageWithFillSize:CGSizeMake(10, 10) maxSize:CGSizeZero];
+    UIImage* second = [self loadImageWithFillSize:CGSizeMake(20, 20) maxSize:CGSizeZero];
+    XCTAssertNotNil(first);
+    XCTAssertNotNil(second);
+
+    // Access the first image, making the second one the least recently used
+    XCTAssertNotNil([loader cachedImageForSource:self.imageURL
+                                        fillSize:CGSizeMake(10, 10)
+                                         maxSize:CGSizeZero
+                                           scale:2.0]);
+
+    loader.cacheCostLimit = loader.cacheCost - 1;
+    XCTAssertNotNil([loader cachedImageForSource:self.imageURL
+                                        fillSize:CGSizeMake(10, 10)
+                                         maxSize:CGSizeZero
+                                           scale:2.0]);
+    XCTAssertNil([loader cachedImageForSource:self.imageURL
+                                     fillSize:CGSizeMake(20, 20)
+                                      maxSize:CGSizeZero
+                                        scale:2.0]);
+
+    loader.cacheCostLimit = costLimit;
+}
+
+- (void)testCancelledRequestsDoNotComplete
+{
+    AKAImageLoadRequest* request =
+        [[AKAImageLoader sharedLoader] loadImageForSource:self.imageURL
+                                                 fillSize:CGSizeZero
+                                                  maxSize:CGSizeZero
+                                                    scale:2.0
+                                               completion:
+         ^(AKAImageLoadRequest * _Nonnull loadedRequest __unused, UIImage * _Nullable image __unused)
+         {
+             XCTFail(@"Cancelled request completed");
+         }];
+    [request cancel];
+    XCTAssertTrue(request.isCancelled);
+
+    [[NSRunLoop mainRunLoop] runUntilDate:[NSDate dateWithTimeIntervalSinceNow:0.2]];
+}
+
+@end
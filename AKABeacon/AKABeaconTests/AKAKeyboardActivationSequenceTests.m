@@ -0,0 +1,301 @@
+//
+//  AKAKeyboardActivationSequenceTests.m
+//  AKABeacon
+//
+//  Created by Michael Utech on 19.10.16.
+//  Copyright © 2016 Michael Utech & AKA Sarl. All rights reserved.
+//
+
+@import UIKit;
+
+#import <XCTest/XCTest.h>
+
+#import "AKAKeyboardActivationSequence.h"
+#import "AKAKeyboardActivationSequenceItemProtocol_Internal.h"
+#import "AKABindingController+KeyboardActivationSequence.h"
+
+
+#pragma mark - AKAKeyboardActivationSequenceTestItem
+#pragma mark -
+
+@interface AKAKeyboardActivationSequenceTestItem: NSObject<AKAKeyboardActivationSequenceItemProtocol_Internal>
+
+- (instancetype)initWithPosition:(NSInteger)position
+                       responder:(UIResponder*)responder
+                      identifier:(NSString*)identifier;
+
+@property(nonatomic) NSInteger position;
+@property(nonatomic, readonly) UIResponder* responder;
+@property(nonatomic, weak) AKAKeyboardActivationSequence* keyboardActivationSequence;
+
+@end
+
+@implementation AKAKeyboardActivationSequenceTestItem
+
+@synthesize keyboardActivationSequenceID = _keyboardActivationSequenceID;
+
+- (instancetype)initWithPosition:(NSInteger)position
+                       responder:(UIResponder*)responder
+                      identifier:(NSString*)identifier
+{
+    if (self = [super init])
+    {
+        _position = position;
+        _responder = responder;
+        _keyboardActivationSequenceID = identifier;
+    }
+    return self;
+}
+
+- (BOOL)shouldParticipateInKeyboardActivationSequence
+{
+    return YES;
+}
+
+- (BOOL)participatesInKeyboardActivationSequence
+{
+    return self.keyboardActivationSequence != nil;
+}
+
+- (UIResponder*)responderForKeyboardActivationSequence
+{
+    return self.responder;
+}
+
+- (BOOL)isResponderActive
+{
+    return self.responder.isFirstResponder;
+}
+
+- (BOOL)activateResponder
+{
+    return [self.responder becomeFirstResponder];
+}
+
+- (BOOL)deactivateResponder
+{
+    return [self.responder resignFirstResponder];
+}
+
+- (BOOL)installInputAccessoryView:(UIView*)inputAccessoryView
+{
+    (void)inputAccessoryView;
+    return YES;
+}
+
+- (BOOL)restoreInputAccessoryView
+{
+    return YES;
+}
+
+@end
+
+
+#pragma mark - AKAKeyboardActivationSequenceTests
+#pragma mark -
+
+@interface AKAKeyboardActivationSequenceTests : XCTestCase<AKAKeyboardActivationSequenceDelegate>
+
+/**
+ The items enumerated when the sequence is (re)built, ordered by position.
+ */
+@property(nonatomic) NSMutableArray<AKAKeyboardActivationSequenceTestItem*>* items;
+@property(nonatomic) NSUInteger enumerationCount;
+@property(nonatomic) AKAKeyboardActivationSequence* sequence;
+
+@end
+
+@implementation AKAKeyboardActivationSequenceTests
+
+- (void)setUp
+{
+    [super setUp];
+
+    self.items = [NSMutableArray new];
+    for (NSInteger position = 10; position <= 30; position += 10)
+    {
+        [self.items addObject:[self itemAtPosition:position]];
+    }
+    self.enumerationCount = 0;
+    self.sequence = [[AKAKeyboardActivationSequence alloc] initWithDelegate:self
+                                                                 identifier:@"test"];
+}
+
+- (AKAKeyboardActivationSequenceTestItem*)itemAtPosition:(NSInteger)position
+{
+    return [[AKAKeyboardActivationSequenceTestItem alloc] initWithPosition:position
+                                                                 responder:[UITextField new]
+                                                                identifier:@"test"];
+}
+
+#pragma mark - AKAKeyboardActivationSequenceDelegate
+
+- (void)enumerateItemsInKeyboardActivationSequenceUsingBlock:(void (^)(req_AKAKeyboardActivationSequenceItem, NSUInteger, outreq_BOOL))block
+{
+    ++self.enumerationCount;
+    [self.items enumerateObjectsUsingBlock:^(AKAKeyboardActivationSequenceTestItem* item, NSUInteger idx, BOOL* stop) {
+        block(item, idx, stop);
+    }];
+}
+
+- (NSComparisonResult)keyboardActivationSequence:(AKAKeyboardActivationSequence*)keyboardActivationSequence
+                                     compareItem:(AKAKeyboardActivationSequenceTestItem*)item
+                                          toItem:(AKAKeyboardActivationSequenceTestItem*)otherItem
+{
+    (void)keyboardActivationSequence;
+    return (item.position < otherItem.position ? NSOrderedAscending
+            : item.position > otherItem.position ? NSOrderedDescending : NSOrderedSame);
+}
+
+#pragma mark - Tests
+
+- (void)testInsertItemKeepsOrderWithoutRebuilding
+{
+    XCTAssertEqual((NSUInteger)3, self.sequence.countOfItems);
+    XCTAssertEqual((NSUInteger)1, self.enumerationCount);
+
+    AKAKeyboardActivationSequenceTestItem* first = [self itemAtPosition:5];
+    AKAKeyboardActivationSequenceTestItem* middle = [self itemAtPosition:15];
+    AKAKeyboardActivationSequenceTestItem* last = [self itemAtPosition:35];
+
+    XCTAssertTrue([self.sequence insertItem:middle]);
+    XCTAssertTrue([self.sequence insertItem:last]);
+    XCTAssertTrue([self.sequence insertItem:first]);
+    XCTAssertFalse([self.sequence insertItem:middle]);
+
+    XCTAssertEqual((NSUInteger)6, self.sequence.countOfItems);
+    XCTAssertEqual((NSUInteger)1, self.enumerationCount);
+    XCTAssertEqual((NSUInteger)0, [self.sequence indexOfItem:first]);
+    XCTAssertEqual((NSUInteger)2, [self.sequence indexOfItem:middle]);
+    XCTAssertEqual((NSUInteger)5, [self.sequence indexOfItem:last]);
+    XCTAssertEqual(self.items[0], [self.sequence itemAtIndex:1]);
+    XCTAssertEqual(self.items[1], [self.sequence itemAtIndex:3]);
+    XCTAssertEqual(self.sequence, middle.keyboardActivationSequence);
+}
+
+- (void)testInsertedItemsAreOrderedWhenAccessed
+{
+    XCTAssertEqual((NSUInteger)3, self.sequence.countOfItems);
+
+    // Positions of items are typically not known when they are inserted (before layout)
+    AKAKeyboardActivationSequenceTestItem* item = [self itemAtPosition:0];
+    AKAKeyboardActivationSequenceTestItem* other = [self itemAtPosition:0];
+    XCTAssertTrue([self.sequence insertItem:item]);
+    XCTAssertTrue([self.sequence insertItem:other]);
+    XCTAssertEqual(self.sequence, item.keyboardActivationSequence);
+    item.position = 25;
+    other.position = 15;
+
+    XCTAssertEqual((NSUInteger)5, self.sequence.countOfItems);
+    XCTAssertEqual((NSUInteger)1, [self.sequence indexOfItem:other]);
+    XCTAssertEqual((NSUInteger)3, [self.sequence indexOfItem:item]);
+    XCTAssertEqual((NSUInteger)1, self.enumerationCount);
+
+    // Removing a pending item
+    AKAKeyboardActivationSequenceTestItem* removed = [self itemAtPosition:5];
+    XCTAssertTrue([self.sequence insertItem:removed]);
+    XCTAssertTrue([self.sequence removeItem:removed]);
+    XCTAssertNil(removed.keyboardActivationSequence);
+    XCTAssertEqual((NSUInteger)5, self.sequence.countOfItems);
+}
+
+- (void)testInsertItemDefersToPendingUpdates
+{
+    AKAKeyboardActivationSequenceTestItem* item = [self itemAtPosition:15];
+    [self.items insertObject:item atIndex:1];
+
+    // The sequence has not yet been built, the update will include the item
+    XCTAssertFalse([self.sequence insertItem:item]);
+    XCTAssertEqual((NSUInteger)0, self.enumerationCount);
+    XCTAssertEqual((NSUInteger)1, [self.sequence indexOfItem:item]);
+    XCTAssertEqual((NSUInteger)1, self.enumerationCount);
+
+    AKAKeyboardActivationSequenceTestItem* other = [self itemAtPosition:25];
+    [self.items insertObject:other atIndex:3];
+    [self.sequence setNeedsUpdate];
+    XCTAssertFalse([self.sequence insertItem:other]);
+    XCTAssertEqual((NSUInteger)3, [self.sequence indexOfItem:other]);
+    XCTAssertEqual((NSUInteger)2, self.enumerationCount);
+}
+
+- (void)testInsertItemRejectsForeignItems
+{
+    XCTAssertEqual((NSUInteger)3, self.sequence.countOfItems);
+
+    AKAKeyboardActivationSequenceTestItem* foreign =
+        [[AKAKeyboardActivationSequenceTestItem alloc] initWithPosition:15
+                                                              responder:[UITextField new]
+                                                             identifier:@"other"];
+    AKAKeyboardActivationSequenceTestItem* noResponder =
+        [[AKAKeyboardActivationSequenceTestItem alloc] initWithPosition:15
+                                                              responder:nil
+                                                             identifier:@"test"];
+
+    XCTAssertFalse([self.sequence insertItem:foreign]);
+    XCTAssertFalse([self.sequence insertItem:noResponder]);
+    XCTAssertEqual((NSUInteger)3, self.sequence.countOfItems);
+}
+
+- (void)testRemoveItem
+{
+    AKAKeyboardActivationSequenceTestItem* item = self.items[1];
+    XCTAssertEqual((NSUInteger)1, [self.sequence indexOfItem:item]);
+    XCTAssertEqual(self.sequence, item.keyboardActivationSequence);
+
+    XCTAssertTrue([self.sequence removeItem:item]);
+    XCTAssertFalse([self.sequence removeItem:item]);
+
+    XCTAssertEqual((NSUInteger)2, self.sequence.countOfItems);
+    XCTAssertEqual((NSUInteger)NSNotFound, [self.sequence indexOfItem:item]);
+    XCTAssertEqual(self.items[2], [self.sequence itemAtIndex:1]);
+    XCTAssertNil(item.keyboardActivationSequence);
+    XCTAssertEqual((NSUInteger)1, self.enumerationCount);
+}
+
+- (void)testBindingControllerOrdersItemsTotally
+{
+    UIViewController* viewController = [UIViewController new];
+    AKABindingController* controller = [AKABindingController bindingControllerForViewController:viewController
+                                                                                withDataContext:nil
+                                                                                       delegate:nil
+                                                                                          error:nil];
+    UIView* view = viewController.view;
+    UITextField* textField = [[UITextField alloc] initWithFrame:CGRectMake(0, 10, 100, 20)];
+    UITextField* otherTextField = [[UITextField alloc] initWithFrame:CGRectMake(0, 10, 100, 20)];
+    [view addSubview:textField];
+    [view addSubview:otherTextField];
+
+    // Two items without views and two items at the same position
+    NSArray* items = @[ [[AKAKeyboardActivationSequenceTestItem alloc] initWithPosition:0 responder:[UIResponder new] identifier:@"test"],
+                        [[AKAKeyboardActivationSequenceTestItem alloc] initWithPosition:0 responder:[UIResponder new] identifier:@"test"],
+                        [[AKAKeyboardActivationSequenceTestItem alloc] initWithPosition:0 responder:textField identifier:@"test"],
+                        [[AKAKeyboardActivationSequenceTestItem alloc] initWithPosition:0 responder:otherTextField identifier:@"test"] ];
+
+    for (id item in items)
+    {
+        XCTAssertEqual(NSOrderedSame, [controller keyboardActivationSequence:self.sequence
+                                                                 compareItem:item
+                                                                      toItem:item]);
+        for (id otherItem in items)
+        {
+            if (item != otherItem)
+            {
+                NSComparisonResult order = [controller keyboardActivationSequence:self.sequence
+                                                                      compareItem:item
+                                                                           toItem:otherItem];
+                NSComparisonResult reverseOrder = [controller keyboardActivationSequence:self.sequence
+                                                                             compareItem:otherItem
+                                                                                  toItem:item];
+                XCTAssertNotEqual(NSOrderedSame, order);
+                XCTAssertEqual((NSComparisonResult)-order, reverseOrder);
+            }
+        }
+    }
+
+    // Items without views precede items with views
+    XCTAssertEqual(NSOrderedAscending, [controller keyboardActivationSequence:self.sequence
+                                                                  compareItem:items[1]
+                                                                       toItem:items[2]]);
+}
+
+@end
@@ -0,0 +1,326 @@
+//
+//  AKAKeyboardControlViewBindingTests.m
+//  AKABeacon
+//
+//  Created by Michael Utech on 19.10.16.
+//  Copyright © 2016 Michael Utech & AKA Sarl. All rights reserved.
+//
+
+@import UIKit;
+
+#import <XCTest/XCTest.h>
+
+#import "AKABindingTestBase.h"
+#import "AKABindingExpression.h"
+#import "AKABindingAttributeTable.h"
+#import "AKABinding_UITextField_textBinding.h"
+#import "AKABinding_UITextView_textBinding.h"
+#import "AKABinding_UISearchBar_textBinding.h"
+
+
+#pragma mark - Test Bindings
+#pragma mark -
+
+// The responders of these bindings are never first responders in unit tests, the bindings let tests
+// decide whether they are active and count changes propagated to the binding source.
+
+@interface AKAKeyboardControlViewBindingTestsTextFieldBinding: AKABinding_UITextField_textBinding
+
+@property(nonatomic) BOOL           responderActive;
+@property(nonatomic) NSUInteger     propagationCount;
+
+@end
+
+@implementation AKAKeyboardControlViewBindingTestsTextFieldBinding
+
+- (BOOL)isResponderActive
+{
+    return self.responderActive;
+}
+
+- (void)targetValueDidChangeFromOldValue:(id)oldTargetValue
+                              toNewValue:(id)newTargetValue
+{
+    ++self.propagationCount;
+    [super targetValueDidChangeFromOldValue:oldTargetValue toNewValue:newTargetValue];
+}
+
+@end
+
+
+@interface AKAKeyboardControlViewBindingTestsTextViewBinding: AKABinding_UITextView_textBinding
+
+@property(nonatomic) BOOL           responderActive;
+@property(nonatomic) NSUInteger     propagationCount;
+
+@end
+
+@implementation AKAKeyboardControlViewBindingTestsTextViewBinding
+
+- (BOOL)isResponderActive
+{
+    return self.responderActive;
+}
+
+- (void)targetValueDidChangeFromOldValue:(id)oldTargetValue
+                              toNewValue:(id)newTargetValue
+{
+    ++self.propagationCount;
+    [super targetValueDidChangeFromOldValue:oldTargetValue toNewValue:newTargetValue];
+}
+
+@end
+
+
+#pragma mark - AKAKeyboardControlViewBindingTests
+#pragma mark -
+
+@interface AKAKeyboardControlViewBindingTests : AKABindingTestBase
+
+@property(nonatomic) UITextField*   textField;
+@property(nonatomic) UITextView*    textView;
+
+@end
+
+@implementation AKAKeyboardControlViewBindingTests
+
+- (void)setUp
+{
+    [super setUp];
+
+    self.dataContext[@"text"] = @"initial";
+    self.textField = [UITextField new];
+    self.textView = [UITextView new];
+}
+
+- (AKAKeyboardControlViewBinding*)bindingOfType:(Class)bindingType
+                                       toTarget:(id)target
+                                 expressionText:(NSString*)expressionText
+{
+    NSError* error = nil;
+    AKABindingExpression* expression = [AKABindingExpression bindingExpressionWithString:expressionText
+                                                                             bindingType:bindingType
+                                                                                   error:&error];
+    XCTAssertNotNil(expression, @"%@", error.localizedDescription);
+
+    AKAKeyboardControlViewBinding* result = (AKAKeyboardControlViewBinding*)
+        [bindingType bindingToTarget:target
+                      withExpression:(req_AKABindingExpression)expression
+                             context:self
+                               owner:nil
+                            delegate:nil
+                               error:&error];
+    XCTAssertNotNil(result, @"%@", error.localizedDescription);
+    XCTAssertTrue([result isKindOfClass:bindingType]);
+
+    return result;
+}
+
+- (AKAKeyboardControlViewBindingTestsTextFieldBinding*)textFieldBindingWithExpressionText:(NSString*)expressionText
+{
+    AKAKeyboardControlViewBindingTestsTextFieldBinding* result =
+        (id)[self bindingOfType:[AKAKeyboardControlViewBindingTestsTextFieldBinding class]
+                       toTarget:self.textField
+                 expressionText:expressionText];
+    [result startObservingChanges];
+    XCTAssertEqualObjects(@"initial", self.textField.text);
+    result.responderActive = YES;
+
+    return result;
+}
+
+- (AKAKeyboardControlViewBindingTestsTextViewBinding*)textViewBindingWithExpressionText:(NSString*)expressionText
+{
+    AKAKeyboardControlViewBindingTestsTextViewBinding* result =
+        (id)[self bindingOfType:[AKAKeyboardControlViewBindingTestsTextViewBinding class]
+                       toTarget:self.textView
+                 expressionText:expressionText];
+    [result startObservingChanges];
+    XCTAssertEqualObjects(@"initial", self.textView.text);
+    result.responderActive = YES;
+
+    return result;
+}
+
+- (void)editTextField:(NSString*)text
+{
+    self.textField.text = text;
+    [self.textField sendActionsForControlEvents:UIControlEventEditingChanged];
+}
+
+- (void)editTextView:(NSString*)text
+{
+    self.textView.text = text;
+    [self.textView.delegate textViewDidChange:self.textView];
+}
+
+- (void)waitForInterval:(NSTimeInterval)interval
+{
+    [[NSRunLoop currentRunLoop] runUntilDate:[NSDate dateWithTimeIntervalSinceNow:interval]];
+}
+
+- (NSArray<Class>*)textBindingTypes
+{
+    return @[ [AKABinding_UITextField_textBinding class],
+              [AKABinding_UITextView_textBinding class],
+              [AKABinding_UISearchBar_textBinding class] ];
+}
+
+- (void)testDebounceAndThrottleAttributes
+{
+    for (Class bindingType in [self textBindingTypes])
+    {
+        NSError* error = nil;
+        AKABindingExpression* expression =
+            [AKABindingExpression bindingExpressionWithString:@"text { debounce: 0.3, throttle: 1 }"
+                                                  bindingType:bindingType
+                                                        error:&error];
+        XCTAssertNotNil(expression, @"%@", error.localizedDescription);
+
+        AKABindingAttributeTable* table = [AKABindingAttributeTable tableForBindingType:bindingType];
+        XCTAssertEqualObjects(@"debounceInterval", [table entryForAttributeNamed:@"debounce"].bindingPropertyName);
+        XCTAssertEqualObjects(@"throttleInterval", [table entryForAttributeNamed:@"throttle"].bindingPropertyName);
+
+        AKAKeyboardControlViewBinding* binding = [bindingType new];
+        [table assignValue:@0.3 toBindingProperty:@"debounceInterval" ofBinding:binding];
+        [table assignValue:@1 toBindingProperty:@"throttleInterval" ofBinding:binding];
+        XCTAssertEqualWithAccuracy(0.3, binding.debounceInterval, 0.0001);
+        XCTAssertEqualWithAccuracy(1.0, binding.throttleInterval, 0.0001);
+    }
+}
+
+- (void)testBindingInitializationAppliesAttributes
+{
+    NSArray* targets = @[ [UITextField new], [UITextView new], [UISearchBar new] ];
+    NSArray<Class>* bindingTypes = [self textBindingTypes];
+
+    for (NSUInteger i = 0; i < bindingTypes.count; ++i)
+    {
+        AKAKeyboardControlViewBinding* binding = [self bindingOfType:bindingTypes[i]
+                                                            toTarget:targets[i]
+                                                      expressionText:@"text { debounce: 0.3, throttle: 1 }"];
+        XCTAssertEqualWithAccuracy(0.3, binding.debounceInterval, 0.0001);
+        XCTAssertEqualWithAccuracy(1.0, binding.throttleInterval, 0.0001);
+
+        binding = [self bindingOfType:bindingTypes[i]
+                             toTarget:targets[i]
+                       expressionText:@"text"];
+        XCTAssertEqual(0.0, binding.debounceInterval);
+        XCTAssertEqual(0.0, binding.throttleInterval);
+    }
+}
+
+- (void)testDebounceCoalescesBurstOfChanges
+{
+    AKAKeyboardControlViewBindingTestsTextFieldBinding* binding =
+        [self textFieldBindingWithExpressionText:@"text { debounce: 0.05 }"];
+
+    for (NSString* text in @[ @"a", @"ab", @"abc" ])
+    {
+        [self editTextField:text];
+    }
+    XCTAssertTrue(binding.hasDeferredViewValueChange);
+    XCTAssertEqual((NSUInteger)0, binding.propagationCount);
+    XCTAssertEqualObjects(@"initial", self.dataContext[@"text"]);
+
+    [self waitForInterval:.3];
+
+    XCTAssertFalse(binding.hasDeferredViewValueChange);
+    XCTAssertEqual((NSUInteger)1, binding.propagationCount);
+    XCTAssertEqualObjects(@"abc", self.dataContext[@"text"]);
+
+    [binding stopObservingChanges];
+}
+
+- (void)testThrottleLimitsRateOfPropagations
+{
+    AKAKeyboardControlViewBindingTestsTextFieldBinding* binding =
+        [self textFieldBindingWithExpressionText:@"text { throttle: 0.1 }"];
+
+    // The first change is propagated immediately, later changes within the interval are coalesced
+    for (NSString* text in @[ @"a", @"ab", @"abc", @"abcd" ])
+    {
+        [self editTextField:text];
+    }
+    XCTAssertEqual((NSUInteger)1, binding.propagationCount);
+    XCTAssertEqualObjects(@"a", self.dataContext[@"text"]);
+    XCTAssertTrue(binding.hasDeferredViewValueChange);
+
+    [self waitForInterval:.3];
+
+    XCTAssertEqual((NSUInteger)2, binding.propagationCount);
+    XCTAssertEqualObjects(@"abcd", self.dataContext[@"text"]);
+    XCTAssertFalse(binding.hasDeferredViewValueChange);
+
+    [binding stopObservingChanges];
+}
+
+- (void)testTextFieldDidEndEditingCommitsPendingChange
+{
+    AKAKeyboardControlViewBindingTestsTextFieldBinding* binding =
+        [self textFieldBindingWithExpressionText:@"text { debounce: 10 }"];
+
+    [self editTextField:@"changed"];
+    XCTAssertTrue(binding.hasDeferredViewValueChange);
+    XCTAssertEqualObjects(@"initial", self.dataContext[@"text"]);
+
+    binding.responderActive = NO;
+    [self.textField.delegate textFieldDidEndEditing:self.textField];
+
+    XCTAssertFalse(binding.hasDeferredViewValueChange);
+    XCTAssertEqual((NSUInteger)1, binding.propagationCount);
+    XCTAssertEqualObjects(@"changed", self.dataContext[@"text"]);
+
+    [binding stopObservingChanges];
+}
+
+- (void)testTextViewDidEndEditingCommitsPendingChange
+{
+    AKAKeyboardControlViewBindingTestsTextViewBinding* binding =
+        [self textViewBindingWithExpressionText:@"text { debounce: 10 }"];
+
+    [self editTextView:@"changed"];
+    XCTAssertTrue(binding.hasDeferredViewValueChange);
+    XCTAssertEqualObjects(@"initial", self.dataContext[@"text"]);
+
+    binding.responderActive = NO;
+    [self.textView.delegate textViewDidEndEditing:self.textView];
+
+    XCTAssertFalse(binding.hasDeferredViewValueChange);
+    XCTAssertEqual((NSUInteger)1, binding.propagationCount);
+    XCTAssertEqualObjects(@"changed", self.dataContext[@"text"]);
+
+    [binding stopObservingChanges];
+}
+
+- (void)testStopObservingChangesCommitsPendingChange
+{
+    AKAKeyboardControlViewBindingTestsTextFieldBinding* binding =
+        [self textFieldBindingWithExpressionText:@"text { debounce: 10 }"];
+
+    [self editTextField:@"changed"];
+    XCTAssertTrue(binding.hasDeferredViewValueChange);
+
+    [binding stopObservingChanges];
+
+    XCTAssertFalse(binding.hasDeferredViewValueChange);
+    XCTAssertEqual((NSUInteger)1, binding.propagationCount);
+    XCTAssertEqualObjects(@"changed", self.dataContext[@"text"]);
+}
+
+- (void)testChangesOfInactiveRespondersAreNotDeferred
+{
+    for (Class bindingType in [self textBindingTypes])
+    {
+        AKAKeyboardControlViewBinding* binding = [bindingType new];
+        binding.debounceInterval = 0.3;
+        binding.throttleInterval = 1.0;
+
+        // Without an active responder (f.e. after editing ended), changes are committed immediately
+        XCTAssertFalse(binding.isResponderActive);
+        XCTAssertFalse([binding deferViewValueChange]);
+        XCTAssertFalse(binding.hasDeferredViewValueChange);
+    }
+}
+
+@end
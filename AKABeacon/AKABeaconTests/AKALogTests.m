@@ -0,0 +1,90 @@
+//
+//  AKALogTests.m
+//  AKABeacon
+//
+//  Created by Michael Utech on 19.10.16.
+//  Copyright © 2016 Michael Utech & AKA Sarl. All rights reserved.
+//
+
+@import Foundation;
+
+#import <XCTest/XCTest.h>
+
+#import "AKALog.h"
+
+@interface AKALogTests : XCTestCase
+
+@end
+
+@implementation AKALogTests
+
+- (void)setUp
+{
+    [super setUp];
+    [AKALog setLogFileURL:nil];
+}
+
+- (void)testErrorMessagesAreRecorded
+{
+    AKALogError(@"Test message %d", 42);
+
+    NSArray<NSString*>* messages = [AKALog recentMessages];
+    XCTAssertTrue([messages.lastObject containsString:@"Test message 42"]);
+    XCTAssertTrue([messages.lastObject containsString:@"ERROR"]);
+    XCTAssertTrue([[AKALog dump] containsString:@"Test message 42"]);
+}
+
+- (void)testMessagesAboveCategoryLevelAreCompiledOut
+{
+    __block BOOL evaluated = NO;
+    NSString* (^argument)(void) = ^NSString*{
+        evaluated = YES;
+        return @"argument";
+    };
+
+    AKALogC(Default, AKA_LOG_LEVEL_VERBOSE + 1, @"%@", argument());
+
+    XCTAssertFalse(evaluated);
+}
+
+- (void)testConcurrentLogging
+{
+    dispatch_apply(8, dispatch_get_global_queue(QOS_CLASS_DEFAULT, 0), ^(size_t thread) {
+        for (NSUInteger i = 0; i < 100; ++i)
+        {
+            AKALogError(@"thread %zu message %lu", thread, (unsigned long)i);
+        }
+    });
+    [AKALog flush];
+
+    NSArray<NSString*>* messages = [AKALog recentMessages];
+    XCTAssertGreaterThan(messages.count, (NSUInteger)0);
+}
+
+- (void)testLogFileIsRotated
+{
+    NSURL* logFileURL = [[NSURL fileURLWithPath:NSTemporaryDirectory()] URLByAppendingPathComponent:@"AKALogTests.log"];
+    NSURL* previousLogFileURL = [logFileURL URLByAppendingPathExtension:@"1"];
+    [[NSFileManager defaultManager] removeItemAtURL:logFileURL error:nil];
+    [[NSFileManager defaultManager] removeItemAtURL:previousLogFileURL error:nil];
+
+    unsigned long long maximumLogFileSize = [AKALog maximumLogFileSize];
+    [AKALog setMaximumLogFileSize:1024];
+    [AKALog setLogFileURL:logFileURL];
+
+    for (NSUInteger i = 0; i < 50; ++i)
+    {
+        AKALogError(@"rotated message %lu", (unsigned long)i);
+        [AKALog flush];
+    }
+
+    NSNumber* size = nil;
+    XCTAssertTrue([[NSFileManager defaultManager] fileExistsAtPath:(NSString*_Nonnull)previousLogFileURL.path]);
+    [logFileURL getResourceValue:&size forKey:NSURLFileSizeKey error:nil];
+    XCTAssertLessThan(size.unsignedLongLongValue, 1024ull);
+
+    [AKALog setLogFileURL:nil];
+    [AKALog setMaximumLogFileSize:maximumLogFileSize];
+}
+
+@end
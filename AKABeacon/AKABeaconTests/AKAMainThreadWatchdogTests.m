@@ -0,0 +1,172 @@
+//
+//  AKAMainThreadWatchdogTests.m
+//  AKABeacon
+//
+//  Created by Michael Utech on 19.10.16.
+//  Copyright © 2016 Michael Utech & AKA Sarl. All rights reserved.
+//
+
+@import UIKit;
+
+#import <XCTest/XCTest.h>
+
+#import "AKAMainThreadWatchdog.h"
+#import "AKABindingController.h"
+#import "AKABindingController+ChildBindingControllers.h"
+#import "AKATVMultiplexedDataSource.h"
+#import "UILabel+AKAIBBindingProperties_textBinding.h"
+
+@interface AKAMainThreadWatchdogTests : XCTestCase<AKAMainThreadWatchdogDelegate, UITableViewDataSource>
+
+@property(nonatomic) NSUInteger delegateCallCount;
+
+@end
+
+@implementation AKAMainThreadWatchdogTests
+
+- (void)setUp
+{
+    [super setUp];
+
+    AKAMainThreadWatchdog* watchdog = [AKAMainThreadWatchdog sharedWatchdog];
+    [watchdog clearReport];
+    watchdog.budget = .002;
+    watchdog.delegate = self;
+    watchdog.enabled = YES;
+}
+
+- (void)tearDown
+{
+    AKAMainThreadWatchdog* watchdog = [AKAMainThreadWatchdog sharedWatchdog];
+    watchdog.enabled = NO;
+    watchdog.delegate = nil;
+    watchdog.budget = .008;
+    [watchdog clearReport];
+
+    [super tearDown];
+}
+
+- (void)mainThreadWatchdog:(AKAMainThreadWatchdog *)watchdog
+            didRecordStall:(AKAMainThreadStall *)stall
+{
+    (void)watchdog;
+    (void)stall;
+    ++self.delegateCallCount;
+}
+
+- (NSInteger)tableView:(UITableView *)tableView numberOfRowsInSection:(NSInteger)section
+{
+    (void)tableView;
+    (void)section;
+    return 0;
+}
+
+- (UITableViewCell *)tableView:(UITableView *)tableView cellForRowAtIndexPath:(NSIndexPath *)indexPath
+{
+    (void)tableView;
+    (void)indexPath;
+    return [UITableViewCell new];
+}
+
+- (NSArray<AKAMainThreadStall*>*)stallsOfOperation:(NSString*)operation
+{
+    NSMutableArray* result = [NSMutableArray new];
+    for (AKAMainThreadStall* stall in [AKAMainThreadWatchdog sharedWatchdog].report)
+    {
+        if ([stall.operation containsString:operation])
+        {
+            [result addObject:stall];
+        }
+    }
+    return result;
+}
+
+- (void)testSpansExceedingBudgetAreRecorded
+{
+    XCTAssertTrue([NSThread isMainThread]);
+
+    uint64_t start = AKAMainThreadWatchdogBeginSpan();
+    AKAMainThreadWatchdogEndSpan(start, "fast", self);
+
+    start = AKAMainThreadWatchdogBeginSpan();
+    [NSThread sleepForTimeInterval:.01];
+    AKAMainThreadWatchdogEndSpan(start, "slow", self);
+
+    NSArray<AKAMainThreadStall*>* report = [AKAMainThreadWatchdog sharedWatchdog].report;
+    XCTAssertEqual((NSUInteger)1, report.count);
+    XCTAssertEqualObjects(@"slow", report.firstObject.operation);
+    XCTAssertEqual(self.class, report.firstObject.objectType);
+    XCTAssertGreaterThanOrEqual(report.firstObject.duration, .01);
+    XCTAssertEqual((NSUInteger)1, self.delegateCallCount);
+}
+
+- (void)testDisabledWatchdogDoesNotRecord
+{
+    [AKAMainThreadWatchdog sharedWatchdog].enabled = NO;
+
+    uint64_t start = AKAMainThreadWatchdogBeginSpan();
+    XCTAssertEqual((uint64_t)0, start);
+    [NSThread sleepForTimeInterval:.01];
+    AKAMainThreadWatchdogEndSpan(start, "slow", self);
+
+    XCTAssertEqual((NSUInteger)0, [AKAMainThreadWatchdog sharedWatchdog].report.count);
+}
+
+- (void)testBindingUpdatesAreMonitored
+{
+    AKABindingController* controller = [AKABindingController bindingControllerForViewController:[UIViewController new]
+                                                                                withDataContext:nil
+                                                                                       delegate:nil
+                                                                                          error:nil];
+    [controller startObservingChanges];
+
+    UIView* view = [UIView new];
+    UILabel* label = [UILabel new];
+    label.textBinding_aka = @"name";
+    [view addSubview:label];
+
+    NSMutableDictionary* item = [NSMutableDictionary dictionaryWithDictionary:@{ @"name": @"A" }];
+    AKABindingController* child = [controller createOrReuseBindingControllerForTargetObjectHierarchy:view
+                                                                                      withDataContext:item
+                                                                                                error:nil];
+    XCTAssertNotNil(child);
+
+    // Record every monitored span
+    [AKAMainThreadWatchdog sharedWatchdog].budget = 0;
+    [[AKAMainThreadWatchdog sharedWatchdog] clearReport];
+
+    [item setValue:@"B" forKey:@"name"];
+    XCTAssertEqualObjects(@"B", label.text);
+
+    NSArray<AKAMainThreadStall*>* stalls = [self stallsOfOperation:@"-[AKABinding updateTargetValueForSourceValue:changeTo:]"];
+    XCTAssertEqual((NSUInteger)1, stalls.count);
+    XCTAssertTrue([stalls.firstObject.objectType isSubclassOfClass:[AKABinding class]]);
+    XCTAssertEqualObjects(@"name", stalls.firstObject.expressionText);
+    XCTAssertNotNil(stalls.firstObject.objectIdentity);
+
+    [controller stopObservingChanges];
+}
+
+- (void)testTableViewUpdatesAreMonitored
+{
+    UITableView* tableView = [[UITableView alloc] initWithFrame:CGRectMake(0, 0, 320, 480)
+                                                          style:UITableViewStylePlain];
+    tableView.dataSource = self;
+    AKATVMultiplexedDataSource* multiplexer = [AKATVMultiplexedDataSource proxyDataSourceAndDelegateForKey:@"default"
+                                                                                               inTableView:tableView];
+    XCTAssertNotNil(multiplexer);
+
+    // Record every monitored span
+    [AKAMainThreadWatchdog sharedWatchdog].budget = 0;
+    [[AKAMainThreadWatchdog sharedWatchdog] clearReport];
+
+    [multiplexer beginUpdates];
+    [multiplexer endUpdates];
+
+    NSArray<AKAMainThreadStall*>* stalls = [self stallsOfOperation:@"-[AKATVMultiplexedDataSource endUpdates]"];
+    XCTAssertEqual((NSUInteger)1, stalls.count);
+    XCTAssertEqual([AKATVMultiplexedDataSource class], stalls.firstObject.objectType);
+    XCTAssertNil(stalls.firstObject.expressionText);
+}
+
+@end
@@ -0,0 +1,167 @@
+//
+//  AKAMutableOrderedDictionaryTests.m
+//  AKABeacon
+//
+//  Created by Michael Utech on 19.10.16.
+//  Copyright © 2016 Michael Utech & AKA Sarl. All rights reserved.
+//
+
+@import Foundation;
+
+#import <XCTest/XCTest.h>
+
+#import "AKAMutableOrderedDictionary.h"
+
+@interface AKAMutableOrderedDictionaryTests : XCTestCase
+
+@property(nonatomic) AKAMutableOrderedDictionary<NSString*, NSNumber*>* dictionary;
+
+@end
+
+@implementation AKAMutableOrderedDictionaryTests
+
+- (void)setUp
+{
+    [super setUp];
+
+    self.dictionary = [AKAMutableOrderedDictionary new];
+    self.dictionary[@"c"] = @3;
+    self.dictionary[@"a"] = @1;
+    self.dictionary[@"b"] = @2;
+}
+
+- (NSArray<NSString*>*)keys
+{
+    NSMutableArray* result = [NSMutableArray new];
+    for (NSString* key in self.dictionary)
+    {
+        [result addObject:key];
+    }
+    return result;
+}
+
+- (void)testKeysPreserveInsertionOrder
+{
+    NSArray* expected = @[ @"c", @"a", @"b" ];
+
+    XCTAssertEqual((NSUInteger)3, self.dictionary.count);
+    XCTAssertEqualObjects(expected, [self keys]);
+    XCTAssertEqualObjects(expected, self.dictionary.keyEnumerator.allObjects);
+    XCTAssertEqualObjects(expected.reverseObjectEnumerator.allObjects,
+                          self.dictionary.reverseKeyEnumerator.allObjects);
+    for (NSUInteger i = 0; i < expected.count; ++i)
+    {
+        XCTAssertEqualObjects(expected[i], [self.dictionary keyAtIndex:i]);
+    }
+    XCTAssertEqualObjects(@1, self.dictionary[@"a"]);
+    XCTAssertThrowsSpecificNamed([self.dictionary keyAtIndex:3], NSException, NSRangeException);
+}
+
+- (void)testReplacingValueKeepsPosition
+{
+    self.dictionary[@"a"] = @10;
+
+    XCTAssertEqual((NSUInteger)3, self.dictionary.count);
+    XCTAssertEqualObjects(@10, self.dictionary[@"a"]);
+    XCTAssertEqualObjects((@[ @"c", @"a", @"b" ]), [self keys]);
+}
+
+- (void)testInsertion
+{
+    [self.dictionary insertObject:@0 forKey:@"z" atIndex:0];
+    XCTAssertEqualObjects((@[ @"z", @"c", @"a", @"b" ]), [self keys]);
+
+    // Inserting an existing key moves it
+    [self.dictionary insertObject:@30 forKey:@"c" atIndex:3];
+    XCTAssertEqualObjects((@[ @"z", @"a", @"b", @"c" ]), [self keys]);
+    XCTAssertEqualObjects(@30, self.dictionary[@"c"]);
+    XCTAssertEqual((NSUInteger)4, self.dictionary.count);
+
+    XCTAssertThrowsSpecificNamed([self.dictionary insertObject:@5 forKey:@"y" atIndex:5],
+                                 NSException, NSRangeException);
+
+    // Moving an existing key to an index beyond bounds leaves the dictionary unchanged
+    XCTAssertThrowsSpecificNamed([self.dictionary insertObject:@40 forKey:@"c" atIndex:4],
+                                 NSException, NSRangeException);
+    XCTAssertEqualObjects((@[ @"z", @"a", @"b", @"c" ]), [self keys]);
+    XCTAssertEqualObjects(@30, self.dictionary[@"c"]);
+    XCTAssertEqual((NSUInteger)4, self.dictionary.count);
+}
+
+- (void)testRemoval
+{
+    [self.dictionary removeObjectForKey:@"a"];
+    [self.dictionary removeObjectForKey:@"unknown"];
+
+    XCTAssertEqual((NSUInteger)2, self.dictionary.count);
+    XCTAssertNil(self.dictionary[@"a"]);
+    XCTAssertEqualObjects((@[ @"c", @"b" ]), [self keys]);
+
+    // Subscripting nil removes the key
+    self.dictionary[@"c"] = nil;
+    XCTAssertEqualObjects((@[ @"b" ]), [self keys]);
+
+    [self.dictionary removeAllObjects];
+    XCTAssertEqual((NSUInteger)0, self.dictionary.count);
+    XCTAssertEqualObjects((@[]), [self keys]);
+}
+
+- (void)testKeysAreCopied
+{
+    NSMutableString* key = [NSMutableString stringWithString:@"d"];
+    self.dictionary[key] = @4;
+    [key setString:@"e"];
+
+    XCTAssertEqualObjects(@4, self.dictionary[@"d"]);
+    XCTAssertNil(self.dictionary[@"e"]);
+}
+
+- (void)testSettingNilObjectFails
+{
+    id object = nil;
+    XCTAssertThrows([self.dictionary setObject:object forKey:@"a"]);
+    XCTAssertEqualObjects(@1, self.dictionary[@"a"]);
+}
+
+- (void)testMutationDuringEnumerationFails
+{
+    NSEnumerator* enumerator = self.dictionary.keyEnumerator;
+    XCTAssertEqualObjects(@"c", enumerator.nextObject);
+    [self.dictionary removeObjectForKey:@"a"];
+    XCTAssertThrowsSpecificNamed(enumerator.nextObject, NSException, NSGenericException);
+
+    void (^mutateWhileEnumerating)(void) = ^{
+        for (NSString* key in self.dictionary)
+        {
+            self.dictionary[[key stringByAppendingString:@"'"]] = @0;
+        }
+    };
+    XCTAssertThrowsSpecificNamed(mutateWhileEnumerating(), NSException, NSGenericException);
+}
+
+- (void)testLargeDictionaryMatchesArray
+{
+    AKAMutableOrderedDictionary* dictionary = [AKAMutableOrderedDictionary new];
+    NSMutableArray* expected = [NSMutableArray new];
+
+    for (NSUInteger i = 0; i < 500; ++i)
+    {
+        NSUInteger index = (i * 31) % (expected.count + 1);
+        [dictionary insertObject:@(i) forKey:@(i) atIndex:index];
+        [expected insertObject:@(i) atIndex:index];
+    }
+    for (NSUInteger i = 0; i < 500; i += 3)
+    {
+        [dictionary removeObjectForKey:@(i)];
+        [expected removeObject:@(i)];
+    }
+
+    XCTAssertEqual(expected.count, dictionary.count);
+    XCTAssertEqualObjects(expected, dictionary.keyEnumerator.allObjects);
+    for (NSUInteger i = 0; i < expected.count; ++i)
+    {
+        XCTAssertEqualObjects(expected[i], [dictionary keyAtIndex:i]);
+    }
+}
+
+@end
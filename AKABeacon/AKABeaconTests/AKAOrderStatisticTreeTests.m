@@ -0,0 +1,170 @@
+//
+//  AKAOrderStatisticTreeTests.m
+//  AKABeacon
+//
+//  Created by Michael Utech on 19.10.16.
+//  Copyright © 2016 Michael Utech & AKA Sarl. All rights reserved.
+//
+
+@import Foundation;
+
+#import <XCTest/XCTest.h>
+
+#import "AKAOrderStatisticTree.h"
+
+@interface AKAOrderStatisticTreeTests : XCTestCase
+
+@end
+
+@implementation AKAOrderStatisticTreeTests
+
+- (void)assertTree:(AKAOrderStatisticTree*)tree matchesItems:(NSArray*)items
+{
+    XCTAssertEqual(items.count, tree.count);
+    for (NSUInteger i = 0; i < items.count; ++i)
+    {
+        XCTAssertEqual(items[i], [tree itemAtIndex:i]);
+        XCTAssertEqual(i, [tree indexOfItem:items[i]]);
+    }
+    XCTAssertNil([tree itemAtIndex:items.count]);
+
+    NSMutableArray* enumerated = [NSMutableArray new];
+    [tree enumerateItemsUsingBlock:^(id item, NSUInteger idx, BOOL* stop) {
+        (void)stop;
+        XCTAssertEqual(enumerated.count, idx);
+        [enumerated addObject:item];
+    }];
+    XCTAssertEqualObjects(items, enumerated);
+}
+
+- (void)testInitWithItems
+{
+    for (NSUInteger count = 0; count < 20; ++count)
+    {
+        NSMutableArray* items = [NSMutableArray new];
+        for (NSUInteger i = 0; i < count; ++i)
+        {
+            [items addObject:[NSObject new]];
+        }
+        [self assertTree:[[AKAOrderStatisticTree alloc] initWithItems:items] matchesItems:items];
+    }
+}
+
+- (void)testRandomInsertionsAndRemovals
+{
+    NSComparator comparator = ^NSComparisonResult(NSString* value, NSString* otherValue) {
+        return [value compare:otherValue];
+    };
+
+    AKAOrderStatisticTree* tree = [AKAOrderStatisticTree new];
+    NSMutableArray* items = [NSMutableArray new];
+
+    for (NSUInteger i = 0; i < 500; ++i)
+    {
+        if (items.count > 0 && arc4random_uniform(3) == 0)
+        {
+            NSUInteger index = arc4random_uniform((uint32_t)items.count);
+            id item = items[index];
+            XCTAssertEqual(index, [tree removeItem:item]);
+            XCTAssertEqual((NSUInteger)NSNotFound, [tree removeItem:item]);
+            [items removeObjectAtIndex:index];
+        }
+        else
+        {
+            // Distinct instances, equal values are inserted before existing ones
+            id item = [[NSMutableString alloc] initWithFormat:@"%03u", arc4random_uniform(100)];
+            NSUInteger index = [items indexOfObject:item
+                                      inSortedRange:NSMakeRange(0, items.count)
+                                            options:NSBinarySearchingInsertionIndex | NSBinarySearchingFirstEqual
+                                    usingComparator:comparator];
+            XCTAssertEqual(index, [tree insertItem:item usingComparator:comparator]);
+            XCTAssertEqual((NSUInteger)NSNotFound, [tree insertItem:item usingComparator:comparator]);
+            [items insertObject:item atIndex:index];
+        }
+    }
+
+    [self assertTree:tree matchesItems:items];
+}
+
+- (void)testAppendWithoutComparator
+{
+    AKAOrderStatisticTree* tree = [AKAOrderStatisticTree new];
+    NSArray* items = @[ [NSObject new], [NSObject new], [NSObject new] ];
+
+    for (id item in items)
+    {
+        [tree insertItem:item usingComparator:nil];
+    }
+
+    [self assertTree:tree matchesItems:items];
+}
+
+- (void)testDeallocatedItemsAreRemovedWhenInserting
+{
+    NSComparator comparator = ^NSComparisonResult(NSString* value, NSString* otherValue) {
+        return [value compare:otherValue];
+    };
+
+    NSMutableString* a = [NSMutableString stringWithString:@"a"];
+    NSMutableString* e = [NSMutableString stringWithString:@"e"];
+    AKAOrderStatisticTree* tree = nil;
+    @autoreleasepool
+    {
+        NSMutableArray* items = [NSMutableArray arrayWithObject:a];
+        for (NSString* value in @[ @"b", @"c", @"d" ])
+        {
+            [items addObject:[NSMutableString stringWithString:value]];
+        }
+        [items addObject:e];
+        tree = [[AKAOrderStatisticTree alloc] initWithItems:items];
+    }
+    XCTAssertEqual((NSUInteger)5, tree.count);
+    XCTAssertNil([tree itemAtIndex:2]);
+
+    // Deallocated items do not affect the insert position
+    NSMutableString* f = [NSMutableString stringWithString:@"f"];
+    NSMutableString* b = [NSMutableString stringWithString:@"b"];
+    NSUInteger index = [tree insertItem:b usingComparator:comparator];
+    XCTAssertEqual([tree indexOfItem:b], index);
+    index = [tree insertItem:f usingComparator:comparator];
+    XCTAssertEqual([tree indexOfItem:f], index);
+
+    NSMutableArray* liveItems = [NSMutableArray new];
+    [tree enumerateItemsUsingBlock:^(id item, NSUInteger idx, BOOL* stop) {
+        (void)idx;
+        (void)stop;
+        [liveItems addObject:item];
+    }];
+    XCTAssertEqualObjects((@[ a, b, e, f ]), liveItems);
+}
+
+- (void)testPositionalInsertionOfItemsIdentifiedByEquality
+{
+    AKAOrderStatisticTree* tree =
+        [[AKAOrderStatisticTree alloc] initWithItems:@[ @"b", @"d" ]
+                                         itemOptions:(NSPointerFunctionsStrongMemory |
+                                                      NSPointerFunctionsObjectPersonality)];
+
+    XCTAssertEqual((NSUInteger)2, [tree insertItem:@"e" atIndex:2]);
+    XCTAssertEqual((NSUInteger)0, [tree insertItem:@"a" atIndex:0]);
+    XCTAssertEqual((NSUInteger)2, [tree insertItem:@"c" atIndex:2]);
+    XCTAssertEqual((NSUInteger)NSNotFound, [tree insertItem:[@"c" mutableCopy] atIndex:0]);
+    XCTAssertThrowsSpecificNamed([tree insertItem:@"f" atIndex:6], NSException, NSRangeException);
+
+    NSArray* items = @[ @"a", @"b", @"c", @"d", @"e" ];
+    [self assertTree:tree matchesItems:items];
+    XCTAssertEqual((NSUInteger)2, [tree indexOfItem:[@"c" mutableCopy]]);
+    XCTAssertEqualObjects(items, tree.itemEnumerator.allObjects);
+    XCTAssertEqualObjects(items.reverseObjectEnumerator.allObjects, tree.reverseItemEnumerator.allObjects);
+
+    XCTAssertEqual((NSUInteger)4, [tree removeItem:@"e"]);
+    XCTAssertEqual((NSUInteger)4, [tree insertItem:@"f" atIndex:4]);
+    XCTAssertEqualObjects((@[ @"a", @"b", @"c", @"d", @"f" ]), tree.itemEnumerator.allObjects);
+
+    NSEnumerator* enumerator = tree.itemEnumerator;
+    [tree removeAllItems];
+    XCTAssertEqual((NSUInteger)0, tree.count);
+    XCTAssertThrowsSpecificNamed(enumerator.nextObject, NSException, NSGenericException);
+}
+
+@end
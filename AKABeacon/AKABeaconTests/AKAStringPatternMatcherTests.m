@@ -0,0 +1,180 @@
+//
+//  AKAStringPatternMatcherTests.m
+//  AKABeacon
+//
+//  Created by Michael Utech on 19.10.16.
+//  Copyright © 2016 Michael Utech & AKA Sarl. All rights reserved.
+//
+
+@import Foundation;
+
+#import <XCTest/XCTest.h>
+
+#import "AKAStringPatternMatcher.h"
+#import "AKAAttributedFormatter.h"
+
+@interface AKAStringPatternMatcherTests : XCTestCase
+
+@end
+
+@implementation AKAStringPatternMatcherTests
+
+#pragma mark - Helpers
+
+- (NSArray<NSValue*>*)rangesOfPattern:(NSString*)pattern
+                             inString:(NSString*)text
+                              options:(NSStringCompareOptions)options
+{
+    NSMutableArray<NSValue*>* result = [NSMutableArray new];
+    NSRange scope = NSMakeRange(0, text.length);
+    while (scope.length > 0)
+    {
+        NSRange range = [text rangeOfString:pattern options:options range:scope];
+        if (range.location == NSNotFound || range.length == 0)
+        {
+            break;
+        }
+        [result addObject:[NSValue valueWithRange:range]];
+        scope = NSMakeRange(NSMaxRange(range), text.length - NSMaxRange(range));
+    }
+    return result;
+}
+
+- (NSString*)longText
+{
+    NSString* paragraph =
+        @"Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod tempor "
+        @"incididunt ut labore et dolore magna aliqua. Ut enim ad minim veniam, quis nostrud "
+        @"exercitation ullamco laboris nisi ut aliquip ex ea commodo consequat. Café Crème, "
+        @"Übergrößenträger und Äpfel. ";
+    NSMutableString* result = [NSMutableString new];
+    for (int i = 0; i < 200; ++i)
+    {
+        [result appendString:paragraph];
+    }
+    return result;
+}
+
+- (void)assertMatcherForPattern:(NSString*)pattern
+                       inString:(NSString*)text
+                        options:(NSStringCompareOptions)options
+{
+    AKAStringPatternMatcher* matcher = [[AKAStringPatternMatcher alloc] initWithPattern:pattern
+                                                                                options:options];
+    NSArray* expected = [self rangesOfPattern:pattern inString:text options:options];
+    NSArray* actual = [matcher rangesOfMatchesInString:text];
+    XCTAssertEqualObjects(expected, actual, @"pattern \"%@\", options %lu", pattern, (unsigned long)options);
+}
+
+#pragma mark - Tests
+
+- (void)testMatchesAgreeWithStringSearch
+{
+    NSString* text = [self longText];
+    NSArray<NSString*>* patterns = @[ @"o", @"dolor", @"DOLOR", @"cafe", @"CRÈME", @"ubergrossen", @"äpfel", @"ut ", @"x" ];
+    NSArray<NSNumber*>* options = @[ @(0),
+                                     @(NSLiteralSearch),
+                                     @(NSCaseInsensitiveSearch),
+                                     @(NSDiacriticInsensitiveSearch),
+                                     @(NSCaseInsensitiveSearch | NSDiacriticInsensitiveSearch),
+                                     @(NSCaseInsensitiveSearch | NSLiteralSearch) ];
+
+    for (NSString* pattern in patterns)
+    {
+        for (NSNumber* option in options)
+        {
+            [self assertMatcherForPattern:pattern inString:text options:option.unsignedIntegerValue];
+        }
+    }
+}
+
+- (void)testFallbackForDecomposedCharacters
+{
+    NSString* text = @"Cafe\u0301 caf\u00e9 cafe\u0301";
+
+    [self assertMatcherForPattern:@"café" inString:text options:NSCaseInsensitiveSearch];
+    [self assertMatcherForPattern:@"cafe" inString:text options:NSCaseInsensitiveSearch | NSDiacriticInsensitiveSearch];
+}
+
+- (void)testUnsupportedOptionsUseStringSearch
+{
+    AKAStringPatternMatcher* matcher = [[AKAStringPatternMatcher alloc] initWithPattern:@"a+"
+                                                                                options:NSRegularExpressionSearch];
+    XCTAssertFalse(matcher.supportsFastSearch);
+    XCTAssertEqual(2, [matcher rangesOfMatchesInString:@"aa b aaa"].count);
+}
+
+- (void)testStopEnumeration
+{
+    AKAStringPatternMatcher* matcher = [[AKAStringPatternMatcher alloc] initWithPattern:@"a"
+                                                                                options:0];
+    NSUInteger count = [matcher enumerateRangesOfMatchesInString:@"aaaa"
+                                                      usingBlock:
+                        ^(NSRange range, BOOL * _Nonnull stop)
+                        {
+                            *stop = range.location == 1;
+                        }];
+    XCTAssertEqual(2, count);
+}
+
+- (void)testAttributedFormatterHighlighting
+{
+    AKAAttributedFormatter* formatter = [AKAAttributedFormatter new];
+    formatter.pattern = @"ab";
+    formatter.patternOptions = NSCaseInsensitiveSearch;
+    formatter.attributes[NSForegroundColorAttributeName] = [UIColor redColor];
+
+    NSAttributedString* result = [formatter attributedStringForObjectValue:@"xAbyabz" withDefaultAttributes:nil];
+
+    NSRange effectiveRange;
+    XCTAssertNil([result attribute:NSForegroundColorAttributeName atIndex:0 effectiveRange:nil]);
+    XCTAssertNotNil([result attribute:NSForegroundColorAttributeName atIndex:1 effectiveRange:&effectiveRange]);
+    XCTAssertEqual(2, effectiveRange.length);
+    XCTAssertNotNil([result attribute:NSForegroundColorAttributeName atIndex:4 effectiveRange:&effectiveRange]);
+    XCTAssertEqual(2, effectiveRange.length);
+}
+
+#pragma mark - Performance
+
+- (void)testStringSearchPerformance
+{
+    NSString* text = [self longText];
+    [self measureBlock:^{
+        for (int i = 0; i < 20; ++i)
+        {
+            [self rangesOfPattern:@"dolor" inString:text options:NSCaseInsensitiveSearch|NSDiacriticInsensitiveSearch];
+        }
+    }];
+}
+
+- (void)testMatcherPerformance
+{
+    NSString* text = [self longText];
+    [self measureBlock:^{
+        for (int i = 0; i < 20; ++i)
+        {
+            AKAStringPatternMatcher* matcher =
+                [[AKAStringPatternMatcher alloc] initWithPattern:@"dolor"
+                                                         options:NSCaseInsensitiveSearch|NSDiacriticInsensitiveSearch];
+            [matcher rangesOfMatchesInString:text];
+        }
+    }];
+}
+
+- (void)testAttributedFormatterPerformance
+{
+    NSString* text = [self longText];
+    AKAAttributedFormatter* formatter = [AKAAttributedFormatter new];
+    formatter.pattern = @"or";
+    formatter.patternOptions = NSCaseInsensitiveSearch|NSDiacriticInsensitiveSearch;
+    formatter.attributes[NSBackgroundColorAttributeName] = [UIColor yellowColor];
+
+    [self measureBlock:^{
+        for (int i = 0; i < 20; ++i)
+        {
+            [formatter attributedStringForObjectValue:text withDefaultAttributes:nil];
+        }
+    }];
+}
+
+@end
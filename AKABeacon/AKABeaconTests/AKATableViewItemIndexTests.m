@@ -0,0 +1,88 @@
+//
+//  AKATableViewItemIndexTests.m
+//  AKABeacon
+//
+//  Created by Michael Utech on 19.10.16.
+//  Copyright © 2016 Michael Utech & AKA Sarl. All rights reserved.
+//
+
+@import UIKit;
+
+#import <XCTest/XCTest.h>
+
+#import "AKATableViewItemIndex.h"
+#import "AKATableViewSectionDataSourceInfo.h"
+
+@interface AKATableViewItemIndexTests : XCTestCase
+
+@end
+
+@implementation AKATableViewItemIndexTests
+
+- (AKATableViewSectionDataSourceInfo*)sectionWithRows:(NSArray*)rows
+{
+    AKATableViewSectionDataSourceInfo* result = [AKATableViewSectionDataSourceInfo new];
+    result.rows = rows;
+    return result;
+}
+
+- (void)testLookup
+{
+    NSString* a = [NSMutableString stringWithString:@"a"];
+    NSString* b = [NSMutableString stringWithString:@"b"];
+    NSString* equalToA = [NSMutableString stringWithString:@"a"];
+
+    AKATableViewSectionDataSourceInfo* s0 = [self sectionWithRows:@[ a ]];
+    AKATableViewSectionDataSourceInfo* s1 = [self sectionWithRows:@[ equalToA, b ]];
+
+    AKATableViewItemIndex* index = [AKATableViewItemIndex new];
+    index.sections = @[ s0, [NSNull null], s1 ];
+
+    XCTAssertEqual((NSUInteger)0, [index indexOfSectionInfo:s0]);
+    XCTAssertEqual((NSUInteger)2, [index indexOfSectionInfo:s1]);
+    XCTAssertEqual((NSUInteger)NSNotFound, [index indexOfSectionInfo:[self sectionWithRows:@[]]]);
+
+    XCTAssertEqualObjects([NSIndexPath indexPathForRow:0 inSection:0], [index indexPathForItem:a]);
+    XCTAssertEqualObjects([NSIndexPath indexPathForRow:0 inSection:2], [index indexPathForItem:equalToA]);
+    XCTAssertEqualObjects([NSIndexPath indexPathForRow:1 inSection:2], [index indexPathForItem:b]);
+    XCTAssertNil([index indexPathForItem:@"c"]);
+}
+
+- (void)testInvalidation
+{
+    NSString* a = [NSMutableString stringWithString:@"a"];
+    NSString* b = [NSMutableString stringWithString:@"b"];
+
+    AKATableViewSectionDataSourceInfo* s0 = [self sectionWithRows:@[ a, b ]];
+    AKATableViewSectionDataSourceInfo* s1 = [self sectionWithRows:@[ b ]];
+    NSMutableArray* sections = [NSMutableArray arrayWithObjects:s0, s1, nil];
+
+    AKATableViewItemIndex* index = [AKATableViewItemIndex new];
+    index.sections = sections;
+    XCTAssertEqualObjects([NSIndexPath indexPathForRow:1 inSection:0], [index indexPathForItem:b]);
+
+    // Rows changed without invalidation are not picked up:
+    s0.rows = @[ b ];
+    XCTAssertEqualObjects([NSIndexPath indexPathForRow:0 inSection:0], [index indexPathForItem:a]);
+
+    [index invalidateRowsInSection:0];
+    XCTAssertNil([index indexPathForItem:a]);
+    XCTAssertEqualObjects([NSIndexPath indexPathForRow:0 inSection:0], [index indexPathForItem:b]);
+
+    // Sections moved in place:
+    [sections exchangeObjectAtIndex:0 withObjectAtIndex:1];
+    [index invalidateSections];
+    XCTAssertEqual((NSUInteger)1, [index indexOfSectionInfo:s0]);
+    XCTAssertNotNil([index indexPathForItem:b]);
+
+    s1.rows = @[ a ];
+    [index invalidateRowsForSectionInfo:s1];
+    XCTAssertEqualObjects([NSIndexPath indexPathForRow:0 inSection:0], [index indexPathForItem:a]);
+    XCTAssertEqualObjects([NSIndexPath indexPathForRow:0 inSection:1], [index indexPathForItem:b]);
+
+    index.sections = @[ s1 ];
+    XCTAssertEqual((NSUInteger)NSNotFound, [index indexOfSectionInfo:s0]);
+    XCTAssertNil([index indexPathForItem:b]);
+}
+
+@end
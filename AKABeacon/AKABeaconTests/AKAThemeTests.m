@@ -11,9 +11,64 @@
 
 #import <AKABeacon/AKATheme.h>
 #import <AKABeacon/AKABeaconNullability.h>
+#import "AKALayoutConstraintDiff.h"
+
+@interface AKAThemeTestsRemovalRecorder: NSObject<AKAThemeDelegate>
+
+@property(nonatomic, readonly) NSMutableArray<NSLayoutConstraint*>* removedConstraints;
+@property(nonatomic) NSUInteger openBrackets;
+
+@end
+
+@implementation AKAThemeTestsRemovalRecorder
+
+- (instancetype)init
+{
+    if (self = [super init])
+    {
+        _removedConstraints = [NSMutableArray new];
+    }
+    return self;
+}
+
+- (void)themeWillRemoveConstraints:(AKATheme*)theme
+{
+    (void)theme;
+    ++self.openBrackets;
+}
+
+- (void)theme:(AKATheme*)theme didRemoveConstraints:(NSArray*)constraints fromView:(UIView*)view
+{
+    (void)theme;
+    (void)view;
+    NSAssert(self.openBrackets > 0, @"Constraint removal reported outside of will/did remove constraints");
+    [self.removedConstraints addObjectsFromArray:constraints];
+}
+
+- (void)themeDidRemoveConstraints:(AKATheme*)theme
+{
+    (void)theme;
+    --self.openBrackets;
+}
+
+- (NSArray<NSLayoutConstraint*>*)removedThemeConstraints
+{
+    return [self.removedConstraints filteredArrayUsingPredicate:
+            [NSPredicate predicateWithBlock:^BOOL(NSLayoutConstraint* constraint, NSDictionary* bindings) {
+                (void)bindings;
+                return [AKALayoutConstraintDiff isThemeConstraint:constraint];
+            }]];
+}
+
+@end
+
 
 @interface AKAThemeTests : XCTestCase
 
+@property(nonatomic) UIView* container;
+@property(nonatomic) UILabel* label;
+@property(nonatomic) NSDictionary* views;
+
 @end
 
 @implementation AKAThemeTests
@@ -21,6 +76,12 @@
 - (void)setUp
 {
     [super setUp];
+
+    self.container = [[UIView alloc] initWithFrame:CGRectMake(0, 0, 320, 100)];
+    self.label = [UILabel new];
+    self.label.translatesAutoresizingMaskIntoConstraints = NO;
+    [self.container addSubview:self.label];
+    self.views = @{ @"label": self.label };
 }
 
 - (void)tearDown
@@ -72,5 +133,103 @@
 
 }
 
+#pragma mark - Constraint Reuse
+
+- (AKATheme*)themeWithFormats:(NSArray<NSString*>*)formats
+{
+    NSMutableArray* constraints = [NSMutableArray new];
+    for (NSString* format in formats)
+    {
+        [constraints addObject:@{ @"format": format }];
+    }
+    return [AKATheme themeWithDictionary:@{ @"layouts": @[ @{ @"constraints": constraints } ] }];
+}
+
+- (NSSet<NSLayoutConstraint*>*)themeConstraintsInContainer
+{
+    NSMutableSet* result = [NSMutableSet new];
+    for (NSLayoutConstraint* constraint in self.container.constraints)
+    {
+        if ([AKALayoutConstraintDiff isThemeConstraint:constraint])
+        {
+            [result addObject:constraint];
+        }
+    }
+    return result;
+}
+
+- (void)testReapplyingUnchangedThemeReusesConstraints
+{
+    AKATheme* theme = [self themeWithFormats:@[ @"H:|-(8)-[label]-(8)-|" ]];
+    [theme applyToTarget:self.container withViews:self.views delegate:nil];
+    NSSet* installed = [self themeConstraintsInContainer];
+    XCTAssertEqual((NSUInteger)2, installed.count);
+
+    AKAThemeTestsRemovalRecorder* recorder = [AKAThemeTestsRemovalRecorder new];
+    [theme applyToTarget:self.container withViews:self.views delegate:recorder];
+
+    XCTAssertEqualObjects(installed, [self themeConstraintsInContainer]);
+    XCTAssertEqual((NSUInteger)0, recorder.removedThemeConstraints.count);
+    XCTAssertEqual((NSUInteger)0, recorder.openBrackets);
+}
+
+- (void)testAddedThemeConstraintsAreInstalled
+{
+    [[self themeWithFormats:@[ @"H:|-(8)-[label]-(8)-|" ]] applyToTarget:self.container
+                                                                withViews:self.views
+                                                                 delegate:nil];
+    NSSet* installed = [self themeConstraintsInContainer];
+
+    AKAThemeTestsRemovalRecorder* recorder = [AKAThemeTestsRemovalRecorder new];
+    [[self themeWithFormats:@[ @"H:|-(8)-[label]-(8)-|", @"V:|-(4)-[label]" ]] applyToTarget:self.container
+                                                                                   withViews:self.views
+                                                                                    delegate:recorder];
+
+    NSSet* updated = [self themeConstraintsInContainer];
+    XCTAssertEqual((NSUInteger)3, updated.count);
+    XCTAssertTrue([installed isSubsetOfSet:updated]);
+    XCTAssertEqual((NSUInteger)0, recorder.removedThemeConstraints.count);
+    XCTAssertEqual((NSUInteger)0, recorder.openBrackets);
+}
+
+- (void)testRemovedThemeConstraintsAreReportedToDelegate
+{
+    [[self themeWithFormats:@[ @"H:|-(8)-[label]-(8)-|", @"V:|-(4)-[label]" ]] applyToTarget:self.container
+                                                                                   withViews:self.views
+                                                                                    delegate:nil];
+    NSSet* installed = [self themeConstraintsInContainer];
+    XCTAssertEqual((NSUInteger)3, installed.count);
+
+    AKAThemeTestsRemovalRecorder* recorder = [AKAThemeTestsRemovalRecorder new];
+    [[self themeWithFormats:@[ @"H:|-(8)-[label]-(8)-|" ]] applyToTarget:self.container
+                                                                withViews:self.views
+                                                                 delegate:recorder];
+
+    NSSet* updated = [self themeConstraintsInContainer];
+    XCTAssertEqual((NSUInteger)2, updated.count);
+    XCTAssertTrue([updated isSubsetOfSet:installed]);
+
+    NSArray* removed = recorder.removedThemeConstraints;
+    XCTAssertEqual((NSUInteger)1, removed.count);
+    XCTAssertTrue([installed containsObject:removed.firstObject]);
+    XCTAssertFalse([updated containsObject:removed.firstObject]);
+    XCTAssertEqual((NSUInteger)0, recorder.openBrackets);
+}
+
+#pragma mark - Application Plans
+
+- (void)testModifyingLayoutInvalidatesApplicationPlans
+{
+    AKATheme* theme = [self themeWithFormats:@[ @"H:|-(8)-[label]-(8)-|" ]];
+    [theme applyToTarget:self.container withViews:self.views delegate:nil];
+    XCTAssertNil(self.label.text);
+
+    AKAThemeLayout* layout = theme.layouts.firstObject;
+    [layout addViewCustomizationWithDictionary:@{ @"view": @"label",
+                                                  @"properties": @{ @"text": @"Hello there" } }];
+    [theme applyToTarget:self.container withViews:self.views delegate:nil];
+
+    XCTAssertEqualObjects(@"Hello there", self.label.text);
+}
 
 @end
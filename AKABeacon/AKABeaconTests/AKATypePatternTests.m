@@ -0,0 +1,63 @@
+//
+//  AKATypePatternTests.m
+//  AKABeacon
+//
+//  Created by Michael Utech on 19.10.16.
+//  Copyright © 2016 Michael Utech & AKA Sarl. All rights reserved.
+//
+
+@import UIKit;
+
+#import <XCTest/XCTest.h>
+
+#import "AKABindingSpecification.h"
+
+@interface AKATypePatternTests : XCTestCase
+
+@end
+
+@implementation AKATypePatternTests
+
+- (void)testClassMatchesAreStable
+{
+    AKATypePattern* pattern = [[AKATypePattern alloc] initWithDictionary:@{ @"acceptedTypes": @[ [NSString class], [NSNumber class] ],
+                                                                           @"rejectedTypes": [NSDecimalNumber class] }];
+
+    // Repeat to exercise cached and uncached results in alternating order
+    for (NSUInteger i = 0; i < 3; ++i)
+    {
+        XCTAssertTrue([pattern matchesObject:@"text"]);
+        XCTAssertTrue([pattern matchesObject:[@"text" mutableCopy]]);
+        XCTAssertTrue([pattern matchesObject:@(42)]);
+        XCTAssertFalse([pattern matchesObject:[NSDecimalNumber one]]);
+        XCTAssertFalse([pattern matchesObject:@[]]);
+        XCTAssertTrue([pattern matchesObject:nil]);
+    }
+}
+
+- (void)testValueTypeMatches
+{
+    AKATypePattern* pattern = [[AKATypePattern alloc] initWithDictionary:@{ @"acceptedTypes": [NSValue class],
+                                                                           @"acceptedValueTypes": @[ @(@encode(CGRect)) ] }];
+
+    for (NSUInteger i = 0; i < 3; ++i)
+    {
+        XCTAssertTrue([pattern matchesObject:[NSValue valueWithCGRect:CGRectZero]]);
+        XCTAssertFalse([pattern matchesObject:[NSValue valueWithCGPoint:CGPointZero]]);
+        XCTAssertFalse([pattern matchesObject:@"text"]);
+    }
+}
+
+- (void)testConcurrentMatches
+{
+    AKATypePattern* pattern = [[AKATypePattern alloc] initWithClass:[NSString class]];
+    NSArray* objects = @[ @"text", @(1), [@"text" mutableCopy], @[], [NSNull null] ];
+    NSArray* expected = @[ @YES, @NO, @YES, @NO, @NO ];
+
+    dispatch_apply(1000, dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0), ^(size_t iteration) {
+        NSUInteger index = iteration % objects.count;
+        XCTAssertEqual([expected[index] boolValue], [pattern matchesObject:objects[index]]);
+    });
+}
+
+@end